@@ -0,0 +1,76 @@
+# Packs the desktop build's resource folders into a single archive, which the
+# game maps into memory at startup. See source/platform/desktop/
+# resource_archive.hpp for a description of the layout.
+#
+# usage: python3 pack_resources.py <project root> <output file>
+
+import os
+import struct
+import sys
+
+
+folders = ['scripts', 'strings', 'images', 'sounds', 'shaders']
+
+magic = 0x4B504A42
+version = 1
+
+header_size = 16
+entry_size = 16
+
+
+def align(offset, alignment):
+    return (offset + alignment - 1) & ~(alignment - 1)
+
+
+def collect(root):
+    files = []
+    for folder in folders:
+        path = os.path.join(root, folder)
+        for name in os.listdir(path):
+            full_path = os.path.join(path, name)
+            if os.path.isfile(full_path):
+                files.append((folder + '/' + name, full_path))
+
+    # The game looks files up by binary search, so the index needs to be
+    # sorted bytewise.
+    files.sort(key=lambda f: f[0].encode('utf-8'))
+    return files
+
+
+def pack(root, out_path):
+    files = collect(root)
+
+    names = b''
+    name_offsets = []
+    names_begin = header_size + entry_size * len(files)
+    for name, _ in files:
+        name_offsets.append(names_begin + len(names))
+        names += name.encode('utf-8')
+
+    index = b''
+    data = b''
+    data_begin = align(names_begin + len(names), 8)
+    for (name, full_path), name_offset in zip(files, name_offsets):
+        with open(full_path, 'rb') as f:
+            contents = f.read()
+
+        data_offset = data_begin + len(data)
+        index += struct.pack('<IIII',
+                             name_offset,
+                             len(name.encode('utf-8')),
+                             data_offset,
+                             len(contents))
+
+        data += contents + b'\0'
+        data += b'\0' * (align(len(data), 8) - len(data))
+
+    with open(out_path, 'wb') as out:
+        out.write(struct.pack('<IIII', magic, version, len(files), 0))
+        out.write(index)
+        out.write(names)
+        out.write(b'\0' * (data_begin - (names_begin + len(names))))
+        out.write(data)
+
+
+if __name__ == '__main__':
+    pack(sys.argv[1], sys.argv[2])
@@ -0,0 +1,69 @@
+# Assigns an id to each 32x16 frame of the spritesheets, such that identical
+# frames share the same id, across all of the spritesheets. The gameboy advance
+# build uses the ids to skip uploading frames that are already in vram, when
+# swapping spritesheets.
+#
+# Reads the tile data from grit's output, and writes a c++ source file, which
+# gba_platform.cpp includes.
+#
+# usage: python3 sprite_frames.py <data dir> <output file> <spritesheet>...
+
+import os
+import sys
+
+
+# 32x16 pixels, at four bits per pixel.
+frame_words = 64
+
+
+def read_tile_words(path, name):
+    words = []
+    inside = False
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line:
+                continue
+            elif line == name + 'Tiles:':
+                inside = True
+            elif inside and line.startswith('.word'):
+                words += [int(w, 16) for w in line[len('.word'):].split(',')]
+            elif inside and words:
+                break
+    return words
+
+
+def main(data_dir, out_path, names):
+    ids = {}
+    sheets = []
+
+    for name in names:
+        words = read_tile_words(os.path.join(data_dir, name + '.s'), name)
+        frames = []
+        for i in range(0, len(words) // frame_words):
+            frame = tuple(words[i * frame_words:(i + 1) * frame_words])
+            # Zero means unknown, so the ids start at one.
+            frames.append(ids.setdefault(frame, len(ids) + 1))
+        sheets.append((name, frames))
+
+    with open(out_path, 'w') as out:
+        out.write('// clang-format off\n\n')
+        out.write('// This file was generated by build/sprite_frames.py. Do not edit.\n\n\n')
+
+        for name, frames in sheets:
+            out.write('static const u16 {}_frames[] = {{\n'.format(name))
+            for i in range(0, len(frames), 12):
+                row = ', '.join(str(f) for f in frames[i:i + 12])
+                out.write('    {},\n'.format(row))
+            out.write('};\n\n\n')
+
+        out.write('static const SpriteFrames sprite_frames[] = {\n')
+        for name, frames in sheets:
+            out.write('    {{"{0}", {0}_frames, {1}}},\n'.format(name,
+                                                              len(frames)))
+        out.write('};\n\n')
+        out.write('// clang-format on\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1], sys.argv[2], sys.argv[3:])
@@ -85,6 +85,12 @@
 (set 'cell-iters 2)
 
 
+;; Milliseconds, the least amount of time by which we draw the other player
+;; behind their most recent position update, in multiplayer games. Larger values
+;; smooth out more network jitter, at the cost of latency. Read upon connecting.
+(set 'peer-interp-delay 100)
+
+
 
 (set 'pre-levelgen-hooks nil)
 (set 'post-levelgen-hooks nil)
@@ -0,0 +1,514 @@
+#include "data_stream.hpp"
+
+
+namespace data_stream {
+
+
+// Chunks in flight, at most. Must not exceed the number of bits in the ack
+// message's received_mask_ field.
+static const u16 window_size = 16;
+
+// Limits the number of chunks that we send per frame, so that a transfer
+// cannot crowd the regular game messages out of the send queue.
+static const int chunks_per_frame = 4;
+
+static const u32 retransmit_timeout = seconds(1) / 2;
+
+// Upon receiving an ack indicating that a chunk went missing, we resend the
+// chunk right away, unless we only just sent it.
+static const u32 fast_retransmit_holdoff = seconds(1) / 10;
+
+static const u32 chunk_size = net_event::DataStreamChunk::data_size;
+
+static const u32 max_length = 0xffff * chunk_size;
+
+
+// NOTE: unsigned, so that durations computed by subtraction remain correct
+// after the clock wraps.
+static u32 clock;
+
+
+static u8 next_stream_id;
+
+
+template <typename T> static bool send_message(Platform& pfrm, T& message)
+{
+    message.header_.message_type_ = T::mt;
+    return pfrm.network_peer().send_message({(byte*)&message, sizeof message});
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// CRC-32
+////////////////////////////////////////////////////////////////////////////////
+
+
+u32 crc32(const u8* data, u32 length)
+{
+    // Four bits at a time, the full 256 entry table isn't worth the rom space
+    // for the amount of data that we send.
+    static const u32 table[16] = {0x00000000,
+                                  0x1db71064,
+                                  0x3b6e20c8,
+                                  0x26d930ac,
+                                  0x76dc4190,
+                                  0x6b6b51f4,
+                                  0x4db26158,
+                                  0x5005713c,
+                                  0xedb88320,
+                                  0xf00f9344,
+                                  0xd6d6a3e8,
+                                  0xcb61b38c,
+                                  0x9b64c2b0,
+                                  0x86d3d2d4,
+                                  0xa00ae278,
+                                  0xbdbdf21c};
+
+    u32 crc = 0xffffffff;
+
+    for (u32 i = 0; i < length; ++i) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0xf];
+        crc = (crc >> 4) ^ table[crc & 0xf];
+    }
+
+    return ~crc;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Sender
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+struct Sender {
+    const u8* data_;
+    u32 length_;
+    u32 crc_;
+    u8 stream_id_;
+
+    u16 chunk_count_;
+
+    // The oldest chunk that the receiver has not acknowledged.
+    u16 base_;
+
+    // The next chunk that we have not yet sent at all.
+    u16 next_;
+
+    // Bit i set if the receiver acknowledged chunk base_ + i.
+    u32 acked_mask_;
+
+    // Indexed by sequence number modulo window size.
+    u32 sent_at_[window_size];
+
+    // Set once the receiver acknowledges the DataStreamAvail message.
+    bool announced_;
+    u32 announced_at_;
+
+    SendCallback callback_;
+};
+} // namespace
+
+
+static std::optional<Sender> sender;
+
+
+static bool announce(Platform& pfrm, Sender& s)
+{
+    net_event::DataStreamAvail m;
+    m.stream_id_ = s.stream_id_;
+    m.stream_length_.set(s.length_);
+    m.crc_.set(s.crc_);
+
+    s.announced_at_ = clock;
+
+    return send_message(pfrm, m);
+}
+
+
+static bool send_chunk(Platform& pfrm, Sender& s, u16 sequence)
+{
+    net_event::DataStreamChunk m;
+    m.stream_id_ = s.stream_id_;
+    m.sequence_.set(sequence);
+
+    const u32 offset = sequence * chunk_size;
+    const u32 count = std::min(chunk_size, s.length_ - offset);
+
+    memcpy(m.data_, s.data_ + offset, count);
+    memset(m.data_ + count, 0, chunk_size - count);
+
+    s.sent_at_[sequence % window_size] = clock;
+
+    return send_message(pfrm, m);
+}
+
+
+bool send(Platform& pfrm, const u8* data, u32 length, SendCallback callback)
+{
+    if (sender or length > max_length) {
+        return false;
+    }
+
+    sender.emplace(Sender{data,
+                          length,
+                          crc32(data, length),
+                          next_stream_id++,
+                          u16((length + chunk_size - 1) / chunk_size),
+                          0,
+                          0,
+                          0,
+                          {},
+                          false,
+                          0,
+                          callback});
+
+    // If the send queue happens to be full, we'll try again after the
+    // retransmit timeout.
+    announce(pfrm, *sender);
+
+    return true;
+}
+
+
+bool sending()
+{
+    return static_cast<bool>(sender);
+}
+
+
+static void update_sender(Platform& pfrm, Sender& s)
+{
+    // Either the receiver has not acknowledged the stream yet, or we're waiting
+    // on the receiver's DataStreamDone message. In both cases, re-announcing
+    // the stream prompts the receiver to reply again, in case its response got
+    // lost.
+    if (not s.announced_ or s.base_ == s.chunk_count_) {
+        if (clock - s.announced_at_ >= retransmit_timeout) {
+            announce(pfrm, s);
+        }
+        return;
+    }
+
+    int budget = chunks_per_frame;
+
+    for (u16 seq = s.base_; seq < s.next_ and budget; ++seq) {
+        if (s.acked_mask_ & (1 << (seq - s.base_))) {
+            continue;
+        }
+        if (clock - s.sent_at_[seq % window_size] >= retransmit_timeout) {
+            if (not send_chunk(pfrm, s, seq)) {
+                return;
+            }
+            --budget;
+        }
+    }
+
+    while (budget and s.next_ < s.chunk_count_ and
+           s.next_ < s.base_ + window_size) {
+        if (not send_chunk(pfrm, s, s.next_)) {
+            return;
+        }
+        ++s.next_;
+        --budget;
+    }
+}
+
+
+void receive(Platform& pfrm, const net_event::DataStreamAck& m)
+{
+    if (not sender or m.stream_id_ not_eq sender->stream_id_) {
+        return;
+    }
+
+    auto& s = *sender;
+
+    s.announced_ = true;
+
+    const auto next_expected = m.next_expected_.get();
+
+    if (next_expected < s.base_ or next_expected > s.next_) {
+        // Stale, or nonsense.
+        return;
+    }
+
+    const auto shift = next_expected - s.base_;
+    s.acked_mask_ = shift >= 32 ? 0 : s.acked_mask_ >> shift;
+    s.base_ = next_expected;
+
+    const u32 window_mask = (1 << window_size) - 1;
+    s.acked_mask_ |= (m.received_mask_.get() << 1) & window_mask;
+
+    // Any unacknowledged chunk preceding an acknowledged chunk probably went
+    // missing, so schedule it for retransmission, rather than waiting for the
+    // full timeout.
+    for (int i = window_size - 1; i > 0; --i) {
+        if (s.acked_mask_ & (1 << i)) {
+            for (int j = 0; j < i; ++j) {
+                const u16 seq = s.base_ + j;
+                auto& sent_at = s.sent_at_[seq % window_size];
+                if (not(s.acked_mask_ & (1 << j)) and
+                    clock - sent_at >= fast_retransmit_holdoff) {
+                    sent_at = clock - retransmit_timeout;
+                }
+            }
+            break;
+        }
+    }
+}
+
+
+void receive(Platform& pfrm, const net_event::DataStreamDone& m)
+{
+    if (not sender or m.stream_id_ not_eq sender->stream_id_) {
+        return;
+    }
+
+    if (m.status_ not_eq net_event::DataStreamDone::success) {
+        warning(pfrm, "data stream: transfer failed");
+    }
+
+    auto callback = sender->callback_;
+    sender.reset();
+
+    callback(pfrm, m.status_ == net_event::DataStreamDone::success);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Receiver
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+struct Receiver {
+    Receiver(u8* buffer, u32 capacity, ReceiveCallback callback)
+        : buffer_(buffer), capacity_(capacity), callback_(callback)
+    {
+    }
+
+    u8* buffer_;
+    u32 capacity_;
+    ReceiveCallback callback_;
+
+    bool active_ = false;
+    bool complete_ = false;
+    u8 stream_id_ = 0;
+    u32 length_ = 0;
+    u32 crc_ = 0;
+    u16 chunk_count_ = 0;
+
+    // All chunks prior to next_expected_ arrived. Bit i of received_mask_ set
+    // if chunk next_expected_ + 1 + i arrived.
+    u16 next_expected_ = 0;
+    u32 received_mask_ = 0;
+
+    net_event::DataStreamDone::Status status_;
+
+    bool ack_pending_ = false;
+    bool done_pending_ = false;
+};
+} // namespace
+
+
+static std::optional<Receiver> receiver;
+
+
+void set_receive_buffer(u8* buffer, u32 capacity, ReceiveCallback callback)
+{
+    if (not receiver) {
+        receiver.emplace(buffer, capacity, callback);
+        return;
+    }
+
+    // Keep the stream state, so that we can still acknowledge a transfer in
+    // progress, or repeat our DataStreamDone message for a finished one.
+    auto& r = *receiver;
+
+    if (r.active_ and not r.complete_ and
+        (buffer not_eq r.buffer_ or r.length_ > capacity)) {
+        // The chunks that we have so far went into the old buffer, so we
+        // can't finish the stream. Tell the sender that the transfer failed.
+        r.complete_ = true;
+        r.status_ = net_event::DataStreamDone::rejected;
+        r.done_pending_ = true;
+    }
+
+    r.buffer_ = buffer;
+    r.capacity_ = capacity;
+
+    // NOTE: Function has no assignment operator.
+    r.callback_.~ReceiveCallback();
+    new (&r.callback_) ReceiveCallback(callback);
+}
+
+
+static void finish(Platform& pfrm, Receiver& r)
+{
+    r.complete_ = true;
+    r.done_pending_ = true;
+
+    if (crc32(r.buffer_, r.length_) == r.crc_) {
+        r.status_ = net_event::DataStreamDone::success;
+        r.callback_(pfrm, u32(r.length_));
+    } else {
+        warning(pfrm, "data stream: checksum mismatch");
+        r.status_ = net_event::DataStreamDone::checksum_mismatch;
+    }
+}
+
+
+static void reject(Platform& pfrm, u8 stream_id)
+{
+    net_event::DataStreamDone done;
+    done.stream_id_ = stream_id;
+    done.status_ = net_event::DataStreamDone::rejected;
+    send_message(pfrm, done);
+}
+
+
+void receive(Platform& pfrm, const net_event::DataStreamAvail& m)
+{
+    if (not receiver) {
+        reject(pfrm, m.stream_id_);
+        return;
+    }
+
+    auto& r = *receiver;
+
+    if (r.active_ and r.stream_id_ == m.stream_id_) {
+        // The sender did not hear from us.
+        if (r.complete_) {
+            r.done_pending_ = true;
+        } else {
+            r.ack_pending_ = true;
+        }
+        return;
+    }
+
+    r.stream_id_ = m.stream_id_;
+
+    if (m.stream_length_.get() > r.capacity_) {
+        r.active_ = false;
+        reject(pfrm, m.stream_id_);
+        return;
+    }
+
+    r.active_ = true;
+    r.complete_ = false;
+    r.length_ = m.stream_length_.get();
+    r.crc_ = m.crc_.get();
+    r.chunk_count_ = (r.length_ + chunk_size - 1) / chunk_size;
+    r.next_expected_ = 0;
+    r.received_mask_ = 0;
+    r.ack_pending_ = true;
+    r.done_pending_ = false;
+
+    if (r.chunk_count_ == 0) {
+        finish(pfrm, r);
+    }
+}
+
+
+void receive(Platform& pfrm, const net_event::DataStreamChunk& m)
+{
+    if (not receiver) {
+        return;
+    }
+
+    auto& r = *receiver;
+
+    if (not r.active_ or m.stream_id_ not_eq r.stream_id_) {
+        return;
+    }
+
+    if (r.complete_) {
+        // Our DataStreamDone message must have gone missing.
+        r.done_pending_ = true;
+        return;
+    }
+
+    const auto seq = m.sequence_.get();
+
+    if (seq >= r.chunk_count_ or seq > r.next_expected_ + 32) {
+        return;
+    }
+
+    // Either way, we want to tell the sender what we have. If we received a
+    // duplicate, our previous ack probably went missing.
+    r.ack_pending_ = true;
+
+    if (seq < r.next_expected_) {
+        return;
+    }
+
+    const u32 offset = seq * chunk_size;
+    memcpy(r.buffer_ + offset, m.data_, std::min(chunk_size, r.length_ - offset));
+
+    if (seq == r.next_expected_) {
+        ++r.next_expected_;
+        while (r.received_mask_ & 1) {
+            r.received_mask_ >>= 1;
+            ++r.next_expected_;
+        }
+        r.received_mask_ >>= 1;
+    } else {
+        r.received_mask_ |= 1 << (seq - r.next_expected_ - 1);
+    }
+
+    if (r.next_expected_ == r.chunk_count_) {
+        finish(pfrm, r);
+    }
+}
+
+
+static void update_receiver(Platform& pfrm, Receiver& r)
+{
+    if (r.done_pending_) {
+        net_event::DataStreamDone done;
+        done.stream_id_ = r.stream_id_;
+        done.status_ = r.status_;
+        if (send_message(pfrm, done)) {
+            r.done_pending_ = false;
+            r.ack_pending_ = false;
+        }
+    } else if (r.ack_pending_) {
+        // At most one ack per frame, regardless of the number of chunks
+        // received.
+        net_event::DataStreamAck ack;
+        ack.stream_id_ = r.stream_id_;
+        ack.next_expected_.set(r.next_expected_);
+        ack.received_mask_.set(r.received_mask_);
+        if (send_message(pfrm, ack)) {
+            r.ack_pending_ = false;
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+void update(Platform& pfrm, Microseconds delta)
+{
+    clock += delta;
+
+    if (receiver) {
+        update_receiver(pfrm, *receiver);
+    }
+
+    if (sender) {
+        update_sender(pfrm, *sender);
+    }
+}
+
+
+void reset()
+{
+    sender.reset();
+    receiver.reset();
+}
+
+
+} // namespace data_stream
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "function.hpp"
+#include "network_event.hpp"
+
+
+// Bulk data transfer between connected peers. The desync detector uses it to
+// exchange tables of entities, see desync.hpp.
+//
+// The sender announces a stream with a DataStreamAvail message, carrying the
+// stream's length and CRC-32, and then transmits the data in eight byte
+// DataStreamChunk messages, keeping up to a window's worth of chunks in
+// flight. The receiver acknowledges with DataStreamAck messages, which indicate
+// the next chunk that the receiver expects, plus a bitmask of the out-of-order
+// chunks following it that have already arrived, so the sender only needs to
+// retransmit the chunks that actually went missing. When all of the data has
+// arrived, the receiver verifies the checksum, and replies with a
+// DataStreamDone message.
+//
+// One outgoing and one incoming transfer at a time. The caller owns the
+// buffers, which must remain valid until the transfer completes.
+
+
+namespace data_stream {
+
+
+// Called with true if the receiver got the whole stream, and the checksum
+// matched.
+using SendCallback = Function<16, void(Platform&, bool)>;
+
+
+// Returns false if a transfer is already in progress, or if the data is too
+// large to fit in a stream.
+bool send(Platform& pfrm, const u8* data, u32 length, SendCallback callback);
+
+
+bool sending();
+
+
+// Called after the stream has been received and verified. If the peer
+// announces a stream larger than the receive buffer's capacity, we reject
+// the stream.
+using ReceiveCallback = Function<16, void(Platform&, u32 length)>;
+
+
+// Calling this again while a stream is arriving keeps the transfer going, as
+// long as the buffer stays the same. Otherwise, we reject the stream.
+void set_receive_buffer(u8* buffer, u32 capacity, ReceiveCallback callback);
+
+
+// Stop sending, forget about the receive buffer.
+void reset();
+
+
+// Transmits new chunks, acknowledgements, and retransmissions. Call once per
+// frame while connected.
+void update(Platform& pfrm, Microseconds delta);
+
+
+void receive(Platform& pfrm, const net_event::DataStreamAvail& m);
+void receive(Platform& pfrm, const net_event::DataStreamChunk& m);
+void receive(Platform& pfrm, const net_event::DataStreamAck& m);
+void receive(Platform& pfrm, const net_event::DataStreamDone& m);
+
+
+u32 crc32(const u8* data, u32 length);
+
+
+} // namespace data_stream
@@ -0,0 +1,476 @@
+#include "desync.hpp"
+#include "data_stream.hpp"
+#include "game.hpp"
+#include "memory/buffer.hpp"
+#include <cstddef>
+
+
+namespace desync {
+
+
+// About two seconds.
+static const u32 sample_interval = 120;
+
+
+namespace {
+class Hash {
+public:
+    // FNV-1a, a word at a time.
+    void mix(u32 value)
+    {
+        state_ = (state_ ^ value) * 16777619u;
+    }
+
+    void mix(const Entity& e)
+    {
+        // Quantize positions to tiles, as the peers' floating point math may
+        // not agree exactly.
+        const auto pos = e.get_position();
+        mix(s32(pos.x) / 32);
+        mix(s32(pos.y) / 32);
+        mix(e.get_health());
+    }
+
+    u16 fold() const
+    {
+        return state_ ^ (state_ >> 16);
+    }
+
+private:
+    u32 state_ = 2166136261u;
+};
+
+
+struct Sample {
+    u8 level_;
+    u8 index_;
+    u16 rng_;
+    u16 entity_ids_;
+    u16 enemies_;
+    u16 details_;
+    u8 map_;
+};
+
+
+// A table of enemies and details, which the peers exchange over a data stream
+// after the enemy or detail hashes diverge, so that we can log which entities
+// differ. All fields are bytes, so the layout is the same on every platform.
+struct Dump {
+    struct Entry {
+        // Index of the entity's group in the game's enemies or details,
+        // with the high bit set for details.
+        u8 group_;
+        u8 x_;
+        u8 y_;
+        u8 health_;
+    };
+
+    static constexpr u8 detail_bit = 0x80;
+
+    u8 level_;
+    u8 index_;
+    u8 count_;
+
+    // Entities beyond the capacity are left out, so for crowded levels, the
+    // diff may be incomplete.
+    Entry entries_[120];
+};
+} // namespace
+
+
+static bool recording;
+static u8 level;
+static u8 map_hash;
+static u32 frame;
+
+// Entities spawned after level generation take ids from each game's own id
+// counter, and the counters drift apart during play, by design (see
+// Entity::reset_ids()). So only the ids of entities that the level started
+// with need to agree.
+static Entity::Id generated_ids;
+
+// Our most recent samples, and samples from the peer that arrived before we
+// took our own sample with the same number.
+static Buffer<Sample, 4> history;
+static Buffer<Sample, 4> pending;
+
+// Subsystems that differed in the previous comparison, and subsystems that
+// we've already reported as diverged in this level, so that one desync doesn't
+// flood the log.
+static u8 diverged;
+static u8 reported;
+
+// Our table, and the peer's. We take ours at dump_index, the first sample
+// following the divergence, which the peer takes at the same frame.
+static Dump our_dump;
+static Dump their_dump;
+static bool dump_requested;
+static u8 dump_index;
+static bool have_ours;
+static bool have_theirs;
+
+
+static void receive_dump(Platform& pfrm, u32 length);
+
+
+void record(Platform& pfrm, Game& game)
+{
+    Hash map;
+    game.tiles().for_each([&map](u8 t, int, int) { map.mix(t); });
+
+    const auto folded = map.fold();
+
+    recording = true;
+    level = game.level();
+    map_hash = folded ^ (folded >> 8);
+    frame = 0;
+    generated_ids = Entity::max_id();
+    history.clear();
+    pending.clear();
+    diverged = 0;
+    reported = 0;
+    dump_requested = false;
+    have_ours = false;
+    have_theirs = false;
+
+    data_stream::set_receive_buffer(
+        (u8*)&their_dump, sizeof their_dump, [](Platform& pfrm, u32 length) {
+            receive_dump(pfrm, length);
+        });
+}
+
+
+static Sample sample(Game& game, u8 index)
+{
+    Hash r;
+    r.mix(rng::critical_state);
+
+    Hash ids;
+    auto mix_id = [&ids](const Entity& e) {
+        if (e.id() < generated_ids) {
+            ids.mix(e.id());
+        }
+    };
+
+    Hash enemies;
+    game.enemies().transform([&](auto& buf) {
+        for (auto& e : buf) {
+            mix_id(*e);
+            enemies.mix(*e);
+        }
+    });
+
+    Hash details;
+    game.details().transform([&](auto& buf) {
+        using T = typename std::remove_reference_t<decltype(buf)>::ValueType;
+
+        if constexpr (not T::element_type::local_only) {
+            for (auto& e : buf) {
+                mix_id(*e);
+                details.mix(*e);
+            }
+        }
+    });
+
+    return Sample{level,
+                  index,
+                  r.fold(),
+                  ids.fold(),
+                  enemies.fold(),
+                  details.fold(),
+                  map_hash};
+}
+
+
+static void request_dump(u8 index)
+{
+    if (not dump_requested and not have_ours) {
+        dump_requested = true;
+        dump_index = index;
+    }
+}
+
+
+static void compare(Platform& pfrm, const Sample& ours, const Sample& theirs)
+{
+    int subsystem = 0;
+    u8 differed = 0;
+    const u8 previously_reported = reported;
+
+    // Some state legitimately differs for a moment, while the host's rng sync
+    // or an enemy update is in flight. Only report subsystems that differ in
+    // two consecutive samples.
+    auto check = [&](const char* name, u16 our_hash, u16 their_hash) {
+        const u8 bit = 1 << subsystem++;
+
+        if (our_hash == their_hash) {
+            return;
+        }
+
+        differed |= bit;
+
+        if (not(diverged & bit) or (reported & bit)) {
+            return;
+        }
+
+        reported |= bit;
+
+        StringBuffer<80> msg("desync: ");
+        msg += name;
+        msg += " diverged, level ";
+        msg += to_string<8>(ours.level_).c_str();
+        msg += ", frame ";
+        msg += to_string<12>(ours.index_ * sample_interval).c_str();
+        warning(pfrm, msg.c_str());
+    };
+
+    check("rng", ours.rng_, theirs.rng_);
+    check("entity ids", ours.entity_ids_, theirs.entity_ids_);
+    check("enemies", ours.enemies_, theirs.enemies_);
+    check("details", ours.details_, theirs.details_);
+    check("map", ours.map_, theirs.map_);
+
+    diverged = differed;
+
+    // Both peers make the same comparisons, so both should request a table of
+    // the same sample.
+    const u8 entity_subsystems = 0b1100; // enemies, details
+    if ((reported & ~previously_reported) & entity_subsystems) {
+        request_dump(ours.index_ + 1);
+    }
+}
+
+
+static void take_dump(Game& game, u8 index)
+{
+    our_dump.level_ = level;
+    our_dump.index_ = index;
+    our_dump.count_ = 0;
+
+    auto store = [](const Entity& e, u8 group) {
+        if (our_dump.count_ == sizeof our_dump.entries_ / sizeof(Dump::Entry)) {
+            return;
+        }
+        const auto pos = e.get_position();
+        our_dump.entries_[our_dump.count_++] = {
+            group,
+            u8(s32(pos.x) / 32),
+            u8(s32(pos.y) / 32),
+            u8(std::max(0, std::min(e.get_health(), 255)))};
+    };
+
+    u8 group = 0;
+    game.enemies().transform([&](auto& buf) {
+        for (auto& e : buf) {
+            store(*e, group);
+        }
+        ++group;
+    });
+
+    group = Dump::detail_bit;
+    game.details().transform([&](auto& buf) {
+        using T = typename std::remove_reference_t<decltype(buf)>::ValueType;
+
+        if constexpr (not T::element_type::local_only) {
+            for (auto& e : buf) {
+                store(*e, group);
+            }
+        }
+        ++group;
+    });
+
+    have_ours = true;
+}
+
+
+static bool same_sample(const Dump& a, const Dump& b)
+{
+    return a.level_ == b.level_ and a.index_ == b.index_;
+}
+
+
+static void log_entry(Platform& pfrm, const Dump::Entry& e, const char* what)
+{
+    StringBuffer<80> msg("desync: ");
+    msg += e.group_ & Dump::detail_bit ? "detail " : "enemy ";
+    msg += to_string<8>(e.group_ & ~Dump::detail_bit).c_str();
+    msg += " at ";
+    msg += to_string<8>(e.x_).c_str();
+    msg += ", ";
+    msg += to_string<8>(e.y_).c_str();
+    msg += " ";
+    msg += what;
+    warning(pfrm, msg.c_str());
+}
+
+
+// Logs entities that exist on only one side, or whose health differs, up to a
+// limit. We match entities by group and tile, as ids assigned during play
+// differ.
+static void diff_dumps(Platform& pfrm)
+{
+    bool matched[sizeof their_dump.entries_ / sizeof(Dump::Entry)] = {};
+
+    int budget = 8;
+    auto log = [&](const Dump::Entry& e, const char* what) {
+        if (budget) {
+            --budget;
+            log_entry(pfrm, e, what);
+        }
+    };
+
+    for (int i = 0; i < our_dump.count_; ++i) {
+        const auto& ours = our_dump.entries_[i];
+
+        bool found = false;
+        for (int j = 0; j < their_dump.count_; ++j) {
+            const auto& theirs = their_dump.entries_[j];
+            if (not matched[j] and theirs.group_ == ours.group_ and
+                theirs.x_ == ours.x_ and theirs.y_ == ours.y_) {
+                matched[j] = true;
+                found = true;
+                if (theirs.health_ not_eq ours.health_) {
+                    log(ours, "has different health");
+                }
+                break;
+            }
+        }
+
+        if (not found) {
+            log(ours, "is missing on the peer");
+        }
+    }
+
+    for (int j = 0; j < their_dump.count_; ++j) {
+        if (not matched[j]) {
+            log(their_dump.entries_[j], "exists only on the peer");
+        }
+    }
+}
+
+
+static void receive_dump(Platform& pfrm, u32 length)
+{
+    const u32 header = offsetof(Dump, entries_);
+
+    if (length < header or
+        length not_eq header + their_dump.count_ * sizeof(Dump::Entry)) {
+        return;
+    }
+
+    if (their_dump.level_ not_eq level) {
+        return;
+    }
+
+    have_theirs = true;
+
+    if (have_ours) {
+        if (same_sample(our_dump, their_dump)) {
+            diff_dumps(pfrm);
+        }
+    } else {
+        // In case we missed the divergence, e.g. due to a lost message, take
+        // our own table of the same sample, if we haven't passed it yet.
+        request_dump(their_dump.index_);
+    }
+}
+
+
+static void push(Buffer<Sample, 4>& samples, const Sample& s)
+{
+    if (samples.full()) {
+        samples.erase(samples.begin());
+    }
+    samples.push_back(s);
+}
+
+
+void update(Platform& pfrm, Game& game, Microseconds delta)
+{
+    if (not recording) {
+        return;
+    }
+
+    const auto current = frame++;
+
+    if (current % sample_interval not_eq 0) {
+        return;
+    }
+
+    // NOTE: The sample number wraps after a few minutes, which is fine, as we
+    // only hold on to the last few samples.
+    const auto s = sample(game, u8(current / sample_interval));
+
+    push(history, s);
+
+    // NOTE: The data stream reads from our table until the transfer completes,
+    // so we can't take a new one while a transfer from an earlier level is
+    // still going.
+    if (dump_requested and s.index_ == dump_index and
+        not data_stream::sending()) {
+        dump_requested = false;
+        take_dump(game, s.index_);
+
+        const u32 length = offsetof(Dump, entries_) +
+                           our_dump.count_ * sizeof(Dump::Entry);
+        data_stream::send(
+            pfrm, (const u8*)&our_dump, length, [](Platform&, bool) {});
+
+        if (have_theirs and same_sample(our_dump, their_dump)) {
+            diff_dumps(pfrm);
+        }
+    }
+
+    for (auto it = pending.begin(); it not_eq pending.end(); ++it) {
+        if (it->index_ == s.index_) {
+            compare(pfrm, s, *it);
+            pending.erase(it);
+            break;
+        }
+    }
+
+    net_event::StateHash h;
+    h.level_ = s.level_;
+    h.sample_ = s.index_;
+    h.rng_.set(s.rng_);
+    h.entity_ids_.set(s.entity_ids_);
+    h.enemies_.set(s.enemies_);
+    h.details_.set(s.details_);
+    h.map_ = s.map_;
+
+    net_event::transmit(pfrm, h);
+}
+
+
+void receive(Platform& pfrm, Game& game, const net_event::StateHash& hash)
+{
+    // If the levels do not match, one of us has not finished generating the
+    // level yet.
+    if (not recording or hash.level_ not_eq level) {
+        return;
+    }
+
+    const Sample theirs{hash.level_,
+                        hash.sample_,
+                        hash.rng_.get(),
+                        hash.entity_ids_.get(),
+                        hash.enemies_.get(),
+                        hash.details_.get(),
+                        hash.map_};
+
+    for (auto& ours : history) {
+        if (ours.index_ == theirs.index_) {
+            compare(pfrm, ours, theirs);
+            return;
+        }
+    }
+
+    // Either the peer is ahead of us, and we'll compare once we take the same
+    // sample, or the peer is so far behind that we no longer have our sample.
+    if (history.empty() or u8(theirs.index_ - history.back().index_) < 128) {
+        push(pending, theirs);
+    }
+}
+
+
+} // namespace desync
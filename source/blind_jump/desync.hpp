@@ -0,0 +1,45 @@
+#pragma once
+
+#include "network_event.hpp"
+
+
+class Game;
+
+
+// Desync detection for multiplayer games. Both peers generate each level from
+// the same rng seed, and thereafter, a lot of the game logic assumes that the
+// two games agree on the rng state, entity ids, and the like.
+//
+// Every sample_interval frames, counting from the start of the level, each peer
+// hashes the state that both peers should agree upon: the rng state, the ids of
+// the entities that the level started with, the tile coordinates and health
+// of all enemies and map details, and the map as generated. Each subsystem gets
+// its own hash, and we send the hashes to the peer, tagged with the level and
+// the sample number. We keep the last few samples around, and compare the
+// peer's hashes against our own for the same sample, logging whichever
+// subsystems diverged. When the enemies or details diverge, both peers also
+// record a table of those entities at the next sample, and exchange the tables
+// over a data stream, so that we can log which entities differ.
+//
+// NOTE: Both peers need to count frames the same way for the samples to line
+// up, which holds for the loopback benchmark, where both games advance by the
+// same fixed timestep. Over a real link, the peers' positions drift apart by up
+// to a message's latency, so expect some noise from the entity hashes.
+
+
+namespace desync {
+
+
+// Call after generating a level.
+void record(Platform& pfrm, Game& game);
+
+
+// Samples and transmits our hashes, every sample_interval frames. Call once
+// per frame while connected.
+void update(Platform& pfrm, Game& game, Microseconds delta);
+
+
+void receive(Platform& pfrm, Game& game, const net_event::StateHash& hash);
+
+
+} // namespace desync
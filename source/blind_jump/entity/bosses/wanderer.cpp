@@ -1,6 +1,7 @@
 #include "wanderer.hpp"
 #include "blind_jump/entity/effects/explosion.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 #include "boss.hpp"
 #include "number/random.hpp"
 #include "wallCollision.hpp"
@@ -397,7 +398,7 @@ void Wanderer::update(Platform& pf, Game& game, Microseconds dt)
                     s.y_.set(int_pos.y);
                     s.id_.set(id());
 
-                    net_event::transmit(pf, s);
+                    replication::enqueue(pf, s);
 
 
                     net_event::BossSwapTarget t;
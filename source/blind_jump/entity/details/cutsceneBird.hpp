@@ -11,6 +11,10 @@ public:
 
     void update(Platform& pfrm, Game& game, Microseconds dt);
 
+    static constexpr bool local_only = true;
+
+    static constexpr bool parallel_update = true;
+
 private:
     Animation<57, 8, milliseconds(90)> animation_;
 
@@ -9,6 +9,10 @@ public:
 
     void update(Platform& pfrm, Game& game, Microseconds dt);
 
+    static constexpr bool local_only = true;
+
+    static constexpr bool parallel_update = true;
+
     static constexpr bool multiface_sprite = true;
 
     auto get_sprites() const
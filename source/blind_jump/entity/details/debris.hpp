@@ -9,6 +9,10 @@ public:
 
     void update(Platform& pfrm, Game& game, Microseconds delta);
 
+    static constexpr bool local_only = true;
+
+    static constexpr bool parallel_update = true;
+
 private:
     Microseconds timer_;
     Vec2<Float> step_vector_;
@@ -60,6 +60,8 @@ public:
 
     void update(Platform&, Game&, Microseconds dt);
 
+    static constexpr bool parallel_update = true;
+
     void scatter();
 
     bool ready() const;
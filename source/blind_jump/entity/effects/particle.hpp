@@ -17,6 +17,8 @@ public:
 
     void update(Platform& pfrm, Game& game, Microseconds dt);
 
+    static constexpr bool parallel_update = true;
+
 private:
     Microseconds timer_;
     const Microseconds duration_;
@@ -1,6 +1,7 @@
 #include "compactor.hpp"
 #include "blind_jump/entity/effects/explosion.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 #include "common.hpp"
 
 
@@ -91,7 +92,7 @@ void Compactor::update(Platform& pfrm, Game& game, Microseconds dt)
                 // else woke up the compactor enemy.
                 s.id_.set(id());
 
-                net_event::transmit(pfrm, s);
+                replication::enqueue(pfrm, s);
             }
         }
         break;
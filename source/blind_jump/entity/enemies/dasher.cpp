@@ -1,5 +1,6 @@
 #include "dasher.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 #include "common.hpp"
 #include "number/random.hpp"
 #include "wallCollision.hpp"
@@ -312,7 +313,7 @@ void Dasher::update(Platform& pf, Game& game, Microseconds dt)
                 s.y_.set(int_pos.y);
                 s.id_.set(id());
 
-                net_event::transmit(pf, s);
+                replication::enqueue(pf, s);
             }
         }
         break;
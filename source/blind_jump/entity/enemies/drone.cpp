@@ -1,6 +1,7 @@
 #include "drone.hpp"
 #include "blind_jump/game.hpp"
 #include "blind_jump/network_event.hpp"
+#include "blind_jump/replication.hpp"
 #include "common.hpp"
 #include "number/random.hpp"
 
@@ -50,7 +51,7 @@ void Drone::update(Platform& pfrm, Game& game, Microseconds dt)
             s.y_.set(int_pos.y);
             s.id_.set(id());
 
-            net_event::transmit(pfrm, s);
+            replication::enqueue(pfrm, s);
         }
     };
 
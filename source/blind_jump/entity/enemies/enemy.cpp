@@ -1,5 +1,6 @@
 #include "enemy.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 
 
 const Entity& Enemy::boss_get_target(Game& game)
@@ -111,7 +112,7 @@ void Enemy::debit_health(Platform& pfrm, Health amount)
         e.id_.set(id());
         e.new_health_.set(get_health());
 
-        net_event::transmit(pfrm, e);
+        replication::enqueue(pfrm, e);
     }
 }
 
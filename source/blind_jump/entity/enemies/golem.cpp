@@ -1,5 +1,6 @@
 #include "golem.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 #include "common.hpp"
 #include "wallCollision.hpp"
 
@@ -129,7 +130,7 @@ void Golem::update(Platform& pfrm, Game& game, Microseconds dt)
             s.y_.set(int_pos.y);
             s.id_.set(id());
 
-            net_event::transmit(pfrm, s);
+            replication::enqueue(pfrm, s);
         }
     };
 
@@ -1,5 +1,6 @@
 #include "scarecrow.hpp"
 #include "blind_jump/game.hpp"
+#include "blind_jump/replication.hpp"
 #include "common.hpp"
 #include "graphics/overlay.hpp"
 #include "number/random.hpp"
@@ -362,7 +363,7 @@ void Scarecrow::update(Platform& pfrm, Game& game, Microseconds dt)
                 s.y_.set(int_pos.y);
                 s.id_.set(id());
 
-                net_event::transmit(pfrm, s);
+                replication::enqueue(pfrm, s);
             }
         }
         break;
@@ -24,6 +24,12 @@ void Entity::reset_ids()
 }
 
 
+Entity::Id Entity::max_id()
+{
+    return id_counter_;
+}
+
+
 Entity::Entity() : health_(1), id_(id_counter_++)
 {
 }
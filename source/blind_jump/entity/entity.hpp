@@ -46,6 +46,17 @@ public:
     static constexpr bool has_shadow = false;
     static constexpr bool multiface_shadow = false;
 
+    // Set this in a derived class for decorative entities, which each game in
+    // a multiplayer session manages on its own (e.g. birds that scatter when
+    // the local player walks by). Desync detection ignores them.
+    static constexpr bool local_only = false;
+
+    // Set this in a derived class if its update() writes only to the entity
+    // itself: no rng, no spawning, no sounds, and nothing in Game. The
+    // overworld may then update the whole group on another thread, alongside
+    // other such groups.
+    static constexpr bool parallel_update = false;
+
 
     void set_health(Health health)
     {
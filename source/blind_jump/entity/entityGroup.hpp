@@ -3,6 +3,7 @@
 #include "blind_jump/entity/entity.hpp"
 #include "list.hpp"
 #include "memory/pool.hpp"
+#include "platform/platform.hpp"
 #include "transformGroup.hpp"
 
 
@@ -26,6 +27,8 @@ public:
 
     using NodePool_ = EntityNodePool<Capacity>;
 
+    static constexpr u32 buffer_count = sizeof...(Members);
+
     EntityGroup(Pool_& pool, NodePool_& node_pool)
         : TransformGroup<EntityBuffer<Members, Capacity>...>(node_pool)
     {
@@ -90,3 +93,46 @@ typename EntityGroup<Cap, Members...>::Pool_*
 template <size_t Cap, typename... Members>
 typename EntityGroup<Cap, Members...>::NodePool_*
     EntityGroup<Cap, Members...>::node_pool_;
+
+
+// Collects one job per entity buffer, and runs them all with
+// Platform::parallel_for(). Each job calls fn on its own buffer, so fn must not
+// write to anything outside of that buffer's entities, nor read anything that
+// another buffer's job might write.
+template <u32 Capacity, typename F> class GroupJobs {
+public:
+    GroupJobs(F& fn) : fn_(fn)
+    {
+    }
+
+    template <typename B> void push(B& buf)
+    {
+        if (buf.empty()) {
+            return;
+        }
+
+        jobs_.push_back(
+            {&buf, [](void* buffer, F& fn) { fn(*static_cast<B*>(buffer)); }});
+    }
+
+    void run(Platform& pfrm)
+    {
+        pfrm.parallel_for(
+            jobs_.size(),
+            [](void* context, u32 index) {
+                auto& self = *static_cast<GroupJobs*>(context);
+                auto& job = self.jobs_[index];
+                job.run_(job.buffer_, self.fn_);
+            },
+            this);
+    }
+
+private:
+    struct Job {
+        void* buffer_;
+        void (*run_)(void* buffer, F& fn);
+    };
+
+    F& fn_;
+    Buffer<Job, Capacity> jobs_;
+};
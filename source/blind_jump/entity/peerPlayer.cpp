@@ -1,5 +1,6 @@
 #include "peerPlayer.hpp"
 #include "blind_jump/game.hpp"
+#include "script/lisp.hpp"
 #include "wallCollision.hpp"
 
 
@@ -17,6 +18,14 @@ PeerPlayer::PeerPlayer(Platform& pfrm)
 
     head_.set_texture_index(120);
     head_.set_size(Sprite::Size::w16_h32);
+
+    // We create the peer when its first message arrives after connecting, so
+    // changes to the variable take effect upon the next connection.
+    auto delay = lisp::get_var("peer-interp-delay");
+    if (delay->type() == lisp::Value::Type::integer and
+        delay->integer().value_ >= 0) {
+        base_interpolation_delay_ = milliseconds(delay->integer().value_);
+    }
 }
 
 
@@ -28,15 +37,7 @@ void PeerPlayer::sync(Platform& pfrm,
         return;
     }
 
-    Vec2<Float> new_pos{static_cast<Float>(info.x_.get()),
-                        static_cast<Float>(info.y_.get())};
-
-    if (distance(position_, new_pos) > 6) {
-        interp_offset_ = position_ - new_pos;
-        position_ = new_pos;
-    } else {
-        position_ = new_pos;
-    }
+    record_snapshot(info);
 
     if (info.get_visible()) {
         head_.set_alpha(Sprite::Alpha::opaque);
@@ -193,10 +194,6 @@ void PeerPlayer::sync(Platform& pfrm,
     }
 
     sprite_.set_size(Sprite::Size::w32_h32);
-    speed_.x = Float(info.x_speed_) / 10;
-    speed_.y = Float(info.y_speed_) / 10;
-
-    update_sprite_position();
 
     switch (info.get_sprite_size()) {
     case Sprite::Size::w16_h32:
@@ -211,6 +208,52 @@ void PeerPlayer::sync(Platform& pfrm,
 }
 
 
+void PeerPlayer::record_snapshot(const net_event::PlayerInfo& info)
+{
+    Snapshot s;
+    s.time_ = clock_;
+    s.position_ = {static_cast<Float>(info.x_.get()),
+                   static_cast<Float>(info.y_.get())};
+    s.speed_ = {Float(info.x_speed_) / 10, Float(info.y_speed_) / 10};
+
+    if (snapshot_count_) {
+        const auto& prev = snapshot(0);
+
+        // The peer warped, or respawned in a new level. Interpolating across
+        // the gap would look silly.
+        if (distance(prev.position_, s.position_) > 64) {
+            snapshot_count_ = 0;
+            position_ = s.position_;
+            interp_offset_ = {0.f, 0.f};
+        } else {
+            // Same smoothing as RFC 3550's interarrival jitter estimate.
+            const auto interval = s.time_ - prev.time_;
+            if (arrival_interval_ == 0) {
+                arrival_interval_ = interval;
+            }
+            const auto variation = abs(interval - arrival_interval_);
+            arrival_interval_ += (interval - arrival_interval_) / 16;
+            jitter_ += (variation - jitter_) / 16;
+        }
+    } else {
+        position_ = s.position_;
+    }
+
+    snapshot_head_ = (snapshot_head_ + 1) % snapshot_capacity;
+    snapshots_[snapshot_head_] = s;
+    if (snapshot_count_ < snapshot_capacity) {
+        ++snapshot_count_;
+    }
+}
+
+
+Microseconds PeerPlayer::interpolation_delay() const
+{
+    // Allow for one late message, plus some slack for jitter.
+    return std::max(base_interpolation_delay_, arrival_interval_ + jitter_ * 2);
+}
+
+
 void PeerPlayer::update_sprite_position()
 {
     // Note: head has origin shifted, with corresponding adjustment here. This
@@ -233,37 +276,99 @@ void PeerPlayer::update(Platform& pfrm, Game& game, Microseconds dt)
         shadow_.set_alpha(Sprite::Alpha::transparent);
     }
 
-    // Intentionally moves a bit slower than our player character. This actually reduces choppiness.
+    // Intentionally moves a bit slower than our player character. When
+    // dead-reckoning, we'd rather fall slightly short, and have the next
+    // message nudge the peer forward, than overshoot and pull it backwards.
     static const float MOVEMENT_RATE_CONSTANT = 0.000044f;
 
-    const auto wc = check_wall_collisions(game.tiles(), *this);
+    clock_ += dt;
 
-    if (wc.up and speed_.y < 0) {
-        speed_.y = 0;
+    // Microseconds would overflow after half an hour or so, rebase the
+    // timestamps now and then.
+    if (clock_ > seconds(60)) {
+        clock_ -= seconds(30);
+        for (auto& s : snapshots_) {
+            s.time_ -= seconds(30);
+        }
     }
 
-    if (wc.down and speed_.y > 0) {
-        speed_.y = 0;
-    }
+    auto texture_index = sprite_.get_texture_index();
 
-    if (wc.right and speed_.x > 0) {
-        speed_.x = 0;
-    }
+    interp_offset_ =
+        interpolate(Vec2<Float>{0.f, 0.f}, interp_offset_, dt * 0.00004f);
 
-    if (wc.left and speed_.x < 0) {
-        speed_.x = 0;
-    }
+    if (snapshot_count_) {
+        const auto render_time = clock_ - interpolation_delay();
 
-    auto texture_index = sprite_.get_texture_index();
+        Vec2<Float> new_pos;
+        bool extrapolating = false;
 
-    Vec2<Float> new_pos{
-        position_.x - ((speed_.x) * dt * MOVEMENT_RATE_CONSTANT),
-        position_.y - ((speed_.y) * dt * MOVEMENT_RATE_CONSTANT)};
+        const auto& newest = snapshot(0);
 
-    interp_offset_ =
-        interpolate(Vec2<Float>{0.f, 0.f}, interp_offset_, dt * 0.00004f);
+        if (render_time >= newest.time_) {
+            extrapolating = true;
+
+            speed_ = newest.speed_;
+
+            const auto wc = check_wall_collisions(game.tiles(), *this);
+
+            if (wc.up and speed_.y < 0) {
+                speed_.y = 0;
+            }
+
+            if (wc.down and speed_.y > 0) {
+                speed_.y = 0;
+            }
 
-    set_position(new_pos);
+            if (wc.right and speed_.x > 0) {
+                speed_.x = 0;
+            }
+
+            if (wc.left and speed_.x < 0) {
+                speed_.x = 0;
+            }
+
+            // Dead reckoning, relative to the previous frame's position rather
+            // than the snapshot, so that wall collisions stick.
+            const auto step =
+                std::min(dt, newest.time_ + max_extrapolation - render_time);
+
+            new_pos = position_;
+            if (step > 0) {
+                new_pos.x -= speed_.x * step * MOVEMENT_RATE_CONSTANT;
+                new_pos.y -= speed_.y * step * MOVEMENT_RATE_CONSTANT;
+            }
+        } else {
+            // Find the pair of snapshots surrounding the render time. If the
+            // render time precedes everything in the buffer, hold the oldest
+            // snapshot.
+            new_pos = snapshot(snapshot_count_ - 1).position_;
+
+            for (int age = 0; age < snapshot_count_ - 1; ++age) {
+                const auto& after = snapshot(age);
+                const auto& before = snapshot(age + 1);
+
+                if (render_time >= before.time_) {
+                    const auto span = after.time_ - before.time_;
+                    const Float t =
+                        span ? Float(render_time - before.time_) / span : 1.f;
+
+                    new_pos = interpolate(after.position_, before.position_, t);
+                    break;
+                }
+            }
+
+            if (extrapolating_) {
+                // A message arrived while we were dead-reckoning. Blend out
+                // the prediction error, rather than snapping.
+                interp_offset_ = interp_offset_ + (position_ - new_pos);
+            }
+        }
+
+        extrapolating_ = extrapolating;
+
+        set_position(new_pos);
+    }
 
     update_sprite_position();
 
@@ -14,6 +14,12 @@
 // some platforms, for example, the gameboy's game link cable manages about
 // 1Kb/second.
 //
+// We timestamp each PlayerInfo message upon arrival, and store it in a small
+// ring buffer. The peer is drawn a short delay behind the newest message (see
+// interpolation_delay()), interpolating between the two buffered snapshots
+// surrounding the render time. If the next message is late, we dead-reckon
+// from the last received velocity, for a short while.
+//
 ////////////////////////////////////////////////////////////////////////////////
 
 
@@ -48,9 +54,60 @@ public:
         return warping_;
     }
 
+    // How far behind the most recent snapshot we draw the peer. Scales with
+    // the measured arrival interval and jitter, so that the next message
+    // usually arrives before we need it, but never drops below the base delay,
+    // set through the peer-interp-delay script variable.
+    Microseconds interpolation_delay() const;
+
+    // Smoothed variation in the interval between received messages.
+    Microseconds jitter() const
+    {
+        return jitter_;
+    }
+
+    // Smoothed interval between received messages.
+    Microseconds arrival_interval() const
+    {
+        return arrival_interval_;
+    }
+
+    // If the peer-interp-delay variable is missing, or not an integer.
+    static constexpr Microseconds default_interpolation_delay =
+        seconds(1) / 10;
+
+    // Do not extrapolate further than this past the most recent snapshot.
+    static constexpr Microseconds max_extrapolation = seconds(1) / 4;
+
 private:
     void update_sprite_position();
 
+    void record_snapshot(const net_event::PlayerInfo& info);
+
+    struct Snapshot {
+        Microseconds time_;
+        Vec2<Float> position_;
+        Vec2<Float> speed_;
+    };
+
+    static constexpr int snapshot_capacity = 8;
+
+    const Snapshot& snapshot(int age) const
+    {
+        return snapshots_[(snapshot_head_ + snapshot_capacity - age) %
+                          snapshot_capacity];
+    }
+
+    Snapshot snapshots_[snapshot_capacity];
+    u8 snapshot_head_ = 0;
+    u8 snapshot_count_ = 0;
+
+    Microseconds clock_ = 0;
+    Microseconds base_interpolation_delay_ = default_interpolation_delay;
+    Microseconds arrival_interval_ = 0;
+    Microseconds jitter_ = 0;
+    bool extrapolating_ = false;
+
     std::optional<Platform::DynamicTexturePtr> dynamic_texture_;
     Vec2<Float> speed_;
     Sprite shadow_;
@@ -1,10 +1,15 @@
 #include "game.hpp"
+#include "bitvector.hpp"
 #include "bulkAllocator.hpp"
+#include "data_stream.hpp"
+#include "desync.hpp"
 #include "function.hpp"
 #include "globals.hpp"
 #include "graphics/overlay.hpp"
 #include "number/random.hpp"
 #include "path.hpp"
+#include "replication.hpp"
+#include "saveSchema.hpp"
 #include "script/lisp.hpp"
 #include "string.hpp"
 #include "util.hpp"
@@ -20,19 +25,19 @@ bool within_view_frustum(const Platform::Screen& screen,
 
 bool Game::load_save_data(Platform& pfrm)
 {
-    alignas(PersistentData) u8 save_buffer[sizeof(PersistentData)] = {0};
+    if (not save::load(pfrm, persistent_data_, save::boot_fields)) {
+        return false;
+    }
 
-    if (pfrm.read_save_data(save_buffer, sizeof(PersistentData), 0)) {
-        PersistentData* loaded = (PersistentData*)save_buffer;
-        if (loaded->magic_.get() == PersistentData::magic_val) {
-            info(pfrm, "loaded existing save file");
-            persistent_data_ = *loaded;
+    info(pfrm, "loaded existing save file");
 
-            return true;
-        }
+    // A clean save holds no run to resume, so the title screen only offers a
+    // new game, which overwrites the run state anyway. No need to decode it.
+    if (not persistent_data_.clean_) {
+        save::load(pfrm, persistent_data_, save::run_fields);
     }
 
-    return false;
+    return true;
 }
 
 
@@ -59,7 +64,7 @@ void newgame(Platform& pfrm, Game& game)
 
     game.persistent_data().settings_ = settings;
 
-    pfrm.write_save_data(&game.persistent_data(), sizeof(PersistentData), 0);
+    save::store(pfrm, game.persistent_data());
 
     game.player().set_health(game.persistent_data().player_health_.get());
     game.score() = 0;
@@ -150,8 +155,7 @@ Game::Game(Platform& pfrm)
         // Not sure what else to do... but at least if the code breaks because
         // we got stuck in a loop, we can return the user to where they left
         // off...
-        pfrm.write_save_data(
-            (byte*)&persistent_data_, sizeof persistent_data_, 0);
+        save::store(pfrm, persistent_data_);
     });
 }
 
@@ -223,6 +227,12 @@ HOT void Game::update(Platform& pfrm, Microseconds delta)
         {camera_.center().x + pfrm.screen().size().x / 2,
          camera_.center().y + pfrm.screen().size().y / 2});
 
+    // Transfers continue across state changes, e.g. while the next level
+    // loads.
+    if (pfrm.network_peer().is_connected()) {
+        data_stream::update(pfrm, delta);
+    }
+
     next_state_ = state_->update(pfrm, *this, delta);
 
     if (next_state_) {
@@ -309,37 +319,71 @@ HOT void Game::render(Platform& pfrm)
 
     Buffer<const Sprite*, 30> shadows_buffer;
 
-    auto show_sprite = [&](auto& e) {
-        if (within_view_frustum(pfrm.screen(), e.get_sprite().get_position())) {
-            using T = typename std::remove_reference<decltype(e)>::type;
+    // Whether an entity is on screen depends only on the view and on the
+    // entity's own position, so we cull all of the entity groups up front, one
+    // job per group, possibly across threads. The jobs only set each entity's
+    // visibility flag. The display lists are then built here, group by group,
+    // in the same order as before, so the draw order does not depend on how
+    // the jobs were scheduled.
+    auto cull = [&](auto& entity_buf) {
+        for (auto& e : entity_buf) {
+            e->mark_visible(within_view_frustum(
+                pfrm.screen(), e->get_sprite().get_position()));
+        }
+    };
 
-            if constexpr (T::has_shadow) {
-                if constexpr (T::multiface_shadow) {
-                    for (const auto& spr : e.get_shadow()) {
-                        shadows_buffer.push_back(spr);
-                    }
-                } else {
-                    shadows_buffer.push_back(&e.get_shadow());
-                }
-            }
+    GroupJobs<EffectGroup::buffer_count + EnemyGroup::buffer_count +
+                  DetailGroup::buffer_count,
+              decltype(cull)>
+        cull_jobs(cull);
+
+    auto push_cull_job = [&](auto& entity_buf) { cull_jobs.push(entity_buf); };
+    effects_.transform(push_cull_job);
+    enemies_.transform(push_cull_job);
+    details_.transform(push_cull_job);
+    cull_jobs.run(pfrm);
+
+    auto push_sprites = [&](auto& e) {
+        using T = typename std::remove_reference<decltype(e)>::type;
 
-            if constexpr (T::multiface_sprite) {
-                for (const auto& spr : e.get_sprites()) {
-                    display_buffer.push_back(spr);
+        if constexpr (T::has_shadow) {
+            if constexpr (T::multiface_shadow) {
+                for (const auto& spr : e.get_shadow()) {
+                    shadows_buffer.push_back(spr);
                 }
             } else {
-                display_buffer.push_back(&e.get_sprite());
+                shadows_buffer.push_back(&e.get_shadow());
             }
+        }
 
+        if constexpr (T::multiface_sprite) {
+            for (const auto& spr : e.get_sprites()) {
+                display_buffer.push_back(spr);
+            }
+        } else {
+            display_buffer.push_back(&e.get_sprite());
+        }
+    };
+
+    // For entities outside of the groups, which the jobs above did not cull.
+    auto show_sprite = [&](auto& e) {
+        if (within_view_frustum(pfrm.screen(), e.get_sprite().get_position())) {
+            push_sprites(e);
             e.mark_visible(true);
         } else {
             e.mark_visible(false);
         }
     };
 
+    auto show_culled = [&](auto& e) {
+        if (e.visible()) {
+            push_sprites(e);
+        }
+    };
+
     auto show_sprites = [&](auto& entity_buf) {
         for (auto it = entity_buf.begin(); it not_eq entity_buf.end(); ++it) {
-            show_sprite(**it);
+            show_culled(**it);
         }
     };
 
@@ -359,7 +403,7 @@ HOT void Game::render(Platform& pfrm)
                 if (e->is_backdrop()) {
                     // defer rendering...
                 } else {
-                    show_sprite(*e);
+                    show_culled(*e);
                 }
             }
         }
@@ -401,13 +445,13 @@ HOT void Game::render(Platform& pfrm)
 
     for (auto& e : effects_.get<DynamicEffect>()) {
         if (e->is_backdrop()) {
-            show_sprite(*e);
+            show_culled(*e);
         }
     }
 
     for (auto& e : effects_.get<StaticEffect>()) {
         if (e->is_backdrop()) {
-            show_sprite(*e);
+            show_culled(*e);
         }
     }
 
@@ -431,45 +475,122 @@ HOT void Game::render(Platform& pfrm)
 }
 
 
-static void cell_automata_advance(TileMap& map, TileMap& maptemp)
+// The cellular automaton runs on a packed bitboard, with one row of the map per
+// word. Bit x + 1 of a row is set when the tile at column x is empty. We set
+// the padding bits on either side, and use fully set rows above and below the
+// map, because TileMap::get_tile() reports out-of-bounds coordinates as empty.
+using CellRow = u32;
+
+static constexpr CellRow cell_row_mask = ((1 << TileMap::width) - 1) << 1;
+static constexpr CellRow cell_row_padding = ~cell_row_mask;
+
+static_assert(TileMap::width + 2 <= sizeof(CellRow) * 8);
+
+
+// At the start, whether each tile is filled or unfilled is completely
+// random. Each step of the automaton causes tiles to appear/disappear based on
+// how many empty neighbors each tile has, which ultimately causes tiles to
+// coalesce into blobs. An empty tile fills in if it has fewer than cdr(thresh)
+// empty neighbors, and a filled tile empties if it has more than car(thresh).
+static void cell_automata_run(TileMap& map, int iters)
 {
+    if (iters <= 0) {
+        return;
+    }
+
     auto& thresh = lisp::get_var("cell-thresh")->expect<lisp::Cons>();
+    const int fill_below = thresh.cdr()->integer().value_;
+    const int clear_above = thresh.car()->integer().value_;
+
+    // Rows zero and height + 1 hold the border.
+    CellRow rows[TileMap::height + 2];
+    CellRow next[TileMap::height + 2];
 
-    // At the start, whether each tile is filled or unfilled is completely
-    // random. The cell_automata_advance function causes each tile to
-    // appear/disappear based on how many neighbors that tile has, which
-    // ultimately causes tiles to coalesce into blobs.
-    map.for_each([&](const u8& tile, int x, int y) {
-        uint8_t count = 0;
-        auto collect = [&](int x, int y) {
+    rows[0] = next[0] = ~CellRow(0);
+    rows[TileMap::height + 1] = next[TileMap::height + 1] = ~CellRow(0);
+
+    for (int y = 0; y < TileMap::height; ++y) {
+        CellRow row = cell_row_padding;
+        for (int x = 0; x < TileMap::width; ++x) {
             if (map.get_tile(x, y) == Tile::none) {
-                count++;
-            }
-        };
-        collect(x - 1, y - 1);
-        collect(x + 1, y - 1);
-        collect(x - 1, y + 1);
-        collect(x + 1, y + 1);
-        collect(x - 1, y);
-        collect(x + 1, y);
-        collect(x, y - 1);
-        collect(x, y + 1);
-        if (tile == Tile::none) {
-            if (count < thresh.cdr()->integer().value_) {
-                maptemp.set_tile(x, y, Tile::plate);
-            } else {
-                maptemp.set_tile(x, y, Tile::none);
+                row |= 1 << (x + 1);
             }
-        } else {
-            if (count > thresh.car()->integer().value_) {
-                maptemp.set_tile(x, y, Tile::none);
-            } else {
-                maptemp.set_tile(x, y, Tile::plate);
+        }
+        rows[y + 1] = row;
+    }
+
+    for (int i = 0; i < iters; ++i) {
+        for (int y = 1; y <= TileMap::height; ++y) {
+            const CellRow above = rows[y - 1];
+            const CellRow center = rows[y];
+            const CellRow below = rows[y + 1];
+
+            const CellRow n[8] = {above << 1,
+                                  above,
+                                  above >> 1,
+                                  center << 1,
+                                  center >> 1,
+                                  below << 1,
+                                  below,
+                                  below >> 1};
+
+            // Sum the eight neighbor bits of each column in parallel, with a
+            // tree of adders, into a four bit count (b3 b2 b1 b0).
+            auto add = [](CellRow a, CellRow b, CellRow c, CellRow& carry) {
+                carry = (a & b) | (c & (a ^ b));
+                return a ^ b ^ c;
+            };
+
+            CellRow c0, c1, c2;
+            const CellRow s0 = add(n[0], n[1], n[2], c0);
+            const CellRow s1 = add(n[3], n[4], n[5], c1);
+            const CellRow s2 = n[6] ^ n[7];
+            c2 = n[6] & n[7];
+
+            // Ones: s0 + s1 + s2.
+            CellRow twos_a;
+            const CellRow b0 = add(s0, s1, s2, twos_a);
+
+            // Twos: c0 + c1 + c2 + twos_a.
+            CellRow fours_a, fours_b;
+            const CellRow t = add(c0, c1, c2, fours_a);
+            const CellRow b1 = t ^ twos_a;
+            fours_b = t & twos_a;
+
+            // Fours and eights.
+            const CellRow b2 = fours_a ^ fours_b;
+            const CellRow b3 = fours_a & fours_b;
+
+            CellRow fill = 0;
+            CellRow clear = 0;
+
+            for (int count = 0; count <= 8; ++count) {
+                const CellRow eq = (count & 1 ? b0 : ~b0) &
+                                   (count & 2 ? b1 : ~b1) &
+                                   (count & 4 ? b2 : ~b2) &
+                                   (count & 8 ? b3 : ~b3);
+                if (count < fill_below) {
+                    fill |= eq;
+                }
+                if (count > clear_above) {
+                    clear |= eq;
+                }
             }
+
+            const CellRow empty = (center & ~fill) | (~center & clear);
+
+            next[y] = (empty & cell_row_mask) | cell_row_padding;
         }
-    });
-    maptemp.for_each(
-        [&](const u8& tile, int x, int y) { map.set_tile(x, y, tile); });
+
+        std::copy(std::begin(next), std::end(next), rows);
+    }
+
+    for (int y = 0; y < TileMap::height; ++y) {
+        for (int x = 0; x < TileMap::width; ++x) {
+            const bool empty = rows[y + 1] & (1 << (x + 1));
+            map.set_tile(x, y, empty ? Tile::none : Tile::plate);
+        }
+    }
 }
 
 
@@ -945,31 +1066,110 @@ bool operator==(const ZoneInfo& lhs, const ZoneInfo& rhs)
 }
 
 
-static bool contains(lisp::Value* tiles_list, u8 t)
-{
-    while (tiles_list not_eq L_NIL) {
-        if (tiles_list->type() not_eq lisp::Value::Type::cons) {
-            while (true)
-                ; // TODO: raise error...
-        }
+// The level scripts sort tiles into classes, by listing tile indices in the
+// wall-tiles-list and edge-tiles-list variables. Map generation classifies
+// every tile several times over, so rather than walking the lists each time,
+// we compile them into lookup tables, indexed by tile. We rebuild the tables
+// only when a script binds a different list to one of the variables. A list
+// stays alive while a variable refers to it, so a new list never shares an
+// address with the one that we compiled.
+namespace {
+class TileClasses {
+public:
+    bool is_wall(u8 t) const
+    {
+        return wall_[t];
+    }
+
+    bool is_edge(u8 t) const
+    {
+        return not wall_[t] and edge_[t];
+    }
 
-        if (tiles_list->cons().car()->type() not_eq lisp::Value::Type::integer) {
-            while (true)
-                ; // TODO: raise error
+    bool is_center(u8 t) const
+    {
+        return not wall_[t] and not edge_[t];
+    }
+
+    void update(Platform& pfrm)
+    {
+        auto wall_tiles = lisp::get_var("wall-tiles-list");
+        auto edge_tiles = lisp::get_var("edge-tiles-list");
+
+        if (wall_tiles not_eq wall_src_) {
+            compile(pfrm, wall_, wall_tiles);
+            wall_src_ = wall_tiles;
         }
 
-        if (static_cast<int>(t) == tiles_list->cons().car()->integer().value_) {
-            return true;
+        if (edge_tiles not_eq edge_src_) {
+            compile(pfrm, edge_, edge_tiles);
+            edge_src_ = edge_tiles;
         }
+    }
+
+private:
+    using Table = Bitvector<256>;
+
+    static void compile(Platform& pfrm, Table& table, lisp::Value* tiles_list)
+    {
+        table.clear();
+
+        while (tiles_list not_eq L_NIL) {
+            if (tiles_list->type() not_eq lisp::Value::Type::cons or
+                tiles_list->cons().car()->type() not_eq
+                    lisp::Value::Type::integer) {
+                pfrm.fatal("tile class lists must contain integers");
+            }
+
+            const auto t = tiles_list->cons().car()->integer().value_;
+            if (t >= 0 and t < int(table.size())) {
+                table.set(t, true);
+            }
 
-        tiles_list = tiles_list->cons().cdr();
+            tiles_list = tiles_list->cons().cdr();
+        }
     }
 
-    return false;
+    Table wall_;
+    Table edge_;
+
+    lisp::Value* wall_src_ = nullptr;
+    lisp::Value* edge_src_ = nullptr;
+};
+} // namespace
+
+
+static const TileClasses& tile_classes(Platform& pfrm)
+{
+    static TileClasses classes;
+    classes.update(pfrm);
+    return classes;
+}
+
+
+static const char* level_spritesheet(Game& game)
+{
+    if (auto boss_level = get_boss_level(game.level())) {
+        return boss_level->spritesheet_;
+    } else if (game.level() == 0) {
+        return "spritesheet_intro_cutscene";
+    } else {
+        return current_zone(game).spritesheet_name_;
+    }
 }
 
 
 COLD void Game::next_level(Platform& pfrm, std::optional<Level> set_level)
+{
+    begin_next_level(pfrm, set_level);
+
+    while (not generate_level(pfrm))
+        ;
+}
+
+
+COLD void Game::begin_next_level(Platform& pfrm,
+                                 std::optional<Level> set_level)
 {
     // Turn off rumble. Otherwise, if rumble happened to be active, the game
     // would continue rumbling until the next update() call, which could take a
@@ -987,6 +1187,9 @@ COLD void Game::next_level(Platform& pfrm, std::optional<Level> set_level)
     }
 
     Entity::reset_ids();
+    // Entity ids restart from zero in the next level, so the old reference
+    // positions for multiplayer replication are meaningless.
+    replication::reset();
     // These few entities are sort of a special case. All other entities are
     // erased during level transition, but the player and transporter are
     // persistent, and therefore, should be excluded from the id reset.
@@ -999,6 +1202,75 @@ COLD void Game::next_level(Platform& pfrm, std::optional<Level> set_level)
     persistent_data_.inventory_ = inventory_;
     persistent_data_.store_powerups(powerups_);
 
+    // Give the platform a head start on decoding the level's textures, while
+    // the zone title is still up.
+    pfrm.prefetch_texture(current_zone(*this).tileset0_name_);
+    pfrm.prefetch_texture(current_zone(*this).tileset1_name_);
+    pfrm.prefetch_texture(level_spritesheet(*this));
+
+    levelgen_stage_ = LevelGenStage::load;
+}
+
+
+// Runs one stage of level generation per call, so that the caller's state can
+// keep animating between stages.
+COLD bool Game::generate_level(Platform& pfrm)
+{
+    switch (levelgen_stage_) {
+    case LevelGenStage::none:
+        return true;
+
+    case LevelGenStage::load:
+        load_level_resources(pfrm);
+        levelgen_stage_ = LevelGenStage::seed_map;
+        break;
+
+    case LevelGenStage::seed_map:
+        seed_map(pfrm);
+        levelgen_stage_ = LevelGenStage::carve_map;
+        break;
+
+    case LevelGenStage::carve_map:
+        carve_map(pfrm);
+        levelgen_stage_ = LevelGenStage::place_scavenger;
+        break;
+
+    case LevelGenStage::place_scavenger:
+        place_scavenger(pfrm);
+        levelgen_stage_ = LevelGenStage::decorate_map;
+        break;
+
+    case LevelGenStage::decorate_map:
+        decorate_map(pfrm);
+        levelgen_stage_ = LevelGenStage::respawn_entities;
+        break;
+
+    case LevelGenStage::respawn_entities:
+        if (respawn_entities(pfrm)) {
+            levelgen_stage_ = LevelGenStage::draw_map;
+        } else {
+            warning(pfrm, "Map is too small, regenerating...");
+            levelgen_stage_ = LevelGenStage::seed_map;
+        }
+        break;
+
+    case LevelGenStage::draw_map:
+        draw_map(pfrm);
+        levelgen_stage_ = LevelGenStage::finish;
+        break;
+
+    case LevelGenStage::finish:
+        finish_level(pfrm);
+        levelgen_stage_ = LevelGenStage::none;
+        return true;
+    }
+
+    return false;
+}
+
+
+COLD void Game::load_level_resources(Platform& pfrm)
+{
     lisp::dostring(pfrm.load_file_contents("scripts", "pre_levelgen.lisp"),
                    [&pfrm](lisp::Value& err) {
                        lisp::DefaultPrinter p;
@@ -1009,33 +1281,26 @@ COLD void Game::next_level(Platform& pfrm, std::optional<Level> set_level)
     pfrm.load_tile0_texture(current_zone(*this).tileset0_name_);
     pfrm.load_tile1_texture(current_zone(*this).tileset1_name_);
 
-    auto boss_level = get_boss_level(level());
-    if (boss_level) {
+    if (get_boss_level(level())) {
         pfrm.speaker().stop_music();
-        pfrm.load_sprite_texture(boss_level->spritesheet_);
-
-    } else {
-        if (level() == 0) {
-            pfrm.load_sprite_texture("spritesheet_intro_cutscene");
-        } else {
-            pfrm.load_sprite_texture(current_zone(*this).spritesheet_name_);
-        }
     }
 
-RETRY:
-    Game::regenerate_map(pfrm);
+    pfrm.load_sprite_texture(level_spritesheet(*this));
+}
 
-    if (not Game::respawn_entities(pfrm)) {
-        warning(pfrm, "Map is too small, regenerating...");
-        goto RETRY;
-    }
 
+COLD void Game::draw_map(Platform& pfrm)
+{
     tiles_.for_each([&](u8 t, s8 x, s8 y) {
         pfrm.set_tile(Layer::map_0, x, y, static_cast<s16>(t));
     });
 
     current_zone(*this).generate_background_(pfrm, *this);
+}
+
 
+COLD void Game::finish_level(Platform& pfrm)
+{
     lisp::dostring(pfrm.load_file_contents("scripts", "post_levelgen.lisp"),
                    [&pfrm](lisp::Value& err) {
                        lisp::DefaultPrinter p;
@@ -1048,12 +1313,11 @@ RETRY:
     // all of the enumerations. At this point, we've already pushed the tilemap
     // to the platform for rendering, so we can simplify to just the data that
     // we absolutely need.
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
+    auto& classes = tile_classes(pfrm);
 
     tiles_.for_each([&](u8& tile, int, int) {
-        if (not contains(wall_tiles, tile)) {
-            if (contains(edge_tiles, tile)) {
+        if (not classes.is_wall(tile)) {
+            if (classes.is_edge(tile)) {
                 tile = Tile::plate;
             } else {
                 tile = Tile::sand;
@@ -1067,54 +1331,157 @@ RETRY:
     const auto ssize = pfrm.screen().size();
     camera_.set_position(
         pfrm, {player_pos.x - ssize.x / 2, player_pos.y - float(ssize.y)});
+
+    desync::record(pfrm, *this);
 }
 
 
-COLD static u32
-flood_fill(Platform& pfrm, TileMap& map, u8 replace, TIdx x, TIdx y)
+// Span-based flood fill. Rather than pushing each tile onto a stack, we fill
+// whole horizontal runs of matching tiles, and push each run, so that we can
+// look for matching tiles in the rows above and below it. A run is filled as
+// soon as we find it, so each run enters the stack at most once.
+COLD static u32 flood_fill(TileMap& map, u8 replace, TIdx x, TIdx y)
 {
-    using Coord = Vec2<s8>;
-
-    ScratchBufferBulkAllocator mem(pfrm);
-
-    auto stack = mem.alloc<Buffer<Coord, TileMap::width * TileMap::height>>();
+    const u8 target = map.get_tile(x, y);
 
-    if (UNLIKELY(not stack)) {
-        pfrm.fatal("fatal error in floodfill");
+    if (target == replace) {
+        return 0;
     }
 
-    const u8 target = map.get_tile(x, y);
+    struct Span {
+        TIdx y_;
+        TIdx begin_;
+        TIdx end_;
+    };
+
+    // There can be at most one run for every other tile in a row.
+    Buffer<Span, (TileMap::width + 1) / 2 * TileMap::height> stack;
 
     u32 count = 0;
 
-    const auto action = [&](const Coord& c, TIdx x_off, TIdx y_off) {
-        const TIdx x = c.x + x_off;
-        const TIdx y = c.y + y_off;
-        if (x > 0 and x < TileMap::width and y > 0 and y < TileMap::height) {
-            if (map.get_tile(x, y) == target) {
-                map.set_tile(x, y, replace);
-                stack->push_back({x, y});
-                count += 1;
-            }
+    const auto fill_run = [&](TIdx x, TIdx y) {
+        TIdx begin = x;
+        TIdx end = x;
+        while (begin > 0 and map.get_tile(begin - 1, y) == target) {
+            --begin;
+        }
+        while (end < TileMap::width - 1 and map.get_tile(end + 1, y) == target) {
+            ++end;
+        }
+        for (TIdx i = begin; i <= end; ++i) {
+            map.set_tile(i, y, replace);
         }
+        count += end - begin + 1;
+        stack.push_back({y, begin, end});
+        return end;
     };
 
-    action({x, y}, 0, 0);
+    fill_run(x, y);
 
-    while (not stack->empty()) {
-        Coord c = stack->back();
-        stack->pop_back();
-        action(c, -1, 0);
-        action(c, 0, 1);
-        action(c, 0, -1);
-        action(c, 1, 0);
+    while (not stack.empty()) {
+        const Span span = stack.back();
+        stack.pop_back();
+
+        for (int dy : {-1, 1}) {
+            const TIdx y = span.y_ + dy;
+            if (y < 0 or y >= TileMap::height) {
+                continue;
+            }
+            for (TIdx x = span.begin_; x <= span.end_; ++x) {
+                if (map.get_tile(x, y) == target) {
+                    x = fill_run(x, y);
+                }
+            }
+        }
     }
 
     return count;
 }
 
 
-COLD void Game::seed_map(Platform& pfrm, TileMap& workspace)
+// Labels the connected components of non-empty tiles in a single pass over the
+// map, and returns the location of a tile in the largest component (the first
+// one found, in case of a tie). We need only the labels of the previous row,
+// and a union-find table to record which labels belong to the same
+// component. Returns nothing if the map is empty.
+COLD static std::optional<Vec2<TIdx>> largest_component(const TileMap& map)
+{
+    using Label = u8;
+
+    // There can be at most one new label for every other tile in a row.
+    static constexpr int max_labels =
+        (TileMap::width + 1) / 2 * TileMap::height + 1;
+
+    static_assert(max_labels <= std::numeric_limits<Label>::max() + 1);
+
+    Label parent[max_labels];
+    u16 size[max_labels];
+    Vec2<TIdx> origin[max_labels];
+
+    Label next_label = 1;
+
+    const auto find = [&](Label l) {
+        while (parent[l] not_eq l) {
+            l = parent[l] = parent[parent[l]];
+        }
+        return l;
+    };
+
+    Label above[TileMap::width] = {};
+    Label current[TileMap::width];
+
+    for (TIdx y = 0; y < TileMap::height; ++y) {
+        for (TIdx x = 0; x < TileMap::width; ++x) {
+            if (map.get_tile(x, y) == Tile::none) {
+                current[x] = 0;
+                continue;
+            }
+
+            const Label left = x > 0 ? current[x - 1] : 0;
+            const Label up = above[x];
+
+            Label root;
+            if (left and up) {
+                root = find(left);
+                Label other = find(up);
+                if (other not_eq root) {
+                    if (other < root) {
+                        std::swap(root, other);
+                    }
+                    parent[other] = root;
+                    size[root] += size[other];
+                }
+            } else if (left or up) {
+                root = find(left ? left : up);
+            } else {
+                root = next_label++;
+                parent[root] = root;
+                size[root] = 0;
+                origin[root] = {x, y};
+            }
+
+            ++size[root];
+            current[x] = root;
+        }
+
+        std::copy(std::begin(current), std::end(current), above);
+    }
+
+    std::optional<Vec2<TIdx>> result;
+    u16 largest = 0;
+
+    for (Label l = 1; l < next_label; ++l) {
+        if (parent[l] == l and size[l] > largest) {
+            largest = size[l];
+            result = origin[l];
+        }
+    }
+
+    return result;
+}
+
+
+COLD void Game::seed_map(Platform& pfrm)
 {
     if (auto l = get_boss_level(level())) {
         for (int x = 0; x < TileMap::width; ++x) {
@@ -1158,9 +1525,7 @@ COLD void Game::seed_map(Platform& pfrm, TileMap& workspace)
                 }
             });
 
-            for (int i = 0; i < cell_iters; ++i) {
-                cell_automata_advance(tiles_, workspace);
-            }
+            cell_automata_run(tiles_, cell_iters);
 
             tiles_.for_each([&count](u8 t, int, int) {
                 if (t) {
@@ -1173,21 +1538,6 @@ COLD void Game::seed_map(Platform& pfrm, TileMap& workspace)
 }
 
 
-static bool
-is_center_tile(lisp::Value* wall_tiles_list, lisp::Value* edge_tiles_list, u8 t)
-{
-    return not contains(wall_tiles_list, t) and
-           not contains(edge_tiles_list, t);
-}
-
-
-static bool
-is_edge_tile(lisp::Value* wall_tiles_list, lisp::Value* edge_tiles_list, u8 t)
-{
-    return not contains(wall_tiles_list, t) and contains(edge_tiles_list, t);
-}
-
-
 static void add_map_decorations(Level level,
                                 Platform& pfrm,
                                 const TileMap& map,
@@ -1204,13 +1554,12 @@ static void add_map_decorations(Level level,
         return false;
     };
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
+    auto& classes = tile_classes(pfrm);
 
     grass_overlay.for_each([&](u8 t, s8 x, s8 y) {
         pfrm.set_tile(Layer::map_1, x, y, t);
         if (t == Tile::none) {
-            if (is_center_tile(wall_tiles, edge_tiles, map.get_tile(x, y))) {
+            if (classes.is_center(map.get_tile(x, y))) {
                 if (not adjacent_decor(x, y)) {
                     pfrm.set_tile(
                         Layer::map_1,
@@ -1254,7 +1603,8 @@ static bool special_map(Level level)
 }
 
 
-COLD void Game::regenerate_map(Platform& pfrm)
+// Trims the seeded map down to the part that the player can reach.
+COLD void Game::carve_map(Platform& pfrm)
 {
     ScratchBufferBulkAllocator mem(pfrm);
 
@@ -1263,7 +1613,6 @@ COLD void Game::regenerate_map(Platform& pfrm)
         pfrm.fatal("failed to create temporary tilemap");
     }
 
-    seed_map(pfrm, *temporary);
     // debug_log_tilemap(pfrm, tiles_);
 
     // Remove tiles from edges of the map. Some platforms,
@@ -1277,13 +1626,12 @@ COLD void Game::regenerate_map(Platform& pfrm)
         }
     });
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
+    auto& classes = tile_classes(pfrm);
 
     // Create a mask of the tileset by filling the temporary tileset
     // with all walkable tiles from the tilemap.
     tiles_.for_each([&](const u8& tile, TIdx x, TIdx y) {
-        if (not contains(wall_tiles, tile)) {
+        if (not classes.is_wall(tile)) {
             temporary->set_tile(x, y, 1);
         } else {
             temporary->set_tile(x, y, 0);
@@ -1291,25 +1639,22 @@ COLD void Game::regenerate_map(Platform& pfrm)
     });
 
     if (not special_map(level()) and not is_boss_level(level())) {
-        // Pick a random filled tile, and flood-fill around that tile in
-        // the map, to produce a single connected component.
-        while (true) {
-            const auto x = rng::choice(TileMap::width, rng::critical_state);
-            const auto y = rng::choice(TileMap::height, rng::critical_state);
-            if (temporary->get_tile(x, y) not_eq Tile::none) {
-                flood_fill(pfrm, *temporary, 2, x, y);
-                temporary->for_each([&](const u8& tile, TIdx x, TIdx y) {
-                    if (tile not_eq 2) {
-                        tiles_.set_tile(x, y, Tile::none);
-                    }
-                });
-                break;
-            } else {
-                continue;
-            }
+        // Keep only the largest connected component of the map, so that the
+        // player can reach every part of the level.
+        if (auto origin = largest_component(*temporary)) {
+            flood_fill(*temporary, 2, origin->x, origin->y);
+            temporary->for_each([&](const u8& tile, TIdx x, TIdx y) {
+                if (tile not_eq 2) {
+                    tiles_.set_tile(x, y, Tile::none);
+                }
+            });
         }
     }
+}
 
+
+COLD void Game::place_scavenger(Platform& pfrm)
+{
     scavenger_.reset();
 
     const bool place_scavenger =
@@ -1422,6 +1767,14 @@ COLD void Game::regenerate_map(Platform& pfrm)
             ++tries;
         }
     }
+}
+
+
+// Picks the final tiles for the map, and generates the grass and decorations in
+// the map_1 layer.
+COLD void Game::decorate_map(Platform& pfrm)
+{
+    ScratchBufferBulkAllocator mem(pfrm);
 
     auto grass_overlay = mem.alloc<TileMap>([&](u8& t, int, int) {
         if (level() > boss_0_level) {
@@ -1439,11 +1792,11 @@ COLD void Game::regenerate_map(Platform& pfrm)
         pfrm.fatal("failed to alloc map1 workspace");
     }
 
+    auto& classes = tile_classes(pfrm);
+
     const auto cell_iters = lisp::get_var("cell-iters")->integer().value_;
 
-    for (int i = 0; i < cell_iters; ++i) {
-        cell_automata_advance(*grass_overlay, *temporary);
-    }
+    cell_automata_run(*grass_overlay, cell_iters);
 
     // debug_log_tilemap(pfrm, *grass_overlay);
 
@@ -1632,13 +1985,13 @@ COLD void Game::regenerate_map(Platform& pfrm)
             const auto down = tiles_.get_tile(x, y - 1);
             const auto left = tiles_.get_tile(x - 1, y);
             const auto right = tiles_.get_tile(x + 1, y);
-            if (tile == 0 and not contains(wall_tiles, left) and
+            if (tile == 0 and not classes.is_wall(left) and
                 (up == 0 or up == 18 or down == 0 or down == 18) and
                 (tiles_.get_tile(x - 2, y) == 0 or
                  tiles_.get_tile(x - 2, y) == 19)) {
                 tiles_.set_tile(x, y, 18);
             }
-            if (tile == 0 and not contains(wall_tiles, right) and
+            if (tile == 0 and not classes.is_wall(right) and
                 (up == 0 or up == 19 or down == 0 or down == 19) and
                 (tiles_.get_tile(x + 2, y) == 0 or
                  tiles_.get_tile(x + 2, y) == 18)) {
@@ -1666,8 +2019,8 @@ COLD void Game::regenerate_map(Platform& pfrm)
 
     if (zone_info(level()) == zone_3) {
         tiles_.for_each([&](u8& tile, int x, int y) {
-            if (contains(wall_tiles, tile)) {
-                if (not contains(wall_tiles, tiles_.get_tile(x, y + 1))) {
+            if (classes.is_wall(tile)) {
+                if (not classes.is_wall(tiles_.get_tile(x, y + 1))) {
                     grass_overlay->set_tile(x, y, 17);
                 }
             }
@@ -1683,39 +2036,35 @@ COLD void Game::regenerate_map(Platform& pfrm)
             if (tile == Tile::plate and
                 grass_overlay->get_tile(x, y) == Tile::none) {
 
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x + 1, y)) and
-                    not contains(wall_tiles, up) and
-                    not contains(wall_tiles, down) and
-                    not(is_center_tile(wall_tiles, edge_tiles, up) and
-                        is_center_tile(wall_tiles, edge_tiles, down))) {
+                if (classes.is_center(tiles_.get_tile(x + 1, y)) and
+                    not classes.is_wall(up) and
+                    not classes.is_wall(down) and
+                    not(classes.is_center(up) and
+                        classes.is_center(down))) {
 
                     tiles_.set_tile(x, y, Tile::plate_left);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x - 1, y)) and
-                    not contains(wall_tiles, up) and
-                    not contains(wall_tiles, down) and
-                    not(is_center_tile(wall_tiles, edge_tiles, up) and
-                        is_center_tile(wall_tiles, edge_tiles, down))) {
+                if (classes.is_center(tiles_.get_tile(x - 1, y)) and
+                    not classes.is_wall(up) and
+                    not classes.is_wall(down) and
+                    not(classes.is_center(up) and
+                        classes.is_center(down))) {
 
                     tiles_.set_tile(x, y, Tile::plate_right);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x, y + 1)) and
-                    not contains(wall_tiles, right) and
-                    not contains(wall_tiles, left) and
-                    not(is_center_tile(wall_tiles, edge_tiles, left) and
-                        is_center_tile(wall_tiles, edge_tiles, right))) {
+                if (classes.is_center(tiles_.get_tile(x, y + 1)) and
+                    not classes.is_wall(right) and
+                    not classes.is_wall(left) and
+                    not(classes.is_center(left) and
+                        classes.is_center(right))) {
 
                     tiles_.set_tile(x, y, Tile::plate_top);
                 }
-                if (is_center_tile(
-                        wall_tiles, edge_tiles, tiles_.get_tile(x, y - 1)) and
-                    not contains(wall_tiles, right) and
-                    not contains(wall_tiles, left) and
-                    not(is_center_tile(wall_tiles, edge_tiles, left) and
-                        is_center_tile(wall_tiles, edge_tiles, right))) {
+                if (classes.is_center(tiles_.get_tile(x, y - 1)) and
+                    not classes.is_wall(right) and
+                    not classes.is_wall(left) and
+                    not(classes.is_center(left) and
+                        classes.is_center(right))) {
 
                     tiles_.set_tile(x, y, Tile::plate_bottom);
                 }
@@ -1761,14 +2110,13 @@ COLD void Game::regenerate_map(Platform& pfrm)
 }
 
 
-COLD static MapCoordBuf get_free_map_slots(const TileMap& map)
+COLD static MapCoordBuf get_free_map_slots(const TileMap& map,
+                                           const TileClasses& classes)
 {
     MapCoordBuf output;
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-
     map.for_each([&](const u8& tile, TIdx x, TIdx y) {
-        if (not contains(wall_tiles, tile)) {
+        if (not classes.is_wall(tile)) {
             output.push_back({x, y});
         }
     });
@@ -1841,8 +2189,7 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                                    }()),
                                    free_spots.size() / 25);
 
-        auto wall_tiles = lisp::get_var("wall-tiles-list");
-        auto edge_tiles = lisp::get_var("edge-tiles-list");
+        auto& classes = tile_classes(pfrm);
 
         for (int i = 0; i < count and free_spots.size() > 0; ++i) {
             if (rng::choice<2>(rng::critical_state)) {
@@ -1862,11 +2209,11 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                     int edge_count = 0;
                     auto detect_edge = [&](int x, int y) {
                         auto tile = game.tiles().get_tile(x, y);
-                        if (is_edge_tile(wall_tiles, edge_tiles, tile)) {
+                        if (classes.is_edge(tile)) {
                             ++edge_count;
                         }
                     };
-                    if (not is_edge_tile(wall_tiles, edge_tiles, t)) {
+                    if (not classes.is_edge(t)) {
                         detect_edge(x - 1, y);
                         detect_edge(x + 1, y);
                         detect_edge(x, y - 1);
@@ -1890,7 +2237,7 @@ spawn_compactors(Platform& pfrm, Game& game, MapCoordBuf& free_spots)
                         rng::choice<TileMap::height>(rng::critical_state);
 
                     const auto t = game.tiles().get_tile(x, y);
-                    if (is_edge_tile(wall_tiles, edge_tiles, t)) {
+                    if (classes.is_edge(t)) {
                         const auto wc = to_world_coord(Vec2<TIdx>{x, y});
                         game.enemies().spawn<Compactor>(wc);
                     }
@@ -2197,8 +2544,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
 {
     auto clear_entities = [&](auto& buf) { buf.clear(); };
 
-    auto wall_tiles = lisp::get_var("wall-tiles-list");
-    auto edge_tiles = lisp::get_var("edge-tiles-list");
+    auto& classes = tile_classes(pfrm);
 
     enemies_.transform(clear_entities);
     details_.transform(clear_entities);
@@ -2277,7 +2623,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
         return true;
     }
 
-    auto free_spots = get_free_map_slots(tiles_);
+    auto free_spots = get_free_map_slots(tiles_, classes);
 
     // Because the scavenger sits in a specially generated secluded part of the
     // map, Game::respawn_entities() is not responsible for creating the
@@ -2405,7 +2751,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
             const s8 x = rng::choice<TileMap::width>(rng::critical_state);
             const s8 y = rng::choice<TileMap::height>(rng::critical_state);
 
-            if (is_edge_tile(wall_tiles, edge_tiles, tiles_.get_tile(x, y))) {
+            if (classes.is_edge(tiles_.get_tile(x, y))) {
 
                 auto wc = to_world_coord({x, y});
                 wc.x += 16;
@@ -2446,11 +2792,11 @@ COLD bool Game::respawn_entities(Platform& pfrm)
     // there's no sand nearby, and no items eiher, potentially place
     // an item.
     tiles_.for_each([&](u8 t, s8 x, s8 y) {
-        if (is_edge_tile(wall_tiles, edge_tiles, t)) {
+        if (classes.is_edge(t)) {
             for (int i = x - 1; i < x + 2; ++i) {
                 for (int j = y - 1; j < y + 2; ++j) {
                     const auto curr = tiles_.get_tile(i, j);
-                    if (is_center_tile(wall_tiles, edge_tiles, curr)) {
+                    if (classes.is_center(curr)) {
                         return;
                     }
                 }
@@ -2493,7 +2839,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
     // For map locations with nothing nearby, potentially place an item or
     // something
     tiles_.for_each([&](u8 t, s8 x, s8 y) {
-        if (is_center_tile(wall_tiles, edge_tiles, t)) {
+        if (classes.is_center(t)) {
             const auto pos = to_world_coord({x, y});
 
             bool entity_nearby = false;
@@ -2521,9 +2867,7 @@ COLD bool Game::respawn_entities(Platform& pfrm)
                 int adj_sand_tiles = 0;
                 for (int i = x - 1; i < x + 1; ++i) {
                     for (int j = y - 1; j < y + 1; ++j) {
-                        if (is_center_tile(wall_tiles,
-                                           edge_tiles,
-                                           tiles_.get_tile(i, j))) {
+                        if (classes.is_center(tiles_.get_tile(i, j))) {
                             adj_sand_tiles++;
                         }
                     }
@@ -2653,6 +2997,9 @@ void safe_disconnect(Platform& pfrm)
     }
 
     pfrm.network_peer().disconnect();
+
+    data_stream::reset();
+    replication::reset();
 }
 
 
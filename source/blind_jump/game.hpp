@@ -155,8 +155,20 @@ public:
 
     void rumble(Platform& pfrm, Microseconds duration);
 
+    // Generates the next level all at once.
     void next_level(Platform& platform, std::optional<Level> set_level = {});
 
+    // Level generation takes a while, so states may instead spread the work
+    // across several frames, while the screen is faded out: call
+    // begin_next_level(), and then call generate_level() once per update,
+    // until it returns true. The result does not depend on how the work is
+    // spread out, as long as nothing else draws from rng::critical_state in
+    // the meantime.
+    void begin_next_level(Platform& platform,
+                          std::optional<Level> set_level = {});
+
+    bool generate_level(Platform& platform);
+
     Level level() const
     {
         return persistent_data_.level_.get();
@@ -253,8 +265,26 @@ private:
 
     Buffer<std::pair<DeferredCallback, Microseconds>, 10> deferred_callbacks_;
 
-    void seed_map(Platform& platform, TileMap& workspace);
-    void regenerate_map(Platform& platform);
+    enum class LevelGenStage : u8 {
+        none,
+        load,
+        seed_map,
+        carve_map,
+        place_scavenger,
+        decorate_map,
+        respawn_entities,
+        draw_map,
+        finish,
+    } levelgen_stage_ = LevelGenStage::none;
+
+    void load_level_resources(Platform& platform);
+    void draw_map(Platform& platform);
+    void finish_level(Platform& platform);
+
+    void seed_map(Platform& platform);
+    void carve_map(Platform& platform);
+    void place_scavenger(Platform& platform);
+    void decorate_map(Platform& platform);
     bool respawn_entities(Platform& platform);
 
     void update_transitions(Platform& pf, Microseconds dt);
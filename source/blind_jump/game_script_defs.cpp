@@ -1,4 +1,5 @@
 #include "game.hpp"
+#include "profiler.hpp"
 #include "script/lisp.hpp"
 
 
@@ -499,6 +500,13 @@ void Game::init_script(Platform& pfrm)
                       return L_NIL;
                   }));
 
+    lisp::set_var("profile", lisp::make_function([](int argc) {
+                      if (auto pfrm = interp_get_pfrm()) {
+                          profiler::dump(*pfrm);
+                      }
+                      return L_NIL;
+                  }));
+
     lisp::set_var(
         "pattern-replace-tile", lisp::make_function([](int argc) {
             L_EXPECT_ARGC(argc, 2);
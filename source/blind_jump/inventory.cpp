@@ -44,11 +44,11 @@ void Inventory::push_item(Platform& pfrm,
 
                     NotificationStr str;
 
-                    str += locale_string(pfrm, LocaleString::got_item_before)
-                               ->c_str();
+                    str += locale_string_view(pfrm,
+                                              LocaleString::got_item_before);
                     str += description;
-                    str += locale_string(pfrm, LocaleString::got_item_after)
-                               ->c_str();
+                    str += locale_string_view(pfrm,
+                                              LocaleString::got_item_after);
 
                     push_notification(pfrm, game.state(), str);
                 }
@@ -59,7 +59,7 @@ void Inventory::push_item(Platform& pfrm,
 
     if (notify) {
         NotificationStr str;
-        str += locale_string(pfrm, LocaleString::inventory_full)->c_str();
+        str += locale_string_view(pfrm, LocaleString::inventory_full);
 
         push_notification(pfrm, game.state(), str);
     }
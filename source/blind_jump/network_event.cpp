@@ -1,12 +1,33 @@
 #include "network_event.hpp"
+#include "data_stream.hpp"
 #include "platform/platform.hpp"
+#include "profiler.hpp"
 
 
 namespace net_event {
 
 
+static TransmitHook transmit_hook;
+
+
+void set_transmit_hook(TransmitHook hook)
+{
+    transmit_hook = hook;
+}
+
+
+void run_transmit_hook(Platform& pfrm)
+{
+    if (transmit_hook) {
+        transmit_hook(pfrm);
+    }
+}
+
+
 void poll_messages(Platform& pfrm, Game& game, Listener& listener)
 {
+    profiler::Scope scope(pfrm, profiler::Marker::network_poll);
+
     while (auto message = pfrm.network_peer().poll_message()) {
         if (message->length_ < sizeof(Header)) {
             return;
@@ -32,6 +53,21 @@ void poll_messages(Platform& pfrm, Game& game, Listener& listener)
         continue;                                                              \
     }
 
+// Bulk data transfers proceed in the background, regardless of which state
+// happens to be polling for messages.
+#define HANDLE_STREAM_MESSAGE(MESSAGE_TYPE)                                    \
+    case MESSAGE_TYPE::mt: {                                                   \
+        NET_EVENT_SIZE_CHECK(MESSAGE_TYPE)                                     \
+        if (message->length_ < sizeof(MESSAGE_TYPE)) {                         \
+            return;                                                            \
+        }                                                                      \
+        MESSAGE_TYPE m;                                                        \
+        memcpy(&m, message->data_, sizeof m);                                  \
+        pfrm.network_peer().poll_consume(sizeof(MESSAGE_TYPE));                \
+        data_stream::receive(pfrm, m);                                         \
+        continue;                                                              \
+    }
+
             HANDLE_MESSAGE(EnemyStateSync)
             HANDLE_MESSAGE(PlayerEnteredGate)
             HANDLE_MESSAGE(PlayerHealthChanged)
@@ -46,15 +82,17 @@ void poll_messages(Platform& pfrm, Game& game, Listener& listener)
             HANDLE_MESSAGE(QuickChat)
             HANDLE_MESSAGE(PlayerSpawnLaser)
             HANDLE_MESSAGE(PlayerDied)
-            HANDLE_MESSAGE(DataStreamAvail)
-            HANDLE_MESSAGE(DataStreamReadResponse)
-            HANDLE_MESSAGE(DataStreamReadRequest)
-            HANDLE_MESSAGE(DataStreamDoneReading)
+            HANDLE_STREAM_MESSAGE(DataStreamAvail)
+            HANDLE_STREAM_MESSAGE(DataStreamChunk)
+            HANDLE_STREAM_MESSAGE(DataStreamAck)
+            HANDLE_STREAM_MESSAGE(DataStreamDone)
             HANDLE_MESSAGE(ProgramVersion)
             HANDLE_MESSAGE(LethargyActivated)
             HANDLE_MESSAGE(Disconnect)
             HANDLE_MESSAGE(HealthTransfer)
             HANDLE_MESSAGE(BossSwapTarget)
+            HANDLE_MESSAGE(EnemySnapshot)
+            HANDLE_MESSAGE(StateHash)
         }
 
         error(pfrm, "garbled message!?");
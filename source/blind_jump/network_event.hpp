@@ -34,13 +34,15 @@ struct Header {
         item_chest_opened,
         item_chest_shared,
         data_stream_avail,
-        data_stream_read_request,
-        data_stream_read_response,
-        data_stream_done_reading,
+        data_stream_chunk,
+        data_stream_ack,
+        data_stream_done,
         quick_chat,
         lethargy_activated,
         disconnect,
         boss_swap_target,
+        enemy_snapshot,
+        state_hash,
     } message_type_;
 };
 static_assert(sizeof(Header) == 1);
@@ -333,50 +335,60 @@ struct NewLevelIdle {
 };
 
 
-// Currently unused, reserved for future use.
+// Bulk data transfer messages. See data_stream.hpp.
+
+
+// Announces a new stream. The receiver should respond with a DataStreamAck (or
+// a DataStreamDone, to reject the stream).
 struct DataStreamAvail {
     Header header_;
-    host_u16 stream_id_;
+    u8 stream_id_;
     host_u32 stream_length_;
+    host_u32 crc_;
 
-    u8 unused_[5];
+    u8 unused_[2];
 
     static const auto mt = Header::MessageType::data_stream_avail;
 };
 
 
-// Currently unused, reserved for future use.
-struct DataStreamReadRequest {
+struct DataStreamChunk {
     Header header_;
-    host_u16 stream_id_;
-    host_u32 stream_index_;
-    u8 request_id_;
+    u8 stream_id_;
+    host_u16 sequence_;
 
-    u8 unused_[4];
+    static const int data_size = 8;
+    u8 data_[data_size];
 
-    static const auto mt = Header::MessageType::data_stream_read_request;
+    static const auto mt = Header::MessageType::data_stream_chunk;
 };
 
 
-// Currently unused, reserved for future use.
-struct DataStreamReadResponse {
+// Selective acknowledgement. All chunks prior to next_expected_ arrived, along
+// with chunk next_expected_ + 1 + i, for each set bit i in received_mask_.
+struct DataStreamAck {
     Header header_;
-    u8 request_id_;
+    u8 stream_id_;
+    host_u16 next_expected_;
+    host_u32 received_mask_;
 
-    u8 data_[10];
+    u8 unused_[4];
 
-    static const auto mt = Header::MessageType::data_stream_read_response;
+    static const auto mt = Header::MessageType::data_stream_ack;
 };
 
 
-// Currently unused, reserved for future use.
-struct DataStreamDoneReading {
+struct DataStreamDone {
     Header header_;
-    host_u16 stream_id_;
+    u8 stream_id_;
+
+    enum Status : u8 { success = 1, checksum_mismatch, rejected };
+
+    Status status_;
 
     u8 unused_[9];
 
-    static const auto mt = Header::MessageType::data_stream_done_reading;
+    static const auto mt = Header::MessageType::data_stream_done;
 };
 
 
@@ -419,10 +431,66 @@ struct BossSwapTarget {
 };
 
 
+// Batched, delta-compressed enemy updates. See replication.hpp.
+struct EnemySnapshot {
+    Header header_;
+    u8 count_;
+
+    struct Entry {
+        host_u16 id_;
+
+        // For state updates, the enemy's state, and the change in position
+        // since the last update for the enemy, in pixels. For health updates,
+        // kind_health, and the new health value.
+        u8 kind_;
+        u8 payload_[2];
+    };
+
+    static const u8 kind_health = 0x80;
+
+    static const int max_entries = 2;
+
+    Entry entries_[max_entries];
+
+    static const auto mt = Header::MessageType::enemy_snapshot;
+};
+
+
+// Hashes of the state that both peers should agree upon, sampled at a given
+// frame of the level, for detecting desyncs. See desync.hpp.
+struct StateHash {
+    Header header_;
+    u8 level_;
+    u8 sample_;
+
+    host_u16 rng_;
+    host_u16 entity_ids_;
+    host_u16 enemies_;
+    host_u16 details_;
+
+    // The map doesn't change after level generation, so a smaller hash will
+    // do, and leaves room for the sample number.
+    u8 map_;
+
+    static const auto mt = Header::MessageType::state_hash;
+};
+NET_EVENT_SIZE_CHECK(StateHash)
+
+
+// Called by transmit() before sending anything, so that a module that queues
+// up messages of its own (see replication.hpp) can send them first, and the
+// peer receives everything in the order that the game produced it.
+using TransmitHook = void (*)(Platform&);
+void set_transmit_hook(TransmitHook hook);
+void run_transmit_hook(Platform& pfrm);
+
+
 template <typename T> void transmit(Platform& pfrm, T& message)
 {
     static_assert(sizeof(T) <= Platform::NetworkPeer::max_message_size);
 
+    run_transmit_hook(pfrm);
+
     message.header_.message_type_ = T::mt;
 
     // Most of the time, should only be one iteration...
@@ -466,28 +534,22 @@ public:
     virtual void receive(const EnemyStateSync&, Platform&, Game&)
     {
     }
-    virtual void receive(const ItemTaken&, Platform&, Game&)
+    virtual void receive(const EnemySnapshot&, Platform&, Game&)
     {
     }
-    virtual void receive(const ItemChestOpened&, Platform&, Game&)
+    virtual void receive(const StateHash&, Platform&, Game&)
     {
     }
-    virtual void receive(const ItemChestShared&, Platform&, Game&)
-    {
-    }
-    virtual void receive(const QuickChat&, Platform&, Game&)
-    {
-    }
-    virtual void receive(const DataStreamAvail&, Platform&, Game&)
+    virtual void receive(const ItemTaken&, Platform&, Game&)
     {
     }
-    virtual void receive(const DataStreamReadRequest&, Platform&, Game&)
+    virtual void receive(const ItemChestOpened&, Platform&, Game&)
     {
     }
-    virtual void receive(const DataStreamReadResponse&, Platform&, Game&)
+    virtual void receive(const ItemChestShared&, Platform&, Game&)
     {
     }
-    virtual void receive(const DataStreamDoneReading&, Platform&, Game&)
+    virtual void receive(const QuickChat&, Platform&, Game&)
     {
     }
     virtual void receive(const PlayerSpawnLaser&, Platform&, Game&)
@@ -26,27 +26,23 @@ class Platform;
 // Additionally, you should be using the fixed width datatypes for everything,
 // i.e. s32 instead of a plain int.
 //
-// The game more-or-less memcpy's the contents of the PersistentData structure
-// to the save data target device (whether that be a file on disk, or GBA sram),
-// so we need to be careful about anything that might vary across different
-// compilers, processors, etc.
+// The game copies each field of the PersistentData structure to the save data
+// target device (whether that be a file on disk, or GBA sram) more-or-less
+// verbatim, so we need to be careful about anything that might vary across
+// different compilers, processors, etc.
 //
-// Remember that we're using a binary format here! If you change the structure
-// of the PersistentData struct, the game may try to incorrectly read existing
-// save data files belonging to users who upgraded from an old version of the
-// game. So, when you make any changes whatsoever to the layout of the
-// PersistentData class, remember to increment the schema_version constant.
+// See saveSchema.hpp for the save encoding. When you add a field, give it a tag
+// there. Adding, removing, or resizing fields does not require any other
+// changes. But if you change the meaning of an existing field's contents,
+// increment the schema_version constant, and add a migration, so that players
+// who upgrade from an old version of the game keep their save data.
 
 
 struct PersistentData {
-    using Magic = u32;
-
-    static constexpr u32 schema_version = 9;
-    static constexpr Magic magic_val = 0xCA55E77E + schema_version;
+    static constexpr u32 schema_version = 10;
 
     PersistentData()
     {
-        magic_.set(magic_val);
         seed_.set(11001);
         level_.set(0);
         score_.set(0);
@@ -59,7 +55,6 @@ struct PersistentData {
         powerup_count_.set(0);
     }
 
-    HostInteger<Magic> magic_;
     HostInteger<u32> seed_;
     HostInteger<Level> level_;
     HostInteger<Score> score_;
@@ -0,0 +1,305 @@
+#include "replication.hpp"
+#include "memory/buffer.hpp"
+
+
+namespace replication {
+
+
+// After this many delta updates for the same enemy, send a full update, in case
+// the peers' reference positions went out of sync (e.g. due to a dropped
+// message).
+static const u8 max_deltas = 8;
+
+
+namespace {
+struct Reference {
+    Entity::Id id_;
+    s16 x_;
+    s16 y_;
+    u8 deltas_;
+};
+
+
+// The sender and receiver must evict entries in the same order, so we replace
+// entries round-robin, rather than by some heuristic that depends on local
+// state.
+class ReferenceTable {
+public:
+    Reference* find(Entity::Id id)
+    {
+        for (auto& ref : refs_) {
+            if (ref.id_ == id) {
+                return &ref;
+            }
+        }
+        return nullptr;
+    }
+
+    Reference& insert(Entity::Id id, s16 x, s16 y)
+    {
+        if (auto existing = find(id)) {
+            *existing = {id, x, y, 0};
+            return *existing;
+        }
+
+        if (not refs_.full()) {
+            refs_.push_back({id, x, y, 0});
+            return refs_.back();
+        }
+
+        auto& ref = refs_[next_evict_];
+        next_evict_ = (next_evict_ + 1) % refs_.capacity();
+        ref = {id, x, y, 0};
+        return ref;
+    }
+
+    void clear()
+    {
+        refs_.clear();
+        next_evict_ = 0;
+    }
+
+private:
+    Buffer<Reference, 32> refs_;
+    u32 next_evict_ = 0;
+};
+} // namespace
+
+
+static ReferenceTable sent;
+static ReferenceTable received;
+
+
+static Buffer<net_event::EnemySnapshot::Entry, 16> outbox;
+
+
+static const Microseconds min_send_interval = seconds(1) / 20;
+static const Microseconds max_send_interval = seconds(1) / 4;
+
+static Microseconds current_send_interval = min_send_interval;
+static Microseconds stats_timer;
+static Platform::NetworkPeer::Stats stats;
+
+
+static bool fits_s8(int value)
+{
+    return value >= -128 and value <= 127;
+}
+
+
+static void enqueue_entry(Platform& pfrm,
+                          const net_event::EnemySnapshot::Entry& entry)
+{
+    if (outbox.full()) {
+        flush(pfrm);
+    }
+
+    // Have net_event::transmit() send our queued updates ahead of any other
+    // message.
+    if (outbox.empty()) {
+        net_event::set_transmit_hook(flush);
+    }
+
+    outbox.push_back(entry);
+}
+
+
+void enqueue(Platform& pfrm, const net_event::EnemyStateSync& s)
+{
+    if (not pfrm.network_peer().is_connected()) {
+        return;
+    }
+
+    const auto id = s.id_.get();
+    const auto x = s.x_.get();
+    const auto y = s.y_.get();
+
+    auto ref = sent.find(id);
+
+    if (id > 0xffff or s.state_ >= net_event::EnemySnapshot::kind_health or
+        not ref or ref->deltas_ >= max_deltas or not fits_s8(x - ref->x_) or
+        not fits_s8(y - ref->y_)) {
+
+        sent.insert(id, x, y);
+
+        auto copy = s;
+        net_event::transmit(pfrm, copy);
+        return;
+    }
+
+    net_event::EnemySnapshot::Entry entry;
+    entry.id_.set(id);
+    entry.kind_ = s.state_;
+    entry.payload_[0] = static_cast<u8>(x - ref->x_);
+    entry.payload_[1] = static_cast<u8>(y - ref->y_);
+
+    ref->x_ = x;
+    ref->y_ = y;
+    ++ref->deltas_;
+
+    enqueue_entry(pfrm, entry);
+}
+
+
+void enqueue(Platform& pfrm, const net_event::EnemyHealthChanged& hc)
+{
+    if (not pfrm.network_peer().is_connected()) {
+        return;
+    }
+
+    const auto id = hc.id_.get();
+    const auto health = hc.new_health_.get();
+
+    if (id > 0xffff or health < 0 or health > 0xffff) {
+        auto copy = hc;
+        net_event::transmit(pfrm, copy);
+        return;
+    }
+
+    net_event::EnemySnapshot::Entry entry;
+    entry.id_.set(id);
+    entry.kind_ = net_event::EnemySnapshot::kind_health;
+    entry.payload_[0] = health & 0xff;
+    entry.payload_[1] = health >> 8;
+
+    enqueue_entry(pfrm, entry);
+}
+
+
+void flush(Platform& pfrm)
+{
+    using net_event::EnemySnapshot;
+
+    if (outbox.empty()) {
+        return;
+    }
+
+    // NOTE: transmit() calls us back, via its hook, so empty the outbox
+    // before sending.
+    const auto pending = outbox;
+    outbox.clear();
+
+    auto it = pending.begin();
+    while (it not_eq pending.end()) {
+        EnemySnapshot snapshot;
+        snapshot.count_ = 0;
+
+        while (it not_eq pending.end() and
+               snapshot.count_ < EnemySnapshot::max_entries) {
+            snapshot.entries_[snapshot.count_++] = *(it++);
+        }
+
+        for (int i = snapshot.count_; i < EnemySnapshot::max_entries; ++i) {
+            snapshot.entries_[i] = {};
+        }
+
+        net_event::transmit(pfrm, snapshot);
+    }
+}
+
+
+// Back off quickly when the link saturates or drops messages, and recover
+// slowly.
+static void adapt_send_rate(const Platform::NetworkPeer::Stats& s)
+{
+    const bool losing_messages = s.transmit_loss_ or s.receive_loss_;
+
+    if (s.link_saturation_ > 80 or losing_messages) {
+        current_send_interval =
+            std::min(current_send_interval * 2, max_send_interval);
+    } else if (s.link_saturation_ < 50) {
+        current_send_interval = std::max(
+            current_send_interval - seconds(1) / 60, min_send_interval);
+    }
+}
+
+
+void update(Platform& pfrm, Microseconds delta)
+{
+    flush(pfrm);
+
+    stats_timer += delta;
+    if (stats_timer >= seconds(1)) {
+        stats_timer -= seconds(1);
+
+        stats = pfrm.network_peer().stats();
+
+        adapt_send_rate(stats);
+    }
+}
+
+
+Microseconds send_interval()
+{
+    return current_send_interval;
+}
+
+
+const Platform::NetworkPeer::Stats& link_stats()
+{
+    return stats;
+}
+
+
+void observe(const net_event::EnemyStateSync& s)
+{
+    received.insert(s.id_.get(), s.x_.get(), s.y_.get());
+}
+
+
+void receive(Platform& pfrm,
+             Game& game,
+             const net_event::EnemySnapshot& snapshot,
+             net_event::Listener& listener)
+{
+    using net_event::EnemySnapshot;
+
+    // NOTE: Copy max_entries, std::min takes its arguments by reference, and
+    // the constant has no out-of-line definition.
+    const int count =
+        std::min(int(snapshot.count_), int(EnemySnapshot::max_entries));
+
+    for (int i = 0; i < count; ++i) {
+        auto& entry = snapshot.entries_[i];
+        const auto id = entry.id_.get();
+
+        if (entry.kind_ == EnemySnapshot::kind_health) {
+            net_event::EnemyHealthChanged hc;
+            hc.header_.message_type_ = net_event::EnemyHealthChanged::mt;
+            hc.id_.set(id);
+            hc.new_health_.set(entry.payload_[0] | (entry.payload_[1] << 8));
+            listener.receive(hc, pfrm, game);
+            continue;
+        }
+
+        auto ref = received.find(id);
+        if (not ref) {
+            // We missed the full update that established the reference
+            // position. Nothing we can do, the sender will send a full update
+            // again soon.
+            continue;
+        }
+
+        ref->x_ += static_cast<s8>(entry.payload_[0]);
+        ref->y_ += static_cast<s8>(entry.payload_[1]);
+
+        net_event::EnemyStateSync s;
+        s.header_.message_type_ = net_event::EnemyStateSync::mt;
+        s.state_ = entry.kind_;
+        s.x_.set(ref->x_);
+        s.y_.set(ref->y_);
+        s.id_.set(id);
+        listener.receive(s, pfrm, game);
+    }
+}
+
+
+void reset()
+{
+    sent.clear();
+    received.clear();
+    outbox.clear();
+}
+
+
+} // namespace replication
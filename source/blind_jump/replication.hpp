@@ -0,0 +1,70 @@
+#pragma once
+
+#include "network_event.hpp"
+
+
+class Game;
+
+
+// Bandwidth management for multiplayer games. Enemies used to transmit each
+// state change and health change as its own twelve byte message. Instead,
+// enemies now enqueue updates here, and once per frame, we pack the queued
+// updates into EnemySnapshot messages, two updates per message, with positions
+// encoded relative to the last position that we sent for the same enemy.
+//
+// Both peers keep a small table of reference positions, keyed by enemy
+// id. Updates that do not fit in a snapshot entry (no reference position, or
+// the enemy moved too far) go out as a full EnemyStateSync, as do periodic
+// refreshes, so that the peers' reference tables cannot drift apart for long if
+// a message goes missing.
+//
+// We also pace the periodic player and seed updates based on the link
+// statistics reported by the platform, backing off when the link saturates.
+
+
+namespace replication {
+
+
+void enqueue(Platform& pfrm, const net_event::EnemyStateSync& s);
+void enqueue(Platform& pfrm, const net_event::EnemyHealthChanged& hc);
+
+
+// Called once per frame by the multiplayer sync logic. Transmits queued
+// updates, samples link statistics, and adjusts the send rate.
+void update(Platform& pfrm, Microseconds delta);
+
+
+// How often the game should transmit periodic state (player info, rng seed).
+Microseconds send_interval();
+
+
+// NOTE: NetworkPeer::stats() resets its counters each time that you call it.
+// Use the copy sampled (once per second) by update() instead.
+const Platform::NetworkPeer::Stats& link_stats();
+
+
+// Transmit any queued updates right away. We register this as
+// net_event::transmit()'s hook, so that it runs before anything else gets sent,
+// and messages arrive in the order that the game produced them.
+void flush(Platform& pfrm);
+
+
+// Decode a received snapshot into the equivalent individual messages, and pass
+// them along to the listener.
+void receive(Platform& pfrm,
+             Game& game,
+             const net_event::EnemySnapshot& snapshot,
+             net_event::Listener& listener);
+
+
+// Receivers should call observe() for each full EnemyStateSync message, so that
+// subsequent deltas have the right reference position.
+void observe(const net_event::EnemyStateSync& s);
+
+
+// Forget all reference positions and queued updates, e.g. upon disconnect or
+// level transition. Both peers need to reset at the same time.
+void reset();
+
+
+} // namespace replication
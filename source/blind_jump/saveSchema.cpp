@@ -0,0 +1,227 @@
+#include "saveSchema.hpp"
+#include "platform/platform.hpp"
+#include <stddef.h>
+#include <string.h>
+
+
+namespace save {
+
+
+static const u32 magic = 0x56534A42;
+
+
+// Up until schema version 10, the game copied the PersistentData struct to
+// storage verbatim, with this magic number at the beginning.
+static const u32 legacy_magic = 0xCA55E77E + 9;
+static const u16 legacy_version = 9;
+
+
+namespace {
+struct Header {
+    HostInteger<u32> magic_;
+    HostInteger<u16> version_;
+    u8 field_count_;
+    u8 unused_;
+};
+
+
+struct IndexEntry {
+    u8 tag_;
+    u8 unused_;
+    HostInteger<u16> offset_;
+    HostInteger<u16> length_;
+};
+
+
+struct FieldInfo {
+    Field tag_;
+
+    // Location within the PersistentData struct.
+    u16 offset_;
+    u16 size_;
+
+    // Location within the verbatim struct written by schema version 9.
+    u16 legacy_offset_;
+    u16 legacy_size_;
+};
+} // namespace
+
+
+#define SAVE_FIELD(TAG, MEMBER, LEGACY_OFFSET, LEGACY_SIZE)                    \
+    FieldInfo                                                                  \
+    {                                                                          \
+        Field::TAG, offsetof(PersistentData, MEMBER),                          \
+            sizeof(PersistentData::MEMBER), LEGACY_OFFSET, LEGACY_SIZE         \
+    }
+
+
+static constexpr const FieldInfo field_table[] = {
+    SAVE_FIELD(seed, seed_, 4, 4),
+    SAVE_FIELD(level, level_, 8, 4),
+    SAVE_FIELD(score, score_, 12, 4),
+    SAVE_FIELD(player_health, player_health_, 16, 4),
+    SAVE_FIELD(highscores, highscores_, 20, 32),
+    SAVE_FIELD(inventory, inventory_, 52, 40),
+    SAVE_FIELD(powerups, powerups_, 92, 64),
+    SAVE_FIELD(powerup_count, powerup_count_, 156, 4),
+    SAVE_FIELD(settings, settings_, 160, 16),
+    SAVE_FIELD(timestamp, timestamp_, 176, 24),
+    SAVE_FIELD(speedrun_clock, speedrun_clock_, 200, 8),
+    SAVE_FIELD(displayed_health_warning, displayed_health_warning_, 208, 1),
+    SAVE_FIELD(clean, clean_, 209, 1)};
+
+
+static constexpr u32 field_count = sizeof field_table / sizeof field_table[0];
+
+
+static_assert(field_count == int(Field::count) - 1);
+
+
+static constexpr u32 encoded_size()
+{
+    u32 size = sizeof(Header) + field_count * sizeof(IndexEntry);
+    for (auto& f : field_table) {
+        size += f.size_;
+    }
+    return size;
+}
+
+
+static const FieldInfo* find_field(u8 tag)
+{
+    for (auto& f : field_table) {
+        if (u8(f.tag_) == tag) {
+            return &f;
+        }
+    }
+    return nullptr;
+}
+
+
+// Upgrades fields decoded from a save written by an older schema version. Each
+// case handles the changes introduced by the following version, and falls
+// through to the next one. Only the fields in the loaded set hold decoded
+// values.
+static void migrate(PersistentData& data, u16 version, FieldSet loaded)
+{
+    switch (version) {
+    case 9:
+        // Version 10 replaced the verbatim struct with the tagged encoding,
+        // but the fields themselves did not change.
+        [[fallthrough]];
+
+    case PersistentData::schema_version:
+        break;
+    }
+}
+
+
+bool store(Platform& pfrm, const PersistentData& data)
+{
+    u8 buffer[encoded_size()];
+
+    Header header;
+    header.magic_.set(magic);
+    header.version_.set(PersistentData::schema_version);
+    header.field_count_ = field_count;
+    header.unused_ = 0;
+    memcpy(buffer, &header, sizeof header);
+
+    u32 index_pos = sizeof header;
+    u32 field_pos = sizeof header + field_count * sizeof(IndexEntry);
+
+    for (auto& f : field_table) {
+        IndexEntry entry;
+        entry.tag_ = u8(f.tag_);
+        entry.unused_ = 0;
+        entry.offset_.set(field_pos);
+        entry.length_.set(f.size_);
+        memcpy(buffer + index_pos, &entry, sizeof entry);
+        index_pos += sizeof entry;
+
+        memcpy(buffer + field_pos, (const u8*)&data + f.offset_, f.size_);
+        field_pos += f.size_;
+    }
+
+    return pfrm.write_save_data(buffer, sizeof buffer, 0);
+}
+
+
+bool load(Platform& pfrm, PersistentData& data, FieldSet fields)
+{
+    Header header;
+    if (not pfrm.read_save_data(&header, sizeof header, 0)) {
+        return false;
+    }
+
+    // Decode into a copy, so that we leave the data untouched if the save
+    // turns out to be damaged.
+    PersistentData result = data;
+    FieldSet loaded = 0;
+
+    auto decode = [&](const FieldInfo& f, u32 offset, u32 length) {
+        if (not (fields & field_bit(f.tag_))) {
+            return true;
+        }
+
+        // If the stored field is shorter than the current one, the remaining
+        // bytes keep their default values. If longer, we drop the excess.
+        auto dest = (u8*)&result + f.offset_;
+        length = std::min(length, u32(f.size_));
+        if (not pfrm.read_save_data(dest, length, offset)) {
+            return false;
+        }
+
+        loaded |= field_bit(f.tag_);
+        return true;
+    };
+
+    u16 version;
+
+    if (header.magic_.get() == magic) {
+        version = header.version_.get();
+
+        if (version > PersistentData::schema_version) {
+            warning(pfrm, "save written by a newer version of the game");
+            return false;
+        }
+
+        for (u32 i = 0; i < header.field_count_; ++i) {
+            IndexEntry entry;
+            if (not pfrm.read_save_data(&entry,
+                                        sizeof entry,
+                                        sizeof header + i * sizeof entry)) {
+                return false;
+            }
+
+            // Skip fields that have since been removed.
+            if (auto f = find_field(entry.tag_)) {
+                if (not decode(*f, entry.offset_.get(), entry.length_.get())) {
+                    return false;
+                }
+            }
+        }
+
+    } else if (header.magic_.get() == legacy_magic) {
+        version = legacy_version;
+
+        for (auto& f : field_table) {
+            if (f.legacy_size_ and
+                not decode(f, f.legacy_offset_, f.legacy_size_)) {
+                return false;
+            }
+        }
+
+    } else {
+        return false;
+    }
+
+    migrate(result, version, loaded);
+
+    data = result;
+
+    return true;
+}
+
+
+} // namespace save
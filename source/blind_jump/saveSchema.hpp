@@ -0,0 +1,84 @@
+#pragma once
+
+#include "persistentData.hpp"
+
+
+// The encoding of PersistentData in the save storage. Rather than copying the
+// PersistentData struct verbatim, which ties the save format to the struct
+// layout, we store each field separately, identified by a tag:
+//
+//   header : magic u32, schema version u16, field count u8, unused u8
+//   index  : tag u8, unused u8, offset u16, length u16, for each field
+//   fields : the contents of each field, at the offsets listed in the index
+//
+// Loading looks fields up by tag, so adding, removing, reordering, or resizing
+// fields does not invalidate existing saves: fields missing from the save keep
+// their default values, and the loader ignores tags that it does not
+// recognize. Changes to what the contents of a field mean, on the other hand,
+// call for incrementing PersistentData::schema_version, and adding a case to
+// migrate() in saveSchema.cpp, which upgrades fields decoded from older
+// versions.
+//
+// Tags must never be reused for a different field.
+//
+// Callers may load a subset of the fields, and the loader reads only the
+// header, the index, and the requested fields from storage.
+
+
+namespace save {
+
+
+enum class Field : u8 {
+    seed = 1,
+    level,
+    score,
+    player_health,
+    highscores,
+    inventory,
+    powerups,
+    powerup_count,
+    settings,
+    timestamp,
+    speedrun_clock,
+    displayed_health_warning,
+    clean,
+    count
+};
+
+
+using FieldSet = u32;
+
+
+static_assert(int(Field::count) <= sizeof(FieldSet) * 8);
+
+
+constexpr FieldSet field_bit(Field f)
+{
+    return 1 << int(f);
+}
+
+
+// The fields that the game needs before reaching the title screen.
+constexpr FieldSet boot_fields =
+    field_bit(Field::level) | field_bit(Field::highscores) |
+    field_bit(Field::settings) | field_bit(Field::timestamp) |
+    field_bit(Field::displayed_health_warning) | field_bit(Field::clean);
+
+
+// The state of the run in progress.
+constexpr FieldSet run_fields =
+    field_bit(Field::seed) | field_bit(Field::score) |
+    field_bit(Field::player_health) | field_bit(Field::inventory) |
+    field_bit(Field::powerups) | field_bit(Field::powerup_count) |
+    field_bit(Field::speedrun_clock);
+
+
+bool store(Platform& pfrm, const PersistentData& data);
+
+
+// Decodes the requested fields from the save storage, leaving the remaining
+// fields untouched. Returns false if there's no valid save.
+bool load(Platform& pfrm, PersistentData& data, FieldSet fields);
+
+
+} // namespace save
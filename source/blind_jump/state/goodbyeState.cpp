@@ -12,8 +12,7 @@ void GoodbyeState::enter(Platform& pfrm, Game& game, State& prev_state)
     }
 
     game.persistent_data().clean_ = false;
-    pfrm.write_save_data(
-        &game.persistent_data(), sizeof game.persistent_data(), 0);
+    save::store(pfrm, game.persistent_data());
 
     rng::critical_state = game.persistent_data().seed_.get();
 
@@ -25,7 +24,7 @@ void GoodbyeState::enter(Platform& pfrm, Game& game, State& prev_state)
     const auto s_tiles = calc_screen_tiles(pfrm);
     text_.emplace(
         pfrm, OverlayCoord{1, u8(s_tiles.y - (bigfont ? 3 : 2))}, font_conf);
-    text_->append(locale_string(pfrm, LocaleString::goodbye_text)->c_str());
+    text_->append(locale_string_view(pfrm, LocaleString::goodbye_text));
 }
 
 
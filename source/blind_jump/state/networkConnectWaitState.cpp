@@ -55,6 +55,9 @@ void NetworkConnectWaitState::exit(Platform& pfrm,
 }
 
 
+static std::optional<bool> connection_result;
+
+
 StatePtr
 NetworkConnectWaitState::update(Platform& pfrm, Game& game, Microseconds delta)
 {
@@ -80,18 +83,42 @@ NetworkConnectWaitState::update(Platform& pfrm, Game& game, Microseconds delta)
     case Platform::NetworkPeer::internet: {
         // TODO: display some more interesting graphics, allow user to enter ip
         // address, display our ip address if we're the host.
-        if (pfrm.keyboard().down_transition(game.action1_key())) {
-            pfrm.network_peer().connect("127.0.0.1");
-            return state_pool().create<PauseScreenState>(false);
-        } else if (pfrm.keyboard().down_transition(game.action2_key())) {
-            pfrm.network_peer().listen();
+        if (waiting_) {
+            if (not connection_result) {
+                break;
+            }
 
-            net_event::SyncSeed s;
-            s.random_state_.set(rng::critical_state);
-            net_event::transmit(pfrm, s);
+            if (*connection_result and pfrm.network_peer().is_host()) {
+                net_event::SyncSeed s;
+                s.random_state_.set(rng::critical_state);
+                net_event::transmit(pfrm, s);
+            }
+
+            connection_result.reset();
 
             return state_pool().create<PauseScreenState>(false);
         }
+
+        const bool connect = pfrm.keyboard().down_transition(game.action1_key());
+        const bool listen = pfrm.keyboard().down_transition(game.action2_key());
+
+        if (connect or listen) {
+            // The connection attempt runs in the background, we'll hear back
+            // from the platform once it resolves.
+            connection_result.reset();
+            pfrm.network_peer().on_connection_change(
+                [](Platform&, bool connected) {
+                    connection_result = connected;
+                });
+
+            waiting_ = true;
+
+            if (connect) {
+                pfrm.network_peer().connect("127.0.0.1");
+            } else {
+                pfrm.network_peer().listen();
+            }
+        }
         break;
     }
     }
@@ -12,11 +12,21 @@ void NewLevelState::enter(Platform& pfrm, Game& game, State&)
     pfrm.load_overlay_texture("overlay");
 
     std::get<BlindJumpGlobalData>(globals()).visited_.clear();
+
+    // We generate the level in the background, one stage per frame, while
+    // displaying the zone title. The screen is faded out, and no game logic
+    // runs in this state, so nothing else touches the map or the critical rng
+    // state in the meantime.
+    game.begin_next_level(pfrm, next_level_);
 }
 
 
 StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
 {
+    if (not level_ready_) {
+        level_ready_ = game.generate_level(pfrm);
+    }
+
     auto zone = zone_info(next_level_);
     auto last_zone = zone_info(next_level_ - 1);
 
@@ -215,7 +225,11 @@ StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
             if (timer_ > seconds(1)) {
                 pfrm.sleep(80);
 
-                pfrm.speaker().play_music(zone.music_name_, zone.music_offset_);
+                // Boss levels start out silent.
+                if (not is_boss_level(next_level_)) {
+                    pfrm.speaker().play_music(zone.music_name_,
+                                              zone.music_offset_);
+                }
 
                 return state_pool().create<FadeInState>(game);
             }
@@ -225,7 +239,8 @@ StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
 
             if (timer_ > seconds(1)) {
 
-                if (not pfrm.speaker().is_music_playing(zone.music_name_)) {
+                if (not is_boss_level(next_level_) and
+                    not pfrm.speaker().is_music_playing(zone.music_name_)) {
                     pfrm.speaker().play_music(zone.music_name_,
                                               zone.music_offset_);
                 }
@@ -242,7 +257,10 @@ StatePtr NewLevelState::update(Platform& pfrm, Game& game, Microseconds delta)
 
 void NewLevelState::exit(Platform& pfrm, Game& game, State&)
 {
-    game.next_level(pfrm, next_level_);
+    // Finish whatever remains of the level generation.
+    while (not level_ready_) {
+        level_ready_ = game.generate_level(pfrm);
+    }
 
     // Because generating a level takes quite a bit of time (relative to a
     // normal game update step), and because we aren't really running any game
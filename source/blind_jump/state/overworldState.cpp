@@ -1,3 +1,6 @@
+#include "blind_jump/desync.hpp"
+#include "blind_jump/replication.hpp"
+#include "profiler.hpp"
 #include "script/lisp.hpp"
 #include "state_impl.hpp"
 
@@ -17,7 +20,10 @@ void OverworldState::exit(Platform& pfrm, Game&, State& next_state)
     network_tx_loss_text_.reset();
     network_rx_loss_text_.reset();
     link_saturation_text_.reset();
+    network_jitter_text_.reset();
     scratch_buf_avail_text_.reset();
+    profile_game_text_.reset();
+    profile_system_text_.reset();
 
     // In case we're in the middle of an entry/exit animation for the
     // notification bar.
@@ -97,11 +103,17 @@ void OverworldState::receive(const net_event::QuickChat& chat,
                              Platform& pfrm,
                              Game& game)
 {
+    // The message id comes from the other console, ignore anything that we
+    // don't have a string for.
+    if (chat.message_.get() >= u32(LocaleString::count)) {
+        return;
+    }
+
     NotificationStr str;
-    str += locale_string(pfrm, LocaleString::chat_chat)->c_str();
+    str += locale_string_view(pfrm, LocaleString::chat_chat);
 
-    str += locale_string(pfrm, static_cast<LocaleString>(chat.message_.get()))
-               ->c_str();
+    str += locale_string_view(pfrm,
+                              static_cast<LocaleString>(chat.message_.get()));
 
     push_notification(pfrm, game.state(), str);
 }
@@ -120,7 +132,7 @@ void OverworldState::receive(const net_event::PlayerHealthChanged& event,
     }
 
     NotificationStr str;
-    str += locale_string(pfrm, LocaleString::peer_health_changed)->c_str();
+    str += locale_string_view(pfrm, LocaleString::peer_health_changed);
 
     char buffer[20];
     locale_num2str(health, buffer, 10);
@@ -195,6 +207,8 @@ void OverworldState::receive(const net_event::EnemyStateSync& s,
                              Platform&,
                              Game& game)
 {
+    replication::observe(s);
+
     bool done = false;
 
     game.enemies().transform([&](auto& buf) {
@@ -212,6 +226,22 @@ void OverworldState::receive(const net_event::EnemyStateSync& s,
 }
 
 
+void OverworldState::receive(const net_event::EnemySnapshot& s,
+                             Platform& pfrm,
+                             Game& game)
+{
+    replication::receive(pfrm, game, s, *this);
+}
+
+
+void OverworldState::receive(const net_event::StateHash& h,
+                             Platform& pfrm,
+                             Game& game)
+{
+    desync::receive(pfrm, game, h);
+}
+
+
 void OverworldState::receive(const net_event::PlayerInfo& p,
                              Platform& pfrm,
                              Game& game)
@@ -283,24 +313,17 @@ void OverworldState::multiplayer_sync(Platform& pfrm,
 {
     // On the gameboy advance, we're dealing with a slow connection and
     // twenty-year-old technology, so, realistically, we can only transmit
-    // player data a few times per second. TODO: add methods for querying the
-    // uplink performance limits from the Platform class, rather than having
-    // various game-specific hacks here.
+    // player data a few times per second. The replication module paces the
+    // updates based on the link statistics reported by the platform, starting
+    // at twenty updates per second, and backing off if the link saturates.
+    replication::update(pfrm, delta);
+    desync::update(pfrm, game, delta);
 
-    // FIXME: I strongly suspect that this number can be increased without
-    // issues, but I'm waiting until I test on an actual device with a link
-    // cable.
-    //
-    // Note: These numbers seem to result in smooth enough performance on a
-    // physical GBA, so I will not increase the refresh rates per now. Three
-    // updates per second is fairly smooth with interpolation.
-    static const auto player_refresh_rate = seconds(1) / 20;
-
-    static auto update_counter = player_refresh_rate;
+    static auto update_counter = replication::send_interval();
 
     update_counter -= delta;
     if (update_counter <= 0) {
-        update_counter = player_refresh_rate;
+        update_counter = replication::send_interval();
 
         if (game.player().get_health() > 0) {
             transmit_player_info(pfrm, game);
@@ -367,6 +390,9 @@ void OverworldState::show_stats(Platform& pfrm, Game& game, Microseconds delta)
         network_tx_loss_text_.emplace(pfrm, OverlayCoord{1, 6});
         network_rx_loss_text_.emplace(pfrm, OverlayCoord{1, 7});
         scratch_buf_avail_text_.emplace(pfrm, OverlayCoord{1, 8});
+        profile_game_text_.emplace(pfrm, OverlayCoord{1, 9});
+        profile_system_text_.emplace(pfrm, OverlayCoord{1, 10});
+        network_jitter_text_.emplace(pfrm, OverlayCoord{1, 11});
 
         const auto colors =
             fps_frame_count_ < 55
@@ -378,7 +404,7 @@ void OverworldState::show_stats(Platform& pfrm, Game& game, Microseconds delta)
         fps_text_->append(" fps", colors);
         fps_frame_count_ = 0;
 
-        const auto net_stats = pfrm.network_peer().stats();
+        const auto& net_stats = replication::link_stats();
 
         const auto tx_loss_colors =
             net_stats.transmit_loss_ > 0
@@ -402,8 +428,37 @@ void OverworldState::show_stats(Platform& pfrm, Game& game, Microseconds delta)
         network_rx_loss_text_->append(" rl", rx_loss_colors);
         link_saturation_text_->append(net_stats.link_saturation_);
         link_saturation_text_->append(" lnsat");
+        if (game.peer()) {
+            // Milliseconds, smoothed arrival interval and jitter of the peer's
+            // player updates, and the resulting interpolation delay.
+            network_jitter_text_->append(game.peer()->arrival_interval() /
+                                         1000);
+            network_jitter_text_->append(" intv ");
+            network_jitter_text_->append(game.peer()->jitter() / 1000);
+            network_jitter_text_->append(" jit ");
+            network_jitter_text_->append(game.peer()->interpolation_delay() /
+                                         1000);
+            network_jitter_text_->append(" dly");
+        }
         scratch_buf_avail_text_->append(pfrm.scratch_buffers_remaining());
         scratch_buf_avail_text_->append(" sbr");
+
+        // Average microseconds per frame spent in each profiled subsystem. The
+        // remote console's (profile) command prints the worst case timings.
+        auto show_profile = [](Text& text, profiler::Marker m) {
+            text.append(profiler::marker_name(m));
+            text.append(" ");
+            text.append(profiler::average(m));
+            text.append(" ");
+        };
+
+        show_profile(*profile_game_text_, profiler::Marker::entity_update);
+        show_profile(*profile_game_text_, profiler::Marker::collision);
+        show_profile(*profile_game_text_, profiler::Marker::render);
+        show_profile(*profile_system_text_, profiler::Marker::vm_execute);
+        show_profile(*profile_system_text_, profiler::Marker::gc);
+        show_profile(*profile_system_text_, profiler::Marker::network_poll);
+        show_profile(*profile_system_text_, profiler::Marker::audio_isr);
     }
 }
 
@@ -447,6 +502,9 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
         network_tx_msg_text_.reset();
         network_tx_loss_text_.reset();
         network_rx_loss_text_.reset();
+        profile_game_text_.reset();
+        profile_system_text_.reset();
+        network_jitter_text_.reset();
 
         fps_frame_count_ = 0;
         fps_timer_ = 0;
@@ -454,20 +512,51 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
 
     Player& player = game.player();
 
+    // Entities that set parallel_update only write to themselves, so we update
+    // those groups last, one job per group, possibly across threads. Nothing in
+    // the effect and detail updates spawns into those groups, so this does the
+    // same work as updating every group in order. Removing dead entities
+    // touches the shared entity pools, and on_death() may have side effects, so
+    // that part still happens here, in order.
+    auto update_group = [&](auto& entity_buf) {
+        for (auto& e : entity_buf) {
+            e->update(pfrm, game, delta);
+        }
+    };
+
+    GroupJobs<Game::EffectGroup::buffer_count + Game::DetailGroup::buffer_count,
+              decltype(update_group)>
+        update_jobs(update_group);
+
     auto update_policy = [&](auto& entity_buf) {
+        using BufferType = std::remove_reference_t<decltype(entity_buf)>;
+        using VT = typename BufferType::ValueType::element_type;
+
         for (auto it = entity_buf.begin(); it not_eq entity_buf.end();) {
             if (not(*it)->alive()) {
                 (*it)->on_death(pfrm, game);
                 it = entity_buf.erase(it);
             } else {
-                (*it)->update(pfrm, game, delta);
+                if constexpr (not VT::parallel_update) {
+                    (*it)->update(pfrm, game, delta);
+                }
                 ++it;
             }
         }
+
+        if constexpr (VT::parallel_update) {
+            update_jobs.push(entity_buf);
+        }
     };
 
-    game.effects().transform(update_policy);
-    game.details().transform(update_policy);
+    {
+        profiler::Scope scope(pfrm, profiler::Marker::entity_update);
+
+        game.effects().transform(update_policy);
+        game.details().transform(update_policy);
+
+        update_jobs.run(pfrm);
+    }
 
     auto enemy_timestep = delta;
     if (get_powerup(game, Powerup::Type::lethargy)) {
@@ -530,42 +619,48 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
     bool enemies_remaining = false;
     bool enemies_destroyed = false;
     bool enemies_visible = false;
-    game.enemies().transform([&](auto& entity_buf) {
-        for (auto it = entity_buf.begin(); it not_eq entity_buf.end();) {
-            if (not(*it)->alive()) {
-                (*it)->on_death(pfrm, game);
-                it = entity_buf.erase(it);
-                game.rumble(pfrm, milliseconds(150));
-                enemies_destroyed = true;
-            } else {
-                enemies_remaining = true;
-
-                (*it)->update(pfrm, game, enemy_timestep);
-
-                if (camera_tracking_ and
-                    (pfrm.keyboard().pressed(game.action1_key()) or
-                     camera_snap_timer_ > 0)) {
-                    // NOTE: snake body segments do not make much sense to
-                    // center the camera on, so exclude them. Same for various
-                    // other enemies...
-                    using T = typename std::remove_reference<decltype(
-                        entity_buf)>::type;
-
-                    using VT = typename T::ValueType::element_type;
-
-                    if constexpr (not std::is_same<VT, SnakeBody>() and
-                                  not std::is_same<VT, SnakeHead>() and
-                                  not std::is_same<VT, GatekeeperShield>()) {
-                        if ((*it)->visible()) {
-                            enemies_visible = true;
-                            game.camera().push_ballast((*it)->get_position());
+    {
+        profiler::Scope scope(pfrm, profiler::Marker::entity_update);
+
+        game.enemies().transform([&](auto& entity_buf) {
+            for (auto it = entity_buf.begin(); it not_eq entity_buf.end();) {
+                if (not(*it)->alive()) {
+                    (*it)->on_death(pfrm, game);
+                    it = entity_buf.erase(it);
+                    game.rumble(pfrm, milliseconds(150));
+                    enemies_destroyed = true;
+                } else {
+                    enemies_remaining = true;
+
+                    (*it)->update(pfrm, game, enemy_timestep);
+
+                    if (camera_tracking_ and
+                        (pfrm.keyboard().pressed(game.action1_key()) or
+                         camera_snap_timer_ > 0)) {
+                        // NOTE: snake body segments do not make much sense
+                        // to center the camera on, so exclude them. Same for
+                        // various other enemies...
+                        using T = typename std::remove_reference<decltype(
+                            entity_buf)>::type;
+
+                        using VT = typename T::ValueType::element_type;
+
+                        if constexpr (not std::is_same<VT, SnakeBody>() and
+                                      not std::is_same<VT, SnakeHead>() and
+                                      not std::is_same<VT,
+                                                       GatekeeperShield>()) {
+                            if ((*it)->visible()) {
+                                enemies_visible = true;
+                                game.camera().push_ballast(
+                                    (*it)->get_position());
+                            }
                         }
                     }
+                    ++it;
                 }
-                ++it;
             }
-        }
-    });
+        });
+    }
 
     if (not enemies_visible) {
         camera_snap_timer_ = 0;
@@ -574,7 +669,7 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
     if (not enemies_remaining and enemies_destroyed) {
 
         NotificationStr str;
-        str += locale_string(pfrm, LocaleString::level_clear)->c_str();
+        str += locale_string_view(pfrm, LocaleString::level_clear);
 
         push_notification(pfrm, game.state(), str);
 
@@ -730,39 +825,45 @@ StatePtr OverworldState::update(Platform& pfrm, Game& game, Microseconds delta)
                          player.get_position());
 
 
-    check_collisions(pfrm, game, player, game.details().get<Item>());
-    check_collisions(pfrm, game, player, game.effects().get<OrbShot>());
-    check_collisions(
-        pfrm, game, player, game.effects().get<ConglomerateShot>());
+    {
+        profiler::Scope scope(pfrm, profiler::Marker::collision);
 
-    if (UNLIKELY(boss_level)) {
+        check_collisions(pfrm, game, player, game.details().get<Item>());
+        check_collisions(pfrm, game, player, game.effects().get<OrbShot>());
         check_collisions(
-            pfrm, game, player, game.effects().get<WandererBigLaser>());
-        check_collisions(
-            pfrm, game, player, game.effects().get<WandererSmallLaser>());
-    }
-
-    game.enemies().transform([&](auto& buf) {
-        using T = typename std::remove_reference<decltype(buf)>::type;
-        using VT = typename T::ValueType::element_type;
+            pfrm, game, player, game.effects().get<ConglomerateShot>());
 
-        if (pfrm.network_peer().is_connected()) {
-            check_collisions(pfrm, game, game.effects().get<PeerLaser>(), buf);
+        if (UNLIKELY(boss_level)) {
+            check_collisions(
+                pfrm, game, player, game.effects().get<WandererBigLaser>());
+            check_collisions(
+                pfrm, game, player, game.effects().get<WandererSmallLaser>());
         }
 
-        check_collisions(pfrm, game, game.effects().get<AlliedOrbShot>(), buf);
+        game.enemies().transform([&](auto& buf) {
+            using T = typename std::remove_reference<decltype(buf)>::type;
+            using VT = typename T::ValueType::element_type;
 
-        if constexpr (not std::is_same<Scarecrow, VT>() and
-                      not std::is_same<SnakeTail, VT>() and
-                      not std::is_same<Sinkhole, VT>() and
-                      not std::is_same<InfestedCore, VT>()) {
-            check_collisions(pfrm, game, player, buf);
-        }
+            if (pfrm.network_peer().is_connected()) {
+                check_collisions(
+                    pfrm, game, game.effects().get<PeerLaser>(), buf);
+            }
 
-        if constexpr (not std::is_same<Sinkhole, VT>()) {
-            check_collisions(pfrm, game, game.effects().get<Laser>(), buf);
-        }
-    });
+            check_collisions(
+                pfrm, game, game.effects().get<AlliedOrbShot>(), buf);
+
+            if constexpr (not std::is_same<Scarecrow, VT>() and
+                          not std::is_same<SnakeTail, VT>() and
+                          not std::is_same<Sinkhole, VT>() and
+                          not std::is_same<InfestedCore, VT>()) {
+                check_collisions(pfrm, game, player, buf);
+            }
+
+            if constexpr (not std::is_same<Sinkhole, VT>()) {
+                check_collisions(pfrm, game, game.effects().get<Laser>(), buf);
+            }
+        });
+    }
 
     if (bosses_were_remaining and not bosses_remaining()) {
         game.effects().transform([](auto& buf) { buf.clear(); });
@@ -101,7 +101,7 @@ void PauseScreenState::repaint_text(Platform& pfrm, Game& game)
             font_conf);
 
         if (strs_[i] == LocaleString::menu_connect_peer) {
-            texts_.back().assign(locale_string(pfrm, strs_[i])->c_str(),
+            texts_.back().assign(locale_string_view(pfrm, strs_[i]),
                                  [&]() -> Text::OptColors {
                                      if (connect_peer_option_available(game)) {
                                          return std::nullopt;
@@ -112,7 +112,7 @@ void PauseScreenState::repaint_text(Platform& pfrm, Game& game)
                                      }
                                  }());
         } else {
-            texts_.back().assign(locale_string(pfrm, strs_[i])->c_str());
+            texts_.back().assign(locale_string_view(pfrm, strs_[i]));
         }
     }
 }
@@ -2,6 +2,7 @@
 
 #include "blind_jump/game.hpp"
 #include "blind_jump/network_event.hpp"
+#include "blind_jump/saveSchema.hpp"
 #include "bulkAllocator.hpp"
 #include "graphics/overlay.hpp"
 #include "path.hpp"
@@ -83,6 +84,8 @@ public:
     void receive(const net_event::PlayerSpawnLaser&, Platform&, Game&) override;
     void receive(const net_event::ItemChestShared&, Platform&, Game&) override;
     void receive(const net_event::EnemyStateSync&, Platform&, Game&) override;
+    void receive(const net_event::EnemySnapshot&, Platform&, Game&) override;
+    void receive(const net_event::StateHash&, Platform&, Game&) override;
     void receive(const net_event::SyncSeed&, Platform&, Game&) override;
     void receive(const net_event::PlayerInfo&, Platform&, Game&) override;
     void
@@ -119,7 +122,10 @@ private:
     std::optional<Text> network_tx_loss_text_;
     std::optional<Text> network_rx_loss_text_;
     std::optional<Text> link_saturation_text_;
+    std::optional<Text> network_jitter_text_;
     std::optional<Text> scratch_buf_avail_text_;
+    std::optional<Text> profile_game_text_;
+    std::optional<Text> profile_system_text_;
     std::optional<Text> time_remaining_text_;
     std::optional<SmallIcon> time_remaining_icon_;
     int idle_rx_count_ = 0;
@@ -762,6 +768,7 @@ private:
     Microseconds timer_;
     OverlayCoord pos_;
     Level next_level_;
+    bool level_ready_ = false;
 };
 
 
@@ -1356,6 +1363,7 @@ public:
 
 private:
     bool ready_ = false;
+    bool waiting_ = false;
 };
 
 
@@ -6,8 +6,8 @@
 @	ending_scene_2_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2192 = 2704
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,86 @@
 
 	.section .rodata
 	.align	2
-	.global ending_scene_2_flattenedTiles		@ 13472 unsigned chars
+	.global ending_scene_2_flattenedTiles		@ 2192 unsigned chars
 	.hidden ending_scene_2_flattenedTiles
 ending_scene_2_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBB4444,0xBBBB4444
-	.word 0xBBBBBB44,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444444BB,0x4444BBBB,0x44BBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0xBB888B44
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444BBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55544444,0x55554444,0x55555444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444555,0x44445555,0x44455555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBBB4444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB444444,0x8BB44444,0x88844444,0x8B8B4444,0x8B88B444,0x88888444,0x88888B44,0x88888B44
-	.word 0x88888888,0xB8888888,0xBBB88888,0xBBBBB88B,0xBBBBBB88,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444BBBBB,0x44BBBBBB,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0xBB44444B,0xBBB4444B,0xBBBB444B,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x88844444,0xBB888844,0xBBBBB888,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44444BBB,0x444BBBBB,0x44BBBBBB,0x4BBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555444,0x55554444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBB44444,0xBBBB4444,0xBBBBB444,0xBBBBBB44,0xBBBBBB44,0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBB4
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xB8888BBB,0xB88B88BB,0xB88B8888,0xB88BBBB8,0xB88BBBBB,0xBBB88BBB,0xBBBB8BBB,0xBBBBB8BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x4444444B,0x444444BB,0x4444444B,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55544444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBBB444
-	.word 0x44444444,0x4444BBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBABBB,0xBBBBABBB,0xBBBBABBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44BBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4BBB4444,0xBBBBBB44
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBABBB,0xBBBAAABB,0xBBAAAABB,0xBBAAAAAB,0xBBAAAAAB,0xBBAAAAAB,0xBBBAAAAB,0xBBBAAAAB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x4444BBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0xBB4BBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x444BBB44,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBBBBB4
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBB4444,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xABBBBBBB,0xAABBBBBB,0xAABBBBBB
-	.word 0xBBBAAAAB,0xBBAAAAAB,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444BBB,0xBBBBBBBB,0x44444BBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0xB4444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAABBBBBB,0xAABBBBBB,0xAABBBBBB,0xAA444444,0xAA999999,0xAA999999,0xAA999999,0xAAA99999
-	.word 0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0x44AAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66669999,0x66666999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999666,0x99666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999996
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAA99999,0xAAA99999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99A99999,0x99A79999,0x99A79999,0x9A779999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x66666999,0x66666999,0x66666999,0x66669999,0x62899999,0x22229999,0x22222299,0x22222229
-	.word 0x66666666,0x66666666,0x66666666,0x96666666,0x99999966,0x99999992,0x99999222,0x99992222
-	.word 0x99666666,0x99966666,0x99999966,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x9A779999,0x9AA79999,0x9AA79999,0x9AA79999,0x9AA77999,0x9AA77999,0x9A777799,0x9A777779
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11199999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x29999999,0x29999999,0x22299999,0x22229999
-
-	.word 0x22222229,0x22222229,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x99922222,0x99922222,0x99922222,0x99922222,0x99922222,0x99222222,0x99222222,0x99222222
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xA9999999,0xAA999999,0xAA999999,0xAAA99999,0xAAA99999,0xAAAA9999,0xAAAA9999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0xA9999999,0x79999999,0x79999999,0xA9999999,0xA9999999,0x99999999,0x99999999
-	.word 0x9A777777,0x9A777777,0x9AA77777,0xAAAA7777,0xAAAA7777,0xAAAAA777,0xAAAAA777,0xAAAAA777
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999A,0x9999999A,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x19999999,0x11999999
-	.word 0x99999999,0x99999999,0x11999999,0x11119999,0x11111119,0x11111111,0x11111111,0x11111111
-	.word 0x11119999,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22211111,0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222221,0x22222231,0x22223331
-	.word 0x99222222,0x99222222,0x92222222,0x92222222,0x92222222,0x12222222,0x33222222,0x33322222
-
-	.word 0xC9999999,0xC9222299,0xC2222299,0xC2222229,0xC2222229,0x92222229,0x92222221,0x91222233
-	.word 0x9999999C,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x99999AAA,0x99999AAA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x7A999999,0x77A99999,0x777A9999,0x777A9999
-	.word 0xAAAAAA77,0xAAAAAA77,0xAAA7AA77,0xAAAA7A77,0xAAAA7777,0xAAAA7777,0xAAAA7777,0xAAAAAA77
-	.word 0x999999AA,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11199999,0x11119999,0x11111999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x11199999,0x11111111,0x11111111,0x11111111
-	.word 0x11999999,0x11119999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x23333311,0x33333111,0x33331111,0x33111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333111,0x33331111,0x33111111
-	.word 0x33333333,0x33333333,0x13331333,0x11113333,0x11333333,0x33333333,0x13333333,0x11111133
-	.word 0x99999911,0x99991111,0x99111111,0x91111111,0x11111111,0x11111133,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999911,0x99991111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAA99,0xAAAAA999,0xAAAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999999AA,0x99999AAA,0x99999AAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x777AA999,0x77AAA999,0x77AAA999,0x77AAA999,0x7AAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999
-	.word 0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x999999AA,0x999999AA,0x9999AAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x9999AAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x11999999,0x11111999,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x11199999,0x11111999,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99111111,0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x99999991,0x99999111,0x99111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999111,0x99911111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0xA9999999
-	.word 0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAA999,0xAAAAAA99,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x999999AA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAAAA9999,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999AAAA,0x999AAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x999AAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11199999,0x11119999,0x11111119
-	.word 0x11199999,0x11119999,0x11119999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0xA9999999,0xA9999999,0xA9999999,0xA9991111,0xA1111111,0xA1111111,0xA1111111,0xA1111111
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x9999999A,0x99999AAA,0x99999AAA,0x9999AAAA,0x9999AAAA,0x9999AAAA
+	.word 0x0034A010,0x00F0006F,0xF04400A0,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0x6000F000,0x71F1FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x003000F0,0x00F091F1,0xF000F0FC,0xF000F000,0xA000F000,0x2B44BB00,0x0340B444,0xBB0370BB
+	.word 0x00A000F0,0x203810FF,0x402AF029,0xF000F01E,0x1000F000,0x888B3700,0xB0903FF0,0xF013F04B
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0F8,0xF000F000,0x54007000
+	.word 0x441C4455,0x06005555,0x00F00700,0x20FF4555,0x0003001D,0xF000F008,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0FB00,0x00F000F0,0x630300E0,0x5003F0B4,0x00F0F803,0x00F000F0,0x1304DEB3,0x2044448B
+	.word 0x90038884,0x88B4448B,0x0A00BA8B,0x209B0388,0xB8004003,0x07BB0200,0xBBBBB88B,0x00330088
+	.word 0x5E008006,0x4B1B544B,0x1FF45DF0,0x3100D203,0x3530E3B4,0x7F001FA0,0x00BB8888,0xFF5FA066
+	.word 0x0F243780,0x73800320,0x00F02FF1,0x00F000F0,0xF000F0FB,0xF000F000,0x5500E000,0x03F08903
+	.word 0x00BB43F7,0x401AF008,0xC3234503,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0x47001000
+	.word 0xFF8F134F,0x96139442,0x00F00350,0x00F000F0,0x00F000F0,0x8B0040A4,0x8B883103,0xB88B9F03
+	.word 0x00A133FF,0x00062003,0xF0A8B31B,0xF000F000,0x00F0FF00,0x00F000F0,0x17F40090,0x49910080
+
+	.word 0x40FFE323,0xF000F007,0xF000F000,0xF000F000,0xFF00F000,0x6B170090,0x005000F0,0x00F062F7
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0DF00F0,0xB400A000,0xDF8A0300,0x18109383,0xF0FEBF3A,0xF3000000,0xF000F0A7
+	.word 0xA000F000,0x80FFAB00,0xF000F003,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x004000F0,0xAB878AF1,0xF01EF0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0xA4490020,0x006000F0,0x10E725FF,0x3003F023,0xF098F303,0xF000F000,0x00F0E400
+	.word 0xA3130070,0x0300BAAA,0xAB5FBBAA,0x20BA03A0,0xF000F003,0xF000F000,0x00F0FF00,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0x3000F000,0xA06F5B00,0xF11D8003,0xFF1600F6,0xF5F12060
+	.word 0x00F0FFC1,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00D000F0,0x00FF1FF7,0xF05EF303,0xF200F000,0xF000F01D,0xFE00F000
+	.word 0x00F000F0,0x004000F0,0x0310B523,0xFCAAA733,0x03F0BE03,0x00F00310,0xCB7000F0,0x997F4444
+	.word 0x1FF000C0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFF1FF01F
+	.word 0xC7371F20,0x1FD0696F,0x1FF068D2,0x1FF01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F
+	.word 0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x00601FF0,0xF1FFA313,0xF09FF17F,0xF01FF01F,0xF01FF01F
+	.word 0xFE1FF01F,0x1FF01FF0,0x1FB01FF0,0x0310A723,0xDBAA1E00,0x03801200,0xA3A203A9,0x101044AF
+
+	.word 0xF0FF0090,0xF000F05F,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0CB00F0,0x66001000,0x69032066,0x00F00710,0x1096662F,0x0310661D,0x00801FF0
+	.word 0xF0FF2600,0xF000F000,0xF000F000,0xF000F000,0xFB00F000,0x00F000F0,0x00F000F0,0x23A90080
+	.word 0xD7AA13A7,0xAAA303F0,0x9903409A,0x00200340,0xF0FE4FF0,0xF000F000,0xF000F000,0x00AF4000
+	.word 0x409FA703,0xF09A7703,0xF000F01F,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFE00F000,0x00F000F0,0x00E000F0,0x0350A313
+	.word 0x0489B723,0x22999962,0x22020022,0x0300EA29,0x0080A313,0x92B01396,0xE7220300,0x25000400
+
+	.word 0x9996C743,0x00F0C8F3,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0xA71300C0,0xAA138703,0xA0530350,0xF0BEB3FF,0x00D42300,0xF003D042,0xF000F000,0x00F0EA00
+	.word 0xA3130030,0x790370A7,0x1F770340,0x00799A77,0xF02FF003,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xCC00F000,0x001000F0
+	.word 0x13F01119,0x91110070,0x0013F0D7,0x03302900,0x337D0329,0xDF0310A3,0x005000F0,0xD0250092
+	.word 0x20DE2303,0xFF00F003,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0x8000F000
+	.word 0x6BB01600,0x1703300F,0x5FE7FF37,0x7BB700F0,0x0B10D653,0x6EF00060,0xF0EF00F0,0x00A3F000
+	.word 0x03407903,0x03100B10,0x77690020,0x0330A303,0xAA0300A7,0x7F0320AA,0xD00370A7,0x5C435448
+
+	.word 0xF000F004,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FB,0xF000F000
+	.word 0x19006000,0x7F930340,0x110B0087,0xB0111911,0xF0131000,0x00F0E700,0x005000F0,0x04102221
+	.word 0x00A00380,0x22AFF38A,0x03002122,0x33031031,0x530E20D6,0x038092AB,0x00030012,0x335B321D
+	.word 0x00C9B700,0xC203101C,0x03500704,0x43009253,0x91200092,0xF0FBF09C,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x90FF00F0,0xF05F4700,0xF0048B03,0xF000F000,0xFE7FA700,0x0C00346F
+	.word 0x8BF70310,0x00F000F0,0xBA7A0020,0x0077B400,0x03032006,0x0330AAAE,0x77AA1FA7,0x50BF437A
+	.word 0xD7404403,0xFFC49FFF,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xD000F000
+	.word 0x03F71600,0xF06C035B,0x81B3FF1B,0x2B301000,0x00F058F3,0x00F000F0,0xF0F000F0,0xF000F000
+
+	.word 0x33005000,0x1C112333,0x10333331,0xE30D1008,0xED3332DF,0x2F9000E0,0x00130060,0x33152001
+	.word 0x137B1450,0x00114C20,0x03108534,0x80722091,0x3FF19F5F,0x36189999,0x00F03750,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0x12000000,0x57CF5EE2,0x0310FF77,0x00F01FFB,0x7BA783F7,0x72407FF7
+	.word 0x43E90310,0xC000F0C7,0xA703A900,0x0390AAA9,0x70BF03FF,0x606207A7,0x3000F003,0x20032080
+	.word 0xC09A7F2D,0xF06EF003,0xF000F000,0xF000F000,0x00F0FF00,0x01F20000,0x62831310,0x93031670
+	.word 0x10FFFCD6,0xF0A3131F,0xF000F016,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0x5000F000,0xF0D76300,0x9F71FF00,0x0400D323,0x1FE02F40
+	.word 0x2B700090,0xF0FF40FC,0x9300F000,0x63CF9E1D,0xF005F3CB,0xFF00F000,0x804700F0,0x780003E0
+
+	.word 0x00F07FF7,0x6FBF0030,0xF053F4FF,0x33C0D300,0x385EF8AB,0xF000F01D,0x00F0FF00,0x687300F0
+	.word 0x6E13FF56,0xE3F60B67,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0xFBF300F0,0xB02500A0,0x00F0F733,0x5EB31F30,0x0D00A92F,0xA1110300,0xEFF20390,0xF000F0FF
+	.word 0xF000F000,0x303D5300,0x53B72A00,0xE98780BF
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	ending_scene_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2184 = 2696
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,86 @@
 
 	.section .rodata
 	.align	2
-	.global ending_scene_flattenedTiles		@ 13472 unsigned chars
+	.global ending_scene_flattenedTiles		@ 2184 unsigned chars
 	.hidden ending_scene_flattenedTiles
 ending_scene_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBB4444,0xBBBB4444
-	.word 0xBBBBBB44,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444444BB,0x4444BBBB,0x44BBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0xBB888B44
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444BBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x55544444,0x55554444,0x55555444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444555,0x44445555,0x44455555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBBB4444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB444444,0x8BB44444,0x88844444,0x8B8B4444,0x8B88B444,0x88888444,0x88888B44,0x88888B44
-	.word 0x88888888,0xB8888888,0xBBB88888,0xBBBBB88B,0xBBBBBB88,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x444BBBBB,0x44BBBBBB,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0xBB44444B,0xBBB4444B,0xBBBB444B,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x88844444,0xBB888844,0xBBBBB888,0xBBBBBBB8,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44444BBB,0x444BBBBB,0x44BBBBBB,0x4BBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555544,0x55555444,0x55554444
-	.word 0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44555555,0x44455555,0x44445555
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0xBBB44444,0xBBBB4444,0xBBBBB444,0xBBBBBB44,0xBBBBBB44,0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBB4
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xB8888BBB,0xB88B88BB,0xB88B8888,0xB88BBBB8,0xB88BBBBB,0xBBB88BBB,0xBBBB8BBB,0xBBBBB8BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x4444444B,0x444444BB,0x4444444B,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x55544444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444555,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBB4444,0xBBBBB444
-	.word 0x44444444,0x4444BBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBB4,0xBBBBBBB4,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBABBB,0xBBBBABBB,0xBBBBABBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B,0x44444BBB,0x44BBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4BBB4444,0xBBBBBB44
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBBB44,0xBBBBB444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBABBB,0xBBBAAABB,0xBBAAAABB,0xBBAAAAAB,0xBBAAAAAB,0xBBAAAAAB,0xBBBAAAAB,0xBBBAAAAB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x4444BBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0x444BBBBB,0xBB4BBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x444BBB44,0x4BBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0xB4444444,0xBB444444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBB44444,0xBBBBBBB4
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBB4444,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xABBBBBBB,0xAABBBBBB,0xAABBBBBB
-	.word 0xBBBAAAAB,0xBBAAAAAB,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444BBB,0xBBBBBBBB,0x44444BBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x44444444,0x44444444,0xB4444444,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAABBBBBB,0xAABBBBBB,0xAABBBBBB,0xAA444444,0xAA999999,0xAA999999,0xAA999999,0xAAA99999
-	.word 0xBBAAAAAA,0xBBAAAAAA,0xBBAAAAAA,0x44AAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66669999,0x66666999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999966,0x99996666,0x96666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAA99999,0xAAA99999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99A99999,0x99A79999,0x99A79999,0x9A779999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x66666999,0x66666999,0x66666999,0x66669999,0x62899999,0x22229999,0x22222299,0x22222229
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x99999966,0x99999992,0x99999222,0x99992222
-	.word 0x99966666,0x99666666,0x99999966,0x99999996,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x9A779999,0x9AA79999,0x9AA79999,0x9AA79999,0x9AA77999,0x9AA77999,0x9A777799,0x9A777779
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11199999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99991111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x29999999,0x29999999,0x22299999,0x22229999
-
-	.word 0x22222229,0x22222229,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x99922222,0x99922222,0x99922222,0x99922222,0x99922222,0x99222222,0x99222222,0x99222222
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xA9999999,0xAA999999,0xAA999999,0xAAA99999,0xAAA99999,0xAAAA9999,0xAAAA9999,0xAAAAA999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0x9AAAAAAA,0x99AAAAAA,0x99AAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0xA9999999,0x79999999,0x79999999,0xA9999999,0xA9999999,0x99999999,0x99999999
-	.word 0x9A777777,0x9A777777,0x9AA77777,0xAAAA7777,0xAAAA7777,0xAAAAA777,0xAAAAA777,0xAAAAA777
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999A,0x9999999A,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11999999,0x11999999
-	.word 0x99999999,0x99999999,0x11999999,0x11119999,0x11111119,0x11111111,0x11111111,0x11111111
-	.word 0x11119999,0x11111119,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22211111,0x21111111,0x21111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222221,0x22222231,0x22223331
-	.word 0x99222222,0x99222222,0x92222222,0x92222222,0x92222222,0x12222222,0x33222222,0x33322222
-
-	.word 0xC9999999,0xC9222299,0xC2222299,0xC2222229,0xC2222229,0x92222229,0x92222221,0x91222233
-	.word 0x9999999C,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAA999,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x99999AAA,0x99999AAA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x7A999999,0x77A99999,0x777A9999,0x777A9999
-	.word 0xAAAAAA77,0xAAAAAA77,0xAAA7AA77,0xAAAA7A77,0xAAAA7777,0xAAAA7777,0xAAAA7777,0xAAAAAA77
-	.word 0x999999AA,0x9999999A,0x9999999A,0x9999999A,0x9999999A,0x999999AA,0x999999AA,0x999999AA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11119999,0x11119999,0x11111999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x11999999,0x11111111,0x11111111,0x11111111
-	.word 0x11999999,0x11199999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x23333311,0x33333111,0x33331111,0x33111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333111,0x33331111,0x33111111
-	.word 0x33333333,0x33333333,0x13333333,0x11113333,0x13333333,0x33333333,0x11333333,0x11111133
-	.word 0x99999111,0x99991111,0x99111111,0x91111111,0x11111111,0x11111113,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999111,0x99991111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAA99,0xAAAAA999,0xAAAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999,0xAAAAAA99,0xAAAAAAA9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x9AAAAAAA,0x9AAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999999AA,0x99999AAA,0x99999AAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x777AA999,0x77AAA999,0x77AAA999,0x77AAA999,0x7AAAA999,0xAAAA9999,0xAAAA9999,0xAAAA9999
-	.word 0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAA7,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x999999AA,0x999999AA,0x9999AAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x999AAAAA,0x9999AAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x11999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11111999,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x11999999,0x11111999,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111999,0x11111199,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99111111,0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x99999991,0x99991111,0x99111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999991,0x99999111,0x99111111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0xA9999999
-	.word 0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAA999,0xAAAAAA99,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x99999AAA,0x999999AA,0x9999999A,0x9999999A
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xAAAA9999,0xAAAAAA99,0xAAAAAA99,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x9999AAAA,0x999AAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x99AAAAAA,0x999AAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x19999999,0x11199999,0x11119999,0x11111199
-	.word 0x11199999,0x11119999,0x11119999,0x11111119,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x91111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99991111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0xA9999999,0xA9999999,0xA9999999,0xA9991111,0xA1111111,0xA1111111,0xA1111111,0xA1111111
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x9999999A,0x99999AAA,0x99999AAA,0x9999AAAA,0x9999AAAA,0x9999AAAA
+	.word 0x0034A010,0x00F0006F,0xF04400A0,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0x6000F000,0x71F1FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x003000F0,0x00F091F1,0xF000F0FC,0xF000F000,0xA000F000,0x2B44BB00,0x0340B444,0xBB0370BB
+	.word 0x00A000F0,0x203810FF,0x402AF029,0xF000F01E,0x1000F000,0x888B3700,0xB0903FF0,0xF013F04B
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0F8,0xF000F000,0x54007000
+	.word 0x441C4455,0x06005555,0x00F00700,0x20FF4555,0x0003001D,0xF000F008,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0FB00,0x00F000F0,0x630300E0,0x5003F0B4,0x00F0F803,0x00F000F0,0x1304DEB3,0x2044448B
+	.word 0x90038884,0x88B4448B,0x0A00BA8B,0x209B0388,0xB8004003,0x07BB0200,0xBBBBB88B,0x00330088
+	.word 0x5E008006,0x4B1B544B,0x1FF45DF0,0x3100D203,0x3530E3B4,0x7F001FA0,0x00BB8888,0xFF5FA066
+	.word 0x0F243780,0x73800320,0x00F02FF1,0x00F000F0,0xF000F0FB,0xF000F000,0x5500E000,0x03F08903
+	.word 0x00BB43F7,0x401AF008,0xC3234503,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0x47001000
+	.word 0xFF8F134F,0x96139442,0x00F00350,0x00F000F0,0x00F000F0,0x8B0040A4,0x8B883103,0xB88B9F03
+	.word 0x00A133FF,0x00062003,0xF0A8B31B,0xF000F000,0x00F0FF00,0x00F000F0,0x17F40090,0x49910080
+
+	.word 0x40FFE323,0xF000F007,0xF000F000,0xF000F000,0xFF00F000,0x6B170090,0x005000F0,0x00F062F7
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0DF00F0,0xB400A000,0xDF8A0300,0x18109383,0xF0FEBF3A,0xF3000000,0xF000F0A7
+	.word 0xA000F000,0x80FFAB00,0xF000F003,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x004000F0,0xAB878AF1,0xF01EF0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0xA4490020,0x006000F0,0x10E725FF,0x3003F023,0xF098F303,0xF000F000,0x00F0E400
+	.word 0xA3130070,0x0300BAAA,0xAB5FBBAA,0x20BA03A0,0xF000F003,0xF000F000,0x00F0FF00,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0x3000F000,0xA06F5B00,0xF11D8003,0xFF1600F6,0xF5F12060
+	.word 0x00F0FFC1,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00D000F0,0x00FF1FF7,0xF05EF303,0xF200F000,0xF000F01D,0xFE00F000
+	.word 0x00F000F0,0x004000F0,0x0310B523,0xFCAAA733,0x03F0BE03,0x00F00310,0xCB7000F0,0x997F4444
+	.word 0x1FF000C0,0x1FF01FF0,0x1FF01FF0,0xF0FF1FF0,0xF01FF01F,0xF01FF01F,0xF01FF01F,0xFF1FF01F
+	.word 0xC7371F20,0x1FD0696F,0x1FF068D2,0x1FF01FF0,0xF01FF0FF,0xF01FF01F,0xF01FF01F,0xF01FF01F
+	.word 0x1FF0FF1F,0x1FF01FF0,0x1FF01FF0,0x00601FF0,0xF1FFA313,0xF09FF17F,0xF01FF01F,0xF01FF01F
+	.word 0xFE1FF01F,0x1FF01FF0,0x1FB01FF0,0x0310A723,0xDBAA1E00,0x03801200,0xA3A203A9,0x101044AF
+
+	.word 0xF0FF0090,0xF000F05F,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0CB00F0,0x66001000,0x69032066,0x00F00710,0x301410CF,0xF0966621,0xF000F01D
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0EF,0xA9003000,0xAA13A723
+	.word 0xAAA303F0,0x03409A5F,0x20034099,0xF04FF000,0xFA00F000,0x00F000F0,0xAF4000F0,0x40A70300
+	.word 0x9A7F7703,0x00F01FF0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xE000F0F8,0x50A31300,0x89952303
+	.word 0x99139962,0x02002222,0x03002922,0xB0D7A303,0x92320000,0x00220300,0x00250004,0x13967F31
+
+	.word 0xF3D323C7,0xF000F0CC,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0x80FF00F0
+	.word 0x03A71300,0x50AA1387,0xB3A05303,0xFF00F0BE,0x4200D423,0x00F003D0,0x00F000F0,0x003000F0
+	.word 0xA7A313A8,0x40790370,0x9A777703,0x0300797F,0x00F02FF0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0x19360010
+	.word 0x7013F011,0x1DF01100,0xBE290010,0x03290330,0x10A3337D,0x5000F003,0x00FF9200,0x2303D025
+	.word 0xF00320DE,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0x160080FF
+	.word 0x300F6BB0,0xE7371703,0xB700F05F,0xD653FF7B,0x00600B10,0x00F06EF0,0xA3F000F0,0x797B0300
+	.word 0x0B100340,0x00200310,0x30A30377,0x00A74B03,0x20AAAA03,0x0370A703,0x54FF48D0,0xF0045C43
+
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0x6000F0DE
+	.word 0x03001900,0x61935D13,0x1F110B00,0xB0111911,0xF013F000,0x9000F000,0x22213C00,0x03800410
+	.word 0xAFF300A0,0x21562222,0x10310300,0x0E203303,0xB292AB53,0x00120380,0x321D0003,0xC9B70033
+	.word 0x101C00DA,0x0704C203,0x00920350,0x009F9243,0xF09C9120,0xF000F0FB,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x5F470090,0x8BFF03F0,0xF000F004,0xA700F000,0x00346F7F,0xF503100C
+	.word 0x00F08BF7,0x002000F0,0x77B4007A,0x20D00600,0xAAAE0303,0xAAA70330,0x43FF7A77,0x440350BF
+	.word 0x9FFFD740,0xF000F0C4,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0x3300D0FF
+	.word 0xF6FE0657,0xA31810E1,0x0797137F,0x58F3FF27,0x00F000F0,0x00F000F0,0x00F000F0,0x508000F0
+
+	.word 0x23333300,0x33333111,0x100810E7,0x32DFE30D,0x9000E033,0x7B00802F,0x10153013,0x20263007
+	.word 0x2D51914C,0x91590221,0x80131210,0x993EF15F,0x7F320099,0xF0375099,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x000000F0,0xCF5EE212,0x03107757,0x00F01FFB,0xA783F7FF,0x407FF77B,0x43031072
+	.word 0xC000F0C7,0x03A94F00,0x90AAA9A7,0x70BF0303,0xFB6207A7,0x00F00360,0x03208030,0xC09A2D20
+	.word 0xFF6EF003,0x00F000F0,0x00F000F0,0x00F000F0,0x01F20000,0x86FB16FF,0xF62BA0D0,0xF0A333E8
+	.word 0xF000F016,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0xD7630050,0x9F7100F0,0x0774D323,0x00901FE0,0xF0FF73FF,0xF000F01E
+	.word 0x9E1D9300,0xF3CB63CF,0x00F0FF05,0x00F000F0,0x03E08047,0x7FF77800,0x30FF00F0,0xF46FBF00
+
+	.word 0xD300F053,0xF8AB33C0,0xFF1D385E,0x00F000F0,0x00F000F0,0xF72D7F83,0x0B60C831,0xF067FAFF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00A0FBF3,0xF7339825
+	.word 0x3000F0EC,0xA92F5E1F,0x03000D00,0x90FFA111,0xF0EFF203,0xF000F000,0x5300F000,0xE000303D
+	.word 0xBF53B72A,0x0000E987
 
 	.section .rodata
 	.align	2
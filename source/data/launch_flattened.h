@@ -6,8 +6,8 @@
 //	launch_flattened, 3368x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 421 tiles not compressed
-//	Total size: 512 + 13472 = 13984
+//	+ 421 tiles lz77 compressed
+//	Total size: 512 + 2404 = 2916
 //
 //	Time-stamp: 2021-04-06, 09:05:26
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_LAUNCH_FLATTENED_H
 #define GRIT_LAUNCH_FLATTENED_H
 
-#define launch_flattenedTilesLen 13472
-extern const unsigned int launch_flattenedTiles[3368];
+#define launch_flattenedTilesLen 2404
+extern const unsigned int launch_flattenedTiles[601];
 
 #define launch_flattenedPalLen 512
 extern const unsigned short launch_flattenedPal[256];
@@ -6,8 +6,8 @@
 @	launch_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2404 = 2916
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,94 @@
 
 	.section .rodata
 	.align	2
-	.global launch_flattenedTiles		@ 13472 unsigned chars
+	.global launch_flattenedTiles		@ 2404 unsigned chars
 	.hidden launch_flattenedTiles
 launch_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x32333333,0x32333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88833333,0x88883333
-	.word 0x33333333,0x33333333,0x33333333,0x33888233,0x88882233,0x88882233,0x28882233,0x82222233
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333332
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33334443
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x88333333,0x88333333,0x88833333,0x88883333,0x88333333,0x88333333
-
-	.word 0x88883333,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x22222233,0x22222233,0x22222333,0x22222333,0x22222333,0x22222333,0x22222333,0x22223333
-	.word 0x33333332,0x33333332,0x33888882,0x38888888,0x38888888,0x22888882,0x28888222,0x88882222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x23333333,0x23333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333322,0x33388222,0x33222222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333332,0x33333322,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x43333333,0x43333333,0x44333333,0x44333333,0x44333333,0x43333333,0x43333333,0x33333333
-	.word 0x33444444,0x33444444,0x34444444,0x34444444,0x34444444,0x33444444,0x33444444,0x33334443
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x83333333,0x88883333,0x88883333,0x88888333,0x88888833,0x88888833,0x88888833,0x88888833
-	.word 0x22888888,0x28888888,0x28888888,0x28888888,0x28888888,0x22888888,0x22888888,0x22288888
-	.word 0x22333333,0x23333333,0x23333333,0x33333333,0x33333335,0x33333355,0x33333355,0x33333555
-
-	.word 0x88222222,0x22222222,0x22222222,0x22222222,0x22222223,0x22222233,0x22222233,0x22222333
-	.word 0x33333332,0x33333332,0x33333332,0x33333332,0x33333332,0x33333322,0x33338828,0x33338222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33222223,0x32222233,0x22223333,0x22333333,0x23333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333332,0x33333322,0x33333323,0x33332223,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x23333333,0x33333333,0x32233333,0x33233333,0x33333333,0x33333333
-	.word 0x33333322,0x33333222,0x33333332,0x33333333,0x33333333,0x33333333,0x33333333,0x83333333
-	.word 0x88888333,0x88888333,0x88888333,0x88882333,0x88888823,0x88888888,0x88888888,0x28888888
-	.word 0x22288888,0x32288888,0x32228888,0x32222888,0x32222888,0x33222288,0x33322288,0x33332222
-	.word 0x33335555,0x33335555,0x33355555,0x33555555,0x33555555,0x55555555,0x55555555,0x55555555
-	.word 0x22233333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333335,0x33333335
-	.word 0x33332222,0x22222222,0x22222222,0x22222223,0x22222333,0x22233333,0x23333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333222,0x33332222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x88333333,0x88833333,0x88883333,0x28883323,0x28822223,0x22222233
-	.word 0x33333333,0x33333333,0x33333328,0x33333288,0x82332888,0x88222288,0x88828888,0x88828222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333322,0x33333888,0x33338888,0x33288888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333323,0x33333323,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333666,0x33336666,0x33366666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x32333333,0x33233333,0x33333333,0x33333332,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x83333333,0x83333333,0x83333333,0x88333333,0x88888333,0x88888833,0x88888823,0x28888823
-	.word 0x28888888,0x22888888,0x22288888,0x22228888,0x22222288,0x22222228,0x22222222,0x32222222
-	.word 0x33333222,0x33333322,0x33333322,0x33333332,0x33333332,0x22333332,0x22233333,0x22233333
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333355,0x33335555,0x33355555,0x33555555,0x35555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355
-	.word 0x33222233,0x32233333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11111333
-	.word 0x33333333,0x33333333,0x33333333,0x11113333,0x11111133,0x11111113,0x11111111,0x11111111
-
-	.word 0x33333333,0x33333333,0x33111113,0x33311111,0x33331111,0x33333111,0x33333331,0x33333331
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22223333,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x82222222,0x22222222,0x22222223,0x22222233,0x22222333,0x22223333,0x22233333,0x33333333
-	.word 0x33888888,0x28822282,0x28222222,0x22222222,0x22222222,0x22222222,0x22233332,0x22333333
-	.word 0x33333333,0x33333333,0x38833322,0x88883322,0x88888222,0x88888222,0x22222222,0x22222222
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333338,0x33333322
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333223,0x33322223
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666633,0x66666633,0x66666633,0x66666633,0x66666633,0x66666333,0x66663333,0x66633333
-	.word 0x33366666,0x33366666,0x33366666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333336,0x33333366,0x33333666,0x33336666,0x33666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x83333333,0x28823333
-	.word 0x28888823,0x28888823,0x22888833,0x22288823,0x22228823,0x22222882,0x22222222,0x32222222
-	.word 0x33322222,0x33332222,0x33333222,0x33333322,0x33333322,0x33333332,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x53333333,0x53333333,0x53333333,0x55333333,0x55333333,0x55333333
-	.word 0x55555155,0x55555111,0x55555511,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x11555515,0x11111111,0x11111111
-	.word 0x33333555,0x33355555,0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111133,0x11111133,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x31111111
-	.word 0x11111111,0x31111111,0x31111111,0x33131111,0x33333331,0x33333331,0x33333331,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33113333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22222222,0x22333333,0x23333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333222,0x32222222,0x32222222,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33323333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66633333,0x66633333,0x66633333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666633,0x66666633,0x66666333,0x66666333,0x66666333
-	.word 0x36666666,0x36666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33366666,0x33666666,0x33666666,0x66666666
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x23333333,0x83333333,0x83333333,0x83333333,0x83333333,0x22233333,0x32233333,0x33332333
-	.word 0x22888888,0x22228888,0x22222888,0x33222288,0x33332222,0x33333332,0x33333333,0x33333333
-	.word 0x33322222,0x33333322,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x23333333,0x33333333,0x33333333,0x33333333
-	.word 0x55533333,0x55533333,0x55533222,0x55553322,0x55553333,0x35555333,0x55555333,0x55555533
-	.word 0x11115555,0x11115555,0x11111151,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33311111,0x33311111,0x33311111,0x33511111,0x35551111,0x55555111,0x55555551,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11133333,0x11113355,0x11111555
-	.word 0x33111333,0x33111333,0x33311133,0x33311113,0x33331111,0x33331111,0x33331111,0x33333111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x22233333,0x22223333,0x32233333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33332222,0x33332222
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666333,0x66666333,0x66666333,0x66666333,0x66663333,0x66633333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666663,0x66666633
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333366,0x33333366,0x33333366,0x33333666,0x33333666,0x33333666,0x33333666
-
-	.word 0x33332233,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x53333333,0x55333323,0x55533333,0x55555333,0x55555333,0x55555533
-	.word 0x55355553,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x55551111,0x55555511,0x55555511,0x55555551
-	.word 0x55555111,0x55555511,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x15555555,0x11555555,0x11155555,0x11115555,0x11115555,0x11111555
-	.word 0x11111555,0x11111155,0x11111111,0x11111111,0x11111111,0x11111111,0x11311111,0x51111111
-	.word 0x33333111,0x33333111,0x33333311,0x33333331,0x33333355,0x33333555,0x33355555,0x35555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33322222,0x33323222,0x22222223,0x22223333,0x22222333,0x22222333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33332222,0x22222222,0x22222222,0x22222222,0x22222223,0x22233333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333332,0x33333332,0x33333322,0x33322222
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66663333,0x66633333,0x66663333,0x66663333,0x66663333,0x66663333,0x66663333,0x66633333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333666,0x33333666,0x33366666,0x36666666,0x36666666,0x66666666,0x66666666,0x66666666
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333333,0x55533333
-
-	.word 0x33333333,0x53333333,0x55333333,0x55533333,0x55555333,0x55555553,0x55555555,0x55555555
-	.word 0x55555553,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x51111111,0x55111111,0x55551111,0x55555555,0x55555555,0x55555555
-	.word 0x55555551,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x15555555,0x11555555,0x11555555,0x11155555,0x11111155
-	.word 0x11111555,0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x51111111,0x51111111,0x51111111,0x55111111,0x55111111,0x55551111,0x55555111,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x15555555,0x15555555,0x11555555
-	.word 0x33313335,0x33311355,0x33331115,0x35551115,0x55555111,0x55555511,0x55555511,0x55555111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33335555,0x33555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x22333333,0x23333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x32222222,0x22222222,0x22222223,0x22333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333332,0x33222222,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x22222333,0x33223333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33332222,0x33332222,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x66633333,0x66633333,0x66633333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x66666666,0x66666666,0x66666666,0x66666663,0x66633333,0x66633333,0x77733333,0x77733333
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666667,0x66666777
-	.word 0x66666666,0x36666666,0x76666666,0x77666666,0x77766666,0x77766666,0x77766666,0x77777766
-	.word 0x33333333,0x33333333,0x33333333,0x55533777,0x55777777,0x77777777,0x77777777,0x77777777
-	.word 0x55553333,0x55555333,0x55555555,0x55555555,0x55555555,0x55555555,0x55555557,0x55555577
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x51115555,0x51155555,0x11555555,0x11555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555511,0x55555111
-	.word 0x55555555,0x55555555,0x55555555,0x15555555,0x11155555,0x11111111,0x11111111,0x11111111
-	.word 0x55555555,0x55555555,0x55551555,0x55551115,0x15555111,0x11555111,0x11155511,0x11111551
-	.word 0x11111155,0x11111115,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x51111111
-	.word 0x55555551,0x55555551,0x55555551,0x55555551,0x55555551,0x55555555,0x55555555,0x15555555
-	.word 0x11555555,0x11115555,0x11111555,0x11111155,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x55555111,0x55555111,0x55555511,0x55555511,0x55555511,0x55555511,0x55555551,0x55555551
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333355,0x33555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333355,0x33333555,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55533333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53333355,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333355,0x33555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555553,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55533333,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x55333333,0x55555555,0x55555555,0x55555555
-	.word 0x33333333,0x33333333,0x33333333,0x55555533,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x77753333,0x77555333,0x77555555,0x75555555,0x75555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777775,0x77777555,0x77775555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x55555777,0x55555777,0x55555777,0x55557777,0x55557777,0x55557777,0x55577777,0x57777777
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x15555555,0x15555555,0x11555555,0x11155555,0x11155555,0x11555555,0x11555555,0x15555555
-	.word 0x55555111,0x55555111,0x55555111,0x55551111,0x55111111,0x11111111,0x11111111,0x11111111
-	.word 0x51111111,0x51111111,0x55111111,0x55111111,0x15111111,0x15555111,0x15555511,0x11155555
-
-	.word 0x11111155,0x11111115,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x55111111,0x55511111,0x55511111,0x55511111,0x55511111,0x55511111,0x55555511,0x55555551
-	.word 0x11155555,0x11111555,0x11111555,0x11111155,0x11111155,0x11111115,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x51111111,0x55111111,0x55111111
-	.word 0x55555555,0x55555551,0x55555551,0x55555551,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x15555555
-
-	.word 0x55555555,0x55555555,0x55551555,0x55551155,0x55551155,0x55551155,0x55551115,0x55551111
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x51555555,0x15555555,0x15555555,0x15555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555551,0x55555511,0x55555511,0x55555111,0x55551111,0x55511111,0x55513111
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x77775555,0x77775555,0x77775555,0x77555555,0x55555555,0x55555555,0x75555555,0x75555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x55555557,0x55555557,0x55555557,0x55555577,0x55555577,0x55555777,0x55555777,0x55555777
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111115,0x11111115,0x11111155,0x11111555
+	.word 0x0034A010,0x00F0006F,0xF03300A0,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0xB1F000C0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0x3000F000,0xF091F100,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF051F200,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x0030FF00
+	.word 0x00F091F1,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0F700,0x00F000F0,0x40320040,0xF000F003,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x83060020,0x88333388,0x00800300,0x0E00B082,0x30130022,0x22332803,0xF0827F22
+	.word 0xF3003037,0xF000F02C,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0F900F0
+	.word 0xF000F000,0xF000F000,0xF0444300,0x00F0FF13,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0F7,0xE000F000,0x03008300,0x03008B13,0x409763DD,0x00F08803,0xA3030080,0x6B032022
+
+	.word 0x0303F023,0xA75322CC,0x002A0082,0x1038712E,0x030B0003,0x222888D9,0xF0FDE713,0xF3006000
+	.word 0xF000F0DF,0x23002000,0xF0E10340,0x00000000,0x82223398,0xFFB62038,0x00F000F0,0x4EF000F0
+	.word 0xC7B016F0,0x006020F0,0x03404378,0x03508D13,0x44331350,0x50445F44,0x03803403,0xBFF31320
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFB00F000,0x00C000F0,0x4713BB03
+	.word 0x33830300,0xCE039064,0x65030000,0x03C02888,0x03001310,0xBB52D728,0x00352F63,0x03505503
+	.word 0x23030C00,0x70AC03FF,0x33D60300,0x53F343EF,0x100390DF,0x17287F50,0xF0BDF7CA,0xA000F000
+	.word 0x23467400,0xAB50FFAC,0x775000E0,0x6CF3C820,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0x237E9742,0xA2728A02
+	.word 0x1100B422,0x0020CBF6,0xB323C783,0x88230350,0x90020088,0x57AB0300,0x32A71328,0x0032AE03
+	.word 0x0303300A,0x0E00DA0A,0x03551123,0x350330A8,0xFF550300,0x00600350,0x11E30D43,0x0310E713
+	.word 0xDB835E33,0x207023FF,0x4067F333,0x536B2300,0xF000F091,0x00F0F800,0x00F000F0,0x9B6800D0
+	.word 0x0D883323,0x82222328,0x81601F1C,0xDD201028,0x350C9300,0x011F0182,0x8206003A,0xB0CF501C
+	.word 0x88301000,0x10315538,0xF000F035,0x00F0FF00,0x6CF80090,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0x8500F000,0x333300F0,0x03003666,0xFF031066,0x00F00800
+
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x630050FF,0xF087F393,0x1B00C000,0x6703501B,0xA713FE63
+	.word 0x4F870300,0x2C37A713,0x0050D80A,0x2723F932,0x03103800,0x63432387,0xAB932223,0x2300F0EF
+	.word 0x35DFD3C0,0x00F01EC0,0x1C200040,0x142223E1,0x3300F093,0xB0111113,0x0F008E10,0x00111111
+	.word 0x90006016,0x112B112A,0x33211031,0x00330600,0xF9032002,0x00D000F0,0x00F0B767,0x82221D20
+	.word 0x47EF57A8,0x18C557F0,0xEB0382C6,0x101856B1,0x220FD7B4,0x05388333,0x40F30315,0xFF004003
+	.word 0x833171F0,0x94F00204,0x00F000F0,0x00F000F0,0xE000F0FF,0x29252600,0xF000F03D,0xF000F000
+	.word 0x00F0DA00,0x03660020,0x6303D089,0xFF339D33,0xA3030810,0x00F00370,0xCD134A90,0xDF731010
+	.word 0xF01EA0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0CE00,0x2882AF03,0x0310A313,0xB7231A12
+
+	.word 0x1E23A303,0x3249727A,0x71224912,0xF098A7C3,0x80533300,0x55226B03,0x553E5551,0x03031011
+	.word 0xF006008B,0x5500F000,0x2E00157D,0x631B0050,0x0B00DB23,0xF6778315,0x03407F63,0x002000F0
+	.word 0x00078031,0x63FF1303,0xF09BF397,0xF0C90300,0xF000F012,0xFF00F000,0x00F000F0,0x000000F0
+	.word 0x6FF8A343,0x67281F50,0xF3A711FF,0xF000F02C,0xF000F000,0x5000F000,0x72F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x637F0030,0x0330A723,0xABA300F0,0x0340DF93,0x40FFE013,0xF300F003
+	.word 0x500754C0,0xB073F003,0xFF14F07B,0xD71100F0,0x03004397,0xC205FB26,0x3737DF25,0x1A9303FF
+	.word 0x910D12D7,0xF09F2375,0xB000F053,0x0080A16F,0x53A70353,0x00322255,0x2D5BAE03,0x53700353
+	.word 0x8303285B,0xFE510300,0x00F05BF3,0x00F000F0,0x3747A2F3,0x9E510310,0x35550300,0x2B542F14
+
+	.word 0x0010BEF0,0x55113E13,0x10042910,0x0E100A00,0xFF137427,0x03507F57,0x00F0E4F3,0x221100F0
+	.word 0xE0F26357,0x2B0000FF,0xF02140DF,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0x8000F000,0xFFAB8300,0x1E509797,0x0030B1F3
+	.word 0x1CF0DA13,0x00F000F0,0x27FFF3FF,0x170350D3,0xF30380DB,0xF000F07C,0x00F0EF00,0x00E000F0
+	.word 0x23B80353,0x439B23AB,0xAA03FF9F,0x008040F7,0x00F06FF3,0xAB3700B0,0xF7F7AF57,0x7700F0BB
+	.word 0x152A10B6,0x03202F24,0x20EF9F03,0x5764F003,0xA313519A,0xE0000320,0x28FFAE13,0x10F35734
+	.word 0xD000F004,0x9081F100,0x7F1F151C,0x430D1B32,0x2B3F1BB1,0x7F27D043,0xFF6F6BE7,0x0090634B
+	.word 0x9427A35C,0x00F072F7,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+
+	.word 0x00F000F0,0x00F000F0,0xCF6300F0,0x90FFDB53,0xF0A03703,0xF000F000,0x53004000,0xFFB737AB
+	.word 0x8FF0EBE7,0x00F000F0,0xE70A0020,0x0B503B17,0x009B73FF,0x90006002,0xF000F00B,0x60BFF300
+	.word 0x8217FF00,0x00905923,0x00F097F3,0xA743A3F3,0x43FF5010,0xA05BFB9F,0x20035077,0xF0DD2332
+	.word 0xA067D078,0x03356B20,0x311355D5,0x03FF1533,0x277100E0,0x105F54DB,0x7F54D10B,0xFF7E38CF
+	.word 0x00E076F1,0x1C901BFB,0xCF431B3B,0x00502BF4,0xF0D337FF,0xF000F01E,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0xDF3400F0,0x1371CBF0,0xF0FFBBF8,0xF000F000,0xFB001000,0xE700907F
+	.word 0x3A2B6093,0x03107773,0x0030B0F3,0x77030067,0x430410EE,0x760300C5,0x06001210,0x61770370
+	.word 0x70430077,0x53377700,0xF5120055,0x00600310,0x00E0CF4A,0x77030057,0xF0EF16F0,0x0291F300
+
+	.word 0x1A2715B5,0x00F00340,0xF3F6DF82,0xB069B317,0x15332019,0x98230300,0x9B83F351,0x00F09FF3
+	.word 0x511100F0,0x03D08210,0xF70FF4FF,0x784170A7,0xF0039003,0x4000F04B,0x463CFF00,0x1C3000F0
+	.word 0xF3330000,0x1F5027F0,0x78FF0050,0x701FF01B,0xF0ECB100,0xF0A8451F,0xFF67B01F,0x27F07FF4
+	.word 0x1FF01FF0,0xA5A000F0,0x3FF019F0,0x7000F0FF,0x7017F041,0xA01FF03B,0xF11FF01A,0x1F009D7E
+	.word 0x6A007775,0x03102A13,0xF7034075,0x62030060,0x00A08613,0x00841375,0xFF1D2004,0x00F000F0
+	.word 0x007000F0,0x0360A803,0x03505120,0x5D10577F,0x00F0C613,0x8B6600B0,0x03106133,0x13C662FF
+	.word 0x10DF326B,0xE3092303,0x03FBC606,0xA313FF8A,0x9BF3B153,0x00F000F0,0x641302A4,0x00FF03E0
+	.word 0x005F339C,0xF0478B63,0x9000F06F,0xFF0010AF,0x00F0FBF3,0x00F000F0,0x572100F0,0x59810970
+
+	.word 0xF0055CFF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xE000F000,0x52B61100,0xC06F71C3,0xDF539920,0x4302C732,0xF0F1F131,0xA7559300
+	.word 0xFFEB2312,0x00F090F3,0x00F000F0,0xDE6300F0,0x8F578B27,0x830320FE,0xB000F0F3,0x57F8D200
+	.word 0x00DB5A2B
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 //	tilesheet, 1184x24@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 444 tiles Metatiled by 4x3 not compressed
-//	Total size: 512 + 14208 = 14720
+//	+ 444 tiles Metatiled by 4x3 lz77 compressed
+//	Total size: 512 + 2948 = 3460
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET_H
 #define GRIT_TILESHEET_H
 
-#define tilesheetTilesLen 14208
-extern const unsigned int tilesheetTiles[3552];
+#define tilesheetTilesLen 2948
+extern const unsigned int tilesheetTiles[737];
 
 #define tilesheetPalLen 512
 extern const unsigned short tilesheetPal[256];
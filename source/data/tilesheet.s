@@ -6,8 +6,8 @@
 @	tilesheet, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2948 = 3460
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,113 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheetTiles		@ 14208 unsigned chars
+	.global tilesheetTiles		@ 2948 unsigned chars
 	.hidden tilesheetTiles
 tilesheetTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585,0x55555585
-	.word 0x55555555,0x88888888,0x88855555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x88888888,0x55555888,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58555555
-
-	.word 0x55555585,0x55555585,0x55555885,0x55555885,0x55555885,0x55555885,0x55555585,0x55555585
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x58555555,0x58555555,0x58855555,0x58855555,0x58855555,0x58855555,0x58555555,0x58555555
-	.word 0x55555585,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88855555,0x88888888,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555888,0x88888888,0x55555555
-	.word 0x58555555,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58888888,0x55555555
-
-	.word 0x69999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66699999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999999,0x99999966
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66999999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999996,0x99999966
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAA0,0xAAAAAAA0,0xAA0AAAA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0AAAAAAA,0x0AAAAAAA,0x0AAAAAAA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAAA0000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x55555555,0x55555555,0xCCCCCC55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE
-	.word 0x55555555,0x55555555,0x55CCCCCC,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE
-	.word 0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55
-	.word 0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE
-	.word 0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE
-	.word 0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE
-
-	.word 0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x33333E55,0xEEEEEE55,0x55555555,0x55555555
-	.word 0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0xE3333333,0xEEEEEEEE,0x55555555,0x55555555
-	.word 0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x3333333E,0xEEEEEEEE,0x55555555,0x55555555
-	.word 0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55E33333,0x55EEEEEE,0x55555555,0x55555555
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xDDBBBBBB,0xDDDBBBBB,0xDDDDBBBB,0xDDDDDBBB,0xDDEDDDBB,0xDDDEDDBB,0xEEDDDEEB
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDEEEDD,0xDDEEEEED,0xDDEEEEED,0xEEDEEEED
-	.word 0xBBBBBBBB,0xBBBBBBDD,0xBBBBBDDD,0xBBBBDDDD,0xBBBDDDEE,0xBBDDDEEE,0xBBDEDDDD,0xBDEEEDDE
-
-	.word 0xEEEDEEEB,0xEEEEEEEB,0xEEEEEEEB,0xEEEEEEEB,0xDEEEEEEB,0xDEDEEEEB,0xEDDEEEEB,0xEEEEEEBB
-	.word 0xEEDEEEED,0xEEDDEDDE,0xEDDEEEEE,0xDDDEEEEE,0xDDDDDEDD,0xDDDDDDED,0xDDDDDDDD,0xDDDDEDDD
-	.word 0xBDEEDEEE,0xBDDDDDEE,0xBDDEEEEE,0xBDDEEDDD,0xBDDDDDDD,0xBDDDDDDD,0xBDDDDDDD,0xBBDDDDDD
-	.word 0xEEEEEEBB,0xEEEDDBBB,0xEDDDBBBB,0xDEDBBBBB,0xDDBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xDDEEDEED,0xDDEEEEED,0xDDDDDDEE,0xDDDDEEED,0xDDDDDEED,0xDDDDDDDD,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBDDDDDD,0xBBBDDDDD,0xBBBBDDDD,0xBBBBBDDD,0xBBBBBBDD,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBFBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBFFBBBB,0xBBFFBBBB,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x69999999,0x99999999,0x99999999,0x99999996,0x49999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999994,0x69999994,0x69999994,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x99966666,0x99666669,0x66666999,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x49999999,0x49999999
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666644,0x66666949
-
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66699999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999999,0x99999966
-	.word 0x49499996,0x99499666,0x99996666,0x99966666,0x99666666,0x96666699,0x66669999,0x66999999
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x99999996,0x99999966
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222222,0x22222227,0x22227777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x77772222,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x22777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x77222222,0x77777722,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777770,0x77777770,0x77110000,0x01110000,0x01110000,0x11110000,0x11110000
-	.word 0x07777777,0x07777777,0x07777777,0x00010077,0x00110000,0x00000000,0x00000001,0x00000001
-	.word 0x77777110,0x77771110,0x77771110,0x00001110,0x01101110,0x01001110,0x01111110,0x01111110
-	.word 0x07777777,0x00077777,0x00000077,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x10000000,0x10000000,0x10000000,0x10100000,0x11100000,0x00000000,0x00000000,0x00000000
-	.word 0x00000001,0x00000001,0x00000001,0x00000001,0x00000001,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22227777,0x77777777,0x44777777,0x44477777,0x74477777
-	.word 0x22222222,0x22222222,0x22222222,0x77772222,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x22222222,0x22222222,0x22222222,0x22777777,0x77777777,0x74477777,0x74447777,0x77447777
-	.word 0x22222222,0x22222222,0x22222222,0x77777722,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777770,0x77777770,0x77001000,0x44001100,0x44400000,0x74400000,0x70000000
-	.word 0x77777744,0x77777444,0x17777447,0x10000077,0x11110007,0x00010007,0x00000007,0x00000007
-	.word 0x77777077,0x47770077,0x47770001,0x77000001,0x77000001,0x74400000,0x74440000,0x77440000
-	.word 0x07777777,0x01177774,0x01100044,0x01101044,0x01111000,0x00000000,0x00000000,0x00000000
-	.word 0x70000000,0x70000000,0x70000000,0x44000000,0x44400000,0x74400000,0x70000000,0x70000000
-	.word 0x00000044,0x00000444,0x00000447,0x00000007,0x00000007,0x00000007,0x00000007,0x00000044
-	.word 0x47000000,0x47000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000004,0x00000044,0x00000044,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000000CC,0x000000CC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x000000CC,0x00000CCC,0x000CCCCC,0x0CCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCC00CC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x000000CC,0x0000CCCC,0x000CCCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xCC000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0CCCCCCC,0xCCCCCCCC,0xCCCCCCC0,0xCCCCC000,0xCCC00000,0xCC000000,0x00000000,0x00000000
-	.word 0x00000000,0x0000000C,0x000000CC,0x0000CCCC,0x00CCCCCC,0x0CCCCCCC,0xCCCCCCCC,0xCCCCCC00
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x0000000C,0x00000CCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xCC000000,0xCC000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xCC000000,0xCCCC0000,0xCCCCC000
-	.word 0xCC000000,0xCCC00000,0xCCCCC000,0xCCCCCCC0,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCC00CCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0xC0000000,0xCCC00000
-	.word 0x00000000,0xC0000000,0xCC000000,0xCCCC0000,0xCCCCCC00,0xCCCCCCC0,0xCCCCCCCC,0x00CCCCCC
-	.word 0xCCCCCCC0,0xCCCCCCCC,0x0CCCCCCC,0x000CCCCC,0x00000CCC,0x000000CC,0x00000000,0x00000000
-	.word 0x000000CC,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAA0,0xAAAAAAA0,0xAA0AAAA0,0x00000000,0x00000000,0x00000000,0xAA000000,0xCCCC00CC
-	.word 0x0AAAAAAA,0xAA00AAAA,0xAAA000AA,0xAAAAA000,0xAAAAAAA0,0xAAAAAAAA,0x0AAAAAAA,0x000ACCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0x00AAAAAA,0x0000AAAA,0x000000AA,0x0000000A,0x00000000,0x00000000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x0CCCCCCC,0x000CCCCC,0x00000CCC,0x000000CC,0x000000CC
-	.word 0x0000CCCC,0x000000CC,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00
-	.word 0x88888888,0x88888888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAA0,0x00AAAAA0,0x000AAAA0,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAA00,0xAAAA0000,0xAA000000,0xA0000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAAA00AA,0x00000AAA,0x000AAAAA,0x0AAAAAAA,0xAAAAAAAA,0xAAAAAAA0,0xCCCCA000
-	.word 0x00AAAAAA,0x000AA0AA,0x00000000,0x00000000,0x00000000,0x00000000,0x000000AA,0xCC00CCCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xCCCC0000,0xCC000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC0,0xCCCCC000,0xCCC00000,0xCC000000,0xCC000000
-
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x53555585,0x55555585,0x55555585,0x55555585
-	.word 0x55555555,0x55558888,0xCC588555,0x66585555,0x66585555,0x69585555,0x69585555,0x99585555
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x55555555,0x53555555,0x555CCCCC,0x55C99999,0x55999999,0x55999999,0x55999999,0x55999999
-	.word 0x55555585,0x55555585,0x55555885,0x55555885,0x55555885,0x55555885,0x55555585,0x55555585
-	.word 0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x99585555,0x66585555
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x66999999,0x99999999,0x99999999,0x99999999
-	.word 0x55999999,0x55999999,0x55999996,0x55999966,0x55999666,0x55966666,0x55666669,0x55666999
-
-	.word 0x55555585,0x55555585,0x55555585,0x35555585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x66585555,0x66585555,0x69585555,0x69585555,0x99585555,0x99588555,0x55558888,0x55555555
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x55555555,0x55555555
-	.word 0x55699999,0x55999999,0x55999999,0x55999999,0x55999999,0x55599999,0x53555555,0x55555555
-	.word 0x55555555,0x88888885,0x55555585,0x55555585,0x55555585,0x55535585,0x55555585,0x55555585
-	.word 0x55555555,0x88888888,0x88555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x88888888,0x55555588,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58553555,0x58555555,0x58555555,0x58555555
-
-	.word 0x55555585,0x55555885,0x88888855,0x55555555,0xCCCCC555,0x99999C55,0x99999955,0x99999955
-	.word 0x55555555,0x55555555,0x88888888,0x55555555,0xCCCCCCCC,0x99966666,0x99666669,0x66666999
-	.word 0x55555555,0x55555555,0x88888888,0x55555555,0xCCCCCCCC,0x99999999,0x99999999,0x99999999
-	.word 0x58555555,0x58855555,0x55888888,0x55555555,0x555CCCCC,0x55C66666,0x55666669,0x55666999
-	.word 0x99999955,0x99999655,0x99996655,0x99966655,0x99666655,0x96666555,0x55555535,0x55555555
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x55555555,0x55555555
-	.word 0x99999996,0x99999666,0x99996666,0x99966666,0x99666666,0x96666699,0x55555555,0x55555555
-	.word 0x55699999,0x55999999,0x55999999,0x55999999,0x55999999,0x55599999,0x53555555,0x55555555
-
-	.word 0x55555555,0x55555535,0xCCCCC555,0x99999C55,0x99999655,0x99996655,0x99966655,0x99666655
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x55555555,0x88885555,0x555885CC,0x55558596,0x55558566,0x55558566,0x55558566,0x55558566
-	.word 0x55555555,0x58888888,0x58555555,0x58555555,0x58555553,0x58555555,0x58555555,0x58555555
-	.word 0x96666655,0x66669955,0x66699955,0x66999955,0x66999955,0x99999955,0x99999955,0x99999955
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x99999666,0x99966666,0x99666669,0x66666999
-	.word 0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599,0x55558599
-	.word 0x58555555,0x58555555,0x58855555,0x58855555,0x58855555,0x58855555,0x58555555,0x58555555
-
-	.word 0x99999955,0x99999655,0x99996655,0x99966655,0x99666655,0x96666555,0x55555535,0x55555555
-	.word 0x66699999,0x66999999,0x69999999,0x69999999,0x99999999,0x99999999,0x55555555,0x55555555
-	.word 0x55558596,0x55558566,0x55558566,0x55558566,0x55558566,0x55588599,0x88885555,0x55555555
-	.word 0x58555555,0x58555555,0x58555555,0x58555535,0x58555555,0x58555555,0x58888888,0x55555555
-	.word 0x55555555,0x55555535,0xCCCCC555,0x99999C55,0x99999655,0x99996655,0x99966655,0x99666655
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x66699999,0x66999999,0x69999999,0x69999999,0x99999999
-	.word 0x55555555,0x55555555,0xCCCCCCCC,0x99999996,0x99999666,0x99996666,0x99966666,0x99666666
-	.word 0x55555555,0x53555555,0x555CCCCC,0x55C99999,0x55999999,0x55999999,0x55999999,0x55999999
-
-	.word 0x96666655,0x66669955,0x66699955,0x66999955,0x55555555,0x88888855,0x55555885,0x55555585
-	.word 0x99999999,0x99999999,0x99999996,0x99999966,0x55555555,0x88888888,0x55555555,0x55555555
-	.word 0x96666699,0x66669999,0x66699999,0x66999999,0x55555555,0x88888888,0x55555555,0x55555555
-	.word 0x55999999,0x55999999,0x55999996,0x55999966,0x55555555,0x55888888,0x58855555,0x58555555
-	.word 0x55555585,0x55535585,0x55555585,0x55555585,0x55555585,0x55555585,0x88888885,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88555555,0x88888888,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555588,0x88888888,0x55555555
-	.word 0x58553555,0x58555555,0x58555555,0x58555555,0x58555555,0x58555555,0x58888888,0x55555555
-
-	.word 0x00000000,0x00000000,0x55000000,0x55000000,0x55000000,0xAA000000,0xAA000000,0xAA000000
-	.word 0x00000000,0x00000000,0x00055555,0x00055555,0x00055555,0x000AAAAA,0x000AAAAA,0x000AA000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAA000000,0xAA000000,0xAA000000,0xAA000000,0xAA000000,0xAA555555,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x000AA0D0,0x000AA0D0,0x000AA0D0,0x000AA000,0x000AACCC,0x000AACCC,0x000AACCC,0x000AAAAA
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAA000AAA,0xAA0000AA,0xAA00000A,0x0A000000,0x00000000,0x00000000
-	.word 0x0000AAAA,0x00000AAA,0x000000AA,0x0000000A,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x55555000,0x55555000,0x55555000,0xAAAAA000,0xAAAAA000,0x000AA000
-	.word 0x00000000,0x00000000,0x00000055,0x00000055,0x00000055,0x000000AA,0x000000AA,0x000000AA
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x0D0AA000,0x0D0AA000,0x0D0AA000,0x000AA000,0xCCCAA000,0xCCCAA000,0xCCCAA000,0xAAAAA000
-	.word 0x000000AA,0x000000AA,0x000000AA,0x000000AA,0x000000AA,0x555555AA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAA0000,0xAAA00000,0xAA000000,0xA0000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAA000AA,0xAA0000AA,0xA00000AA,0x000000A0,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x000000CC,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0x00000000,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0x00000000,0xCCCCCCCC,0xCCCCCCCC,0x1CCC1CCC,0x1CCC1CCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xCCC00000,0xCCCCCCCC,0xCCCCCCCC,0xCCCC1CCC,0xCCCC1CCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC
-	.word 0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC
-
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCC11,0x11111111,0x11111100
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCCCC,0x11111111,0x11111111
-	.word 0xACCCACCC,0xACCCACCC,0xACCCACCC,0xACCCACCC,0xCCCCCCCC,0xCCCCCCCC,0x11111111,0x11111111
-	.word 0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCACCC,0xCCCCCCCC,0x111CCCCC,0x11111111,0x00011111
-	.word 0xEEEEEEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAA0,0xAAAAAAA0
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEEAAAAAA,0xEE55AAAA,0xAAA585AA,0xAAAAA55A,0x11BAAA5A
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAAAAEEEE,0xAAEEEAAA,0xAEEAAAAA,0xAEAAAB11
-	.word 0xEEEEEEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x0AAAAAAA,0x0AAAAAAA
-
-	.word 0xAAAAAAA0,0xAAEEEEA0,0xAEAAAAE0,0xAAABBAA0,0xAABDDBA0,0xAABDDBAA,0xAAABBAAA,0xAAAAAAAA
-	.word 0x1111AAAE,0xDD11BAAE,0xDDD11AAA,0xDDD11AAA,0xDDD11AAA,0xDD11BAAA,0x1111AAAA,0x11BAAAAA
-	.word 0xEAAA1111,0xEAAB11DD,0xAAA11DDD,0xAAA11DDD,0xAAA11DDD,0xAAAB11DD,0xAAAA1111,0xAAAAAB11
-	.word 0x0AAAAAAA,0x0AEEEEAA,0x0EAAAAEA,0x0AAAAAAA,0x0ABDDBAA,0xAABDDBAA,0xAAABBAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAA0000,0x0AAAA000,0x00AAAA00,0x000AAAA0,0x0000AAA0,0x00000AAA,0x000000AA
-	.word 0xAAAAAAAA,0xAAAAA000,0xAA000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0xA00AAAAA,0x000000AA,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAAAAAAA,0x00000AAA,0x0000AAAA,0x000AAAA0,0x00AAAA00,0x00AAA000,0x0AAA0000,0x0AA00000
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x54455555,0x55555555,0x54445555,0x54545555,0x54445555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55544444,0x55555555,0x55544444,0x55555555
-	.word 0x55555555,0xA5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555,0xE5555555
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0x5555555E,0x5555555E,0x5555555E,0x5555555E
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEE55555,0xEEE55555,0xEEE55555,0xEEE55555
-
-	.word 0x55555555,0xAAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEBE
-	.word 0xE5555555,0xEAAAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x5555555E,0x5555555E,0x5555555E,0x5555555E,0xAAAAAAAE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEE5B555,0xEEE55555,0xEEE55555,0xEEE55555,0xEEEAAAAA,0xEEEEEEEE,0xEEEEEEEE,0xEBEEEEEE
-	.word 0x555555AA,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xAA555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555
-
-	.word 0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555
-	.word 0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x555555CC,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCC555555,0xCC555555,0xCC555555,0xCC555555,0xCC555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x555555B5,0xBBBBBF55,0xCCCCBFF5,0xBCBCB555,0xBBCCB555,0xBBCBB555,0xBBCCB555
-	.word 0x55555555,0x55555555,0xBBBBBBBB,0xCCCCBBCC,0xCBBCCCCB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55555555,0x55555555,0xBBBBBBBB,0xBBCCCCBB,0xCCCBBCCC,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55555555,0xFF555555,0x55BBBBBB,0x55BCCCCC,0x55BCBCBC,0x55BCCBBB,0x55BCCBBB,0x55BBCBBB
-	.word 0xBBBCB555,0xBBCCB555,0xBBCBB555,0xBBCCB555,0xBBBCB555,0xBBCCB555,0xBBCBB555,0xDBCCB555
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBD
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x55BCCBBB,0x55BCBBBB,0x55BCCBBB,0x55BBCBBB,0x55BCCBBB,0x55BCBBBB,0x55BCCBBB,0x55BBCBBB
-
-	.word 0x4BBCB555,0x4BCCB555,0x4BBCB555,0x4CCCB555,0xBBBBBFF5,0x55555555,0x55555555,0x55555555
-	.word 0x66666BD4,0x6B6B6B44,0xCCBBCC4D,0xBCCCCB44,0xBBBBBBBB,0x55555555,0x55555555,0x55555555
-	.word 0xBBBABBBB,0xB6BBBBBB,0xC66CBBCC,0xCBBCFCCB,0xBBBBDBBB,0x55555555,0x55555555,0x55555555
-	.word 0x55BCCBBB,0x55BCCDDB,0x55BCBDDB,0xF5BCCDDC,0x5FBBBBBB,0x55555555,0x55555555,0x55555555
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x002000F0,0x00008355,0x88888885,0x20071085
+	.word 0x40537B03,0x10033007,0x881E0000,0x0E402510,0x1000E0CF,0xF058881F,0x101F8017,0x7F03301D
+	.word 0x40074035,0x006B6003,0x8003A00D,0xFF00F07F,0x00F000F0,0x6B400060,0x7FC061D0,0xF320FBD0
+	.word 0x3000F0FF,0xF01D1000,0x00EF601F,0xF01F8059,0x0300C3FB,0x99993151,0x03006999,0x96520020
+	.word 0x00660300,0x10666604,0x00AF9603,0x07206603,0x40101069,0x40221004,0x3760FF33,0x3FF03FF0
+	.word 0x3F403FF0,0x31202010,0x10FF1B60,0x2000E003,0x805F605B,0xF03FF053,0xFF3FF03F,0xB3F03F60
+	.word 0x53600840,0x0050B3F0,0x3FF01410,0x103F90FD,0x903FF022,0x00C8218F,0x00F0AA00,0xF00020ED
+
+	.word 0x0A00A01F,0x00701FF0,0xA53FF000,0x60A000E0,0xF3AA0A03,0x4210009D,0x03500A7E,0x21301DF0
+	.word 0x00F00330,0x3F003F40,0x3AF0A0AA,0x00F000F0,0x00F000F0,0xF0F000F0,0x7000F000,0xCC346300
+	.word 0x0155CCCC,0x55EEEEEE,0xA033333E,0x1E70A007,0xEE0E00CC,0xE3333333,0xD00790EF,0x3336001F
+	.word 0x5ED00790,0x07A03600,0xC06FE0FF,0xD06FD007,0xD06FD007,0xF06FD007,0x77F0FF7F,0x77F0F790
+	.word 0x77F0F7B0,0x77F0F7B0,0x40B07740,0x00F0BB00,0xBBBB00F0,0xBB24BBDD,0xDD0300DB,0xDD0600DD
+	.word 0xEDDD20BB,0xDDDE0300,0x20DDDEEB,0x00D0DDEE,0xEDDDDEEE,0x40EE48EE,0x40EEDE03,0xBDDDBB3C
+	.word 0xBB3D209C,0x000800EE,0xDE0B0022,0xEDDE00BB,0xEEEBBDEE,0xEB61EEED,0x03809000,0xDEEEEBDE
+	.word 0xED310310,0x100F00BB,0xDDEDDE43,0x00FE0900,0x0038002D,0x407D0076,0x00080000,0x00A3BD1E
+
+	.word 0x1B00BD84,0x00EDDDBD,0xC10B0003,0x70000380,0xDBBBEEEE,0x2C8700ED,0xC300EDDD,0x608E40DE
+	.word 0xD7DEED00,0xC810AB30,0xED0400ED,0x00105F00,0x10FCF860,0x10B300EE,0xF1C32011,0xBB00F01B
+	.word 0x12F0DCBF,0x40FF0060,0xF5003003,0xDB4999FF,0xBF75BFF5,0x001A0094,0x03106903,0xF5FF63F5
+	.word 0xF5FFF50B,0xF0BFF5FF,0xF5BFF500,0x753FC0FF,0xF0034049,0x4404003F,0xF5493200,0xFFF5E0FF
+	.word 0xFFC5B3F0,0x96664949,0x3FF0FF49,0xFFF5FFF5,0x91F40300,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0x3000F0D4
+	.word 0x00402200,0x77030027,0x0310FF77,0x1F5000B0,0x1DD00030,0x0E101FB0,0x70E81FF0,0x303EF01E
+	.word 0x03407000,0xAD110000,0x40010310,0x03101103,0x60071600,0x00005E03,0x16000016,0x09100000
+
+	.word 0x0E100310,0x10777771,0x03302500,0x36110F00,0x07000110,0x20110300,0x073B3003,0x58000075
+	.word 0x003000F0,0x10037010,0x30FF0310,0x50004060,0xF0039067,0xF000F000,0xE100F000,0x3F317F91
+	.word 0x77446161,0x03104777,0x7FF17473,0x7FF15FF1,0x42007447,0xB1E80310,0xB13EF0BF,0x2601107F
+	.word 0x15440011,0x10400000,0x9E007403,0xD2840070,0x51004920,0x10430117,0x07930107,0x070501B8
+	.word 0x03101C00,0x47773830,0x03209B01,0x03107700,0x10443B30,0x405E1003,0x013A0007,0x01100044
+	.word 0x10101B44,0xD15E0101,0x03807042,0x20C37BA0,0x0414107F,0x00470000,0xEF735003,0x1B100350
+	.word 0x40470000,0x0000F003,0xFB360000,0x2B402720,0x00F000F0,0x40CC0020,0xFB00F003,0x00F000F0
+	.word 0x00F000F0,0x000C6780,0xBF040003,0x190C2309,0x00006047,0x4031F011,0xFF040033,0x00F03310
+
+	.word 0x00F000F0,0x00F04EE0,0x93401C50,0x8E10C06F,0x00000400,0x1033D004,0xFF937085,0x3330B510
+	.word 0x00F00C20,0xBEF03370,0x00F000F0,0xF000F0FF,0xF000F000,0xF0E2F100,0xF000F000,0x00F0FF00
+	.word 0x2F515720,0x33010B10,0x43110B00,0xF0DF00B0,0xC000807F,0x0B406B41,0x8B415340,0x80FF4050
+	.word 0x0273010B,0xC04B1243,0x7000F0E4,0xFF1FFD00,0x1FF07FFD,0x1AF07FFD,0x00F07FFD,0x00807FFD
+	.word 0xEC10AA77,0x601D7B3D,0x200210A0,0x1F7B502B,0x100ACCCC,0x006E8062,0x9D380034,0x7FFDFF6D
+	.word 0x00B0A8C1,0xD36243A1,0x00F036F0,0xF0FF00F0,0xF100F000,0xF07FF17F,0xF07FF11F,0xFF7FF11F
+	.word 0x7F7100F0,0x23F15A01,0x4B603F41,0x0310E74E,0x61C1A07C,0x04101D2F,0x5730AF31,0x21FFA000
+	.word 0x407FF1BF,0xF0FFF244,0xD000F000,0xF2635300,0x1D3000F0,0xC3F40070,0x831DCC00,0x1F01B685
+
+	.word 0x30071085,0x0B805303,0x52880020,0x580C1088,0x66582B00,0xB4690340,0x9E990340,0x664BFBFF
+	.word 0xCC531F50,0x555CCC02,0x00C99999,0xA0DF9903,0x586B6003,0x7F6003C0,0x03F06310,0xFBF50340
+	.word 0x203FFCFF,0x55240067,0x00551800,0x0055572D,0xFA0B5532,0x70320055,0x7D03307F,0x010B6035
+	.word 0xF0BA3013,0x99A000F3,0xF0F81D50,0x510830F3,0xE0970017,0x599999F3,0x501321F7,0x007FC123
+	.word 0x7FC15303,0x71406D20,0x2200F0FA,0x9016F0E0,0x5551011F,0xF8350330,0x03400740,0x24107B51
+	.word 0xCCC52C20,0x9C553ECC,0x83B0AC80,0x7F9DE721,0x66CC1FF0,0x207CA1CC,0x50588567,0x6607125E
+	.word 0x61C66638,0x029CF17F,0x96666533,0x3F71357F,0x97803FFD,0x7FF17FF1,0x7FB17FF1,0x506B20FC
+	.word 0x828BD0F7,0x508BF0DF,0x57888887,0x964401CC,0xC0664C01,0x007FD103,0x7FA1FF74,0xB0008C22
+
+	.word 0x5B000C21,0xAC600340,0xCEFFBFFE,0xF06300FF,0x70037003,0x4061D36B,0xFF7FF117,0x7FF17FF1
+	.word 0xF3F07F71,0x50327700,0x6B602240,0x605300FF,0xF113410B,0xF17FF17F,0xF47FE17F,0x7FF4FF7F
+	.word 0x3E207FF4,0xB0417FD1,0x7FD18354,0x21FFEB92,0xE07FC41F,0x407FC41F,0x3375531F,0xFFEF837F
+	.word 0x00F07FF4,0x1FF06240,0x83901C50,0x7FD1EFC3,0x102A86F8,0x5603500B,0x559368E7,0x60FF0555
+	.word 0x06E73603,0xF0D7F6D3,0xD000F000,0xEE6B9000,0x96000320,0x00D09F67,0x10035063,0xAC7FCC6F
+	.word 0x83200370,0x00F000F0,0x7C7000F0,0x39FF4968,0x00C6173E,0xF0586016,0xF000F014,0xFD00F000
+	.word 0x00F000F0,0x00F000F0,0x004000F0,0xFFCB0150,0xD0380350,0xB1700300,0xDC81DCF1,0x00F000F0
+	.word 0x3000F0C6,0x0D0AA000,0x0F000380,0x70CC7FCA,0xF1342903,0xF0E081E0,0xF000F050,0x0090FF00
+
+	.word 0x1B0B4310,0x1D5097E9,0x10116850,0xE0FF2C30,0xF000F024,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xA0B500F0,0x0310CC00,0x401C0050,0x0170AC01,0xF02320FB
+	.word 0xF01FF01F,0xC01F401F,0x19001E60,0xAC0330BF,0x01F003A0,0x01F001F0,0x01F001F0,0xD00130F3
+	.word 0xB07FF06F,0x1011CC2D,0x7F000003,0xF0030000,0x1000301F,0xF000101F,0xE21FE01F,0x08316FB0
+	.word 0x00011D40,0xAA0000EE,0xAA00F09C,0xC00340A0,0x552B0000,0x85AA00EE,0xA55AAAA5,0x5A0AAAAA
+	.word 0xC011BAAA,0x4D20AA1C,0x042083EA,0xAAAB11AE,0x605FF0AE,0x100A7000,0x00672003,0xAAAAE022
+	.word 0xBAA000AE,0xDBA0AAAB,0xAA70AABD,0x0B000310,0xAAAE0010,0xAE011111,0xAADD11BA,0x0370D11A
+	.word 0x000F10F0,0x00240017,0xDDEAAAC3,0xEAAB0311,0xAAA11DDD,0x78000360,0x001D10E0,0xEE673006
+
+	.word 0xAAEA0AEE,0x200EAA27,0x10BDDB0B,0x105F6003,0x00002200,0xAAA00300,0xA006500A,0x0A1110BF
+	.word 0x5B020300,0xA4001F20,0xBDF20A10,0x201F30FF,0x701AF0C6,0x004B101F,0x405B1020,0x1910C708
+	.word 0x0AA00C00,0xF000F055,0xE200F000,0x00F000F0,0x455500F0,0x44073054,0x540700BB,0x07100300
+	.word 0x404400B0,0xAD075012,0x00A50040,0x03F0E503,0x21550320,0x0040BFFB,0x900F005E,0x001FD003
+	.word 0xB003C032,0x0090A71F,0x552F20BE,0xF05122E5,0xA66FF000,0xC0AE0300,0xB0B5554B,0xEB4AC06F
+	.word 0x3300AA5F,0x6003F0CC,0xF000F003,0xFF00F000,0x62F000A0,0x14F00380,0x00F07FF0,0x00F000F0
+	.word 0xF00060FF,0xF07FF056,0xF000F073,0xF000F000,0x5EF0D000,0x10B562E0,0xBBBBBF04,0x00BF40F5
+	.word 0xBCBCB58E,0x0ECCB555,0xCBB555BB,0x07000300,0x80BB0040,0xBBCC0000,0xCCCBCCCC,0x10CB7ABC
+
+	.word 0x9000500B,0xBB1E001F,0x90CC1E00,0xFF551FF0,0xCCCC0A10,0xBC4C55BC,0xCBBB5E00,0x1E000350
+	.word 0x30EDBCB5,0xB06F5067,0x4B90DB0F,0xF0BD00D0,0x00F0DD12,0x70BB6710,0x000FD06F,0x67004B6F
+	.word 0x200300CC,0x01F54C07,0xD41B9107,0x6666016B,0x6B6B6B44,0x74DA004D,0x90FC0044,0xBAF730F3
+	.word 0xCCB61210,0xC66CBB07,0x1B01FCCB,0x1FA0B100,0xDB670090,0xBD0300CD,0x14DC55BC,0x00F5BCCD
+	.word 0x1F905F2B
 
 	.section .rodata
 	.align	2
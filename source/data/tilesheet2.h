@@ -6,8 +6,8 @@
 //	tilesheet2, 1184x24@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 444 tiles Metatiled by 4x3 not compressed
-//	Total size: 512 + 14208 = 14720
+//	+ 444 tiles Metatiled by 4x3 lz77 compressed
+//	Total size: 512 + 2600 = 3112
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET2_H
 #define GRIT_TILESHEET2_H
 
-#define tilesheet2TilesLen 14208
-extern const unsigned int tilesheet2Tiles[3552];
+#define tilesheet2TilesLen 2600
+extern const unsigned int tilesheet2Tiles[650];
 
 #define tilesheet2PalLen 512
 extern const unsigned short tilesheet2Pal[256];
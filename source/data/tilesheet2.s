@@ -6,8 +6,8 @@
 @	tilesheet2, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2600 = 3112
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,101 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet2Tiles		@ 14208 unsigned chars
+	.global tilesheet2Tiles		@ 2600 unsigned chars
 	.hidden tilesheet2Tiles
 tilesheet2Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xAAA77777,0xAAAAAAAA,0xAAAAA4AA,0xAAAAAAAA,0x77AAAAAA,0x887AAAAA,0x888AAAAA,0x888AAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x77777777,0xCCCCC888,0xCCCCCC88,0x88CCCCC8
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x77777777,0x8888888C,0x88888888,0x88888888
-	.word 0x77777AAA,0xAAAAAAAA,0xA4AAAAAA,0xAAAAAAAA,0xAAAAAA77,0xAAAAA788,0xAAAAAC88,0xAAAAACC8
-
-	.word 0x888AAAAA,0xC88AAAAA,0xCC8AAAAA,0xCCCAAAAA,0xCCCAAAAA,0x8CCAAAAA,0x888AAAAA,0x888AAAAA
-	.word 0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888,0xC8888888
-	.word 0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC
-	.word 0xAAAAACCC,0xAAAAACCC,0xAAAAA8CC,0xAAAAA8CC,0xAAAAA888,0xAAAAA888,0xAAAAA888,0xAAAAA888
-	.word 0x888AAAAA,0x88AAAAAA,0xAAAAAAAA,0xAAA7777A,0xAA77AAAA,0xAA7AAAAA,0xAA7AAA4A,0xAAAAAAAA
-	.word 0xCCC88888,0xCCCC8888,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x888888CC,0x8888888C,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAA888,0xAAAAAA88,0xAAAAAAAA,0xA7777AAA,0xAAAA77AA,0xAAAAA7AA,0xA4AAA7AA,0xAAAAAAAA
-
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x8888888C,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0xC8888888,0xCC888888
-	.word 0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x888888CC
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0x88888888,0xCC888888
-	.word 0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x88888CCC
-	.word 0xAAAAAAAA,0x44444444,0x44444444,0x44444444,0x44444440,0x44444440,0x44444440,0x44444440
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4BB44444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0xBBBB4444
-	.word 0xAAAAAAA4,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x4444444B
-
-	.word 0x44444440,0x44444440,0x440B0B00,0x0B0BBBBB,0xBBBB000B,0x00000000,0x00000000,0xB0000000
-	.word 0xBBB44444,0xBBB44444,0xBBB44444,0xBBBBBBBB,0xBB2BB2BB,0xBBBBBBBB,0xBBBBBBBB,0x00BBBBBB
-	.word 0xBBBBBBBB,0x222BBBBB,0xBBBBBBBB,0xBBBBBBBB,0xB0BBBBBB,0xB0000BBB,0xB0000BBB,0xB0000B0B
-	.word 0x0BB0BBBB,0x0BB0BBBB,0x0BBBBBBB,0xBB00BBBB,0x0000BBBB,0x00000BBB,0x000000BB,0x000000BB
-	.word 0xB0000000,0xB0000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00BBBBBB,0x00BBBBBB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xB0000B0B,0xB0000B0B,0xB0000B0B,0xB000000B,0x0000000B,0x00000000,0x00000000,0x00000000
-	.word 0x000000BB,0x000000BB,0x000000BB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAA77777,0xAAAAAAAA,0xAAAAA4AA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0x77777AAA,0xAAAAAAAA,0xA4AAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAA7AA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAA7777A,0xAA77AAAA,0xAA7AAAAA,0xAA7AAA4A,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xA7777AAA,0xAAAA77AA,0xAAAAA7AA,0xA4AAA7AA,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999E9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99EE9999,0x99EE9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999E9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99EE9999,0x99EE9999,0x99999999,0x99999999
-
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8228888C,0x82888888
-	.word 0x88888888,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0xCCCCC888,0x8CCCCC88,0x888CCCCC,0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888
-	.word 0x8888888C,0x88888888,0x88888888,0xC8888888,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0xC8888888,0xCC888888,0xCCC88888,0xCCCCC888,0x8CCCCC88,0x888CCCCC
-	.word 0x88CCCCC8,0x8888CCCC,0x88888CCC,0x888888CC,0x888888CC,0x88888888,0x88888888,0x88882288
-
-	.word 0x88888CCC,0x888888CC,0x8888888C,0x8888888C,0x88888888,0x88888888,0xC8888888,0xCC888888
-	.word 0xC8288888,0xCC288888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x888888CC
-	.word 0x88888CCC,0x888888CC,0x2888888C,0x8888888C,0x88888888,0x88888888,0x88888888,0xCC888888
-	.word 0xC8888288,0xCCC88888,0xCCCC8888,0xCCCCC888,0xCCCCCC88,0x88CCCCC8,0x8888CCCC,0x88888CCC
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222222,0x22222221,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x11222222,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111110,0x11111110,0x11660000,0x06660000
-	.word 0x11111111,0x11111111,0x11111111,0x01111111,0x01111111,0x01111111,0x00060011,0x00660000
-	.word 0x11111111,0x11111111,0x11111111,0x11111660,0x11116660,0x11116660,0x00006660,0x06606660
-	.word 0x11111111,0x11111111,0x11111111,0x01111111,0x00011111,0x00000011,0x00000000,0x00000000
-
-	.word 0x06660000,0x66660000,0x66660000,0x60000000,0x60000000,0x60000000,0x60600000,0x66600000
-	.word 0x00000000,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006,0x00000006
-	.word 0x06006660,0x06666660,0x06666660,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11111122,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22221111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x11112222,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111110,0x11111660,0x11000660,0x00060660,0x00066660,0x00000000,0x00000000,0x00000000
-	.word 0x11011111,0x11001111,0x60000111,0x60000000,0x60000000,0x00000000,0x00000000,0x00000000
-	.word 0x11111111,0x11111111,0x11111116,0x11100006,0x00006666,0x00006000,0x00000000,0x00000000
-	.word 0x11111111,0x01111111,0x01111111,0x00111111,0x00060000,0x00660000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0xD9999999,0xDD999999,0xDDD99999,0xDDDD9999
-	.word 0xD9999999,0xDDDD9999,0xDDDDDD99,0xDDDDDDD9,0xD33DDDDD,0xDD33DDDD,0xDDDD3DDD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0x9999999D,0x9999DDDD,0x99DDDDDD,0x9DDD33DD,0xDDD333DD,0xDD3333DD,0xDD333DDD,0xDDDDDDDD
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999D,0x999999DD,0x99999DDD,0x9999DDDD
-	.word 0xDDDD9999,0xDDDDD999,0xDDDDDD99,0xDDD3DD99,0x3DDDDDD9,0x3DDD3DD9,0x3DDD33D9,0x33DD33D3
-	.word 0xDDDDDD33,0xDDDDDDDD,0x3DDDDDDD,0x3DDDDD33,0xDDD33333,0xDDD33333,0x3D333333,0xDD333333
-	.word 0xDDD3333D,0xD3333333,0x33333333,0x33333333,0x33333333,0x33333333,0x3DD3333D,0xDD3DD33D
-
-	.word 0x33D3D33D,0x33D3333D,0x33333333,0x33333333,0x33333333,0x3DD33333,0xDDD33333,0xDD3D3333
-	.word 0x9999DD33,0x999DD333,0x99DDD333,0x99DDD333,0x9DDD3333,0x9DD33333,0x9DD3DDDD,0xDDD3DDDD
-	.word 0x33DD3333,0x33DD3333,0x33DD3333,0x3DDD3333,0x3DD33333,0x3DD33333,0x33333333,0x3DD33333
-	.word 0x33333333,0x33333333,0x33333333,0xD3333333,0xD3333333,0xDD333333,0xDD333333,0xDDDD3333
-	.word 0xDD3333DD,0xD33333DD,0xDD33333D,0xDDDDDD33,0xDDDDD333,0xD3333333,0xDD3333DD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0xDDDDDD33,0xDDDDD333,0xDDDDDD33,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0x33D33333,0x33333339,0x33333339,0x33333339,0x33333399,0x33333399,0x333DD999,0x33DD9999
-
-	.word 0xDDD33333,0xD33DD333,0xDDDDD333,0xDDDDD333,0xDD333333,0xD3333333,0x33333333,0x33333333
-	.word 0xD3333DDD,0xD333DDDD,0x333DDDD3,0x33333333,0x33333333,0x33D3333D,0x33DD3333,0xDDDDD33D
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDD33,0xDDDDDD33,0xDDDDDD33,0xDDDDDDDD
-	.word 0xDDDDDDDD,0x9DDDDDDD,0x9DDDDDDD,0x9DDDDDDD,0x99DDDDDD,0x99DDDDDD,0x999DDDDD,0x9999DDDD
-	.word 0xDDDD9999,0xDDD99999,0xDD999999,0xD9999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x33333333,0xD333333D,0xDDD333D3,0xDDDDDD3D,0xDDDDDDD9,0xDDDDDD99,0xDDDD9999,0xD9999999
-	.word 0xDDDD33DD,0x3D33333D,0xDD33333D,0xDDD333DD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD
-	.word 0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0xDDDDDDDD,0x9DDDDDDD,0x99DDDDDD,0x9999DDDD,0x9999999D
-
-	.word 0x9999DDDD,0x99999DDD,0x999999DD,0x9999999D,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000044,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x00000000,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x00000000,0x44444444,0x44444444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x44400000,0x44444444,0x44444444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444,0x64446444
-	.word 0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444,0x44446444
-
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444466,0x66666666,0x66666600
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444444,0x66666666,0x66666666
-	.word 0x64446444,0x64446444,0x64446444,0x64446444,0x44444444,0x44444444,0x66666666,0x66666666
-	.word 0x44446444,0x44446444,0x44446444,0x44446444,0x44444444,0x66644444,0x66666666,0x00066666
-	.word 0x55555555,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBB0,0xBBBBBBB0
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x55BBBBBB,0x5555BBBB,0xBBB585BB,0xBBBBB55B,0x666BBB5B
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBB55,0xBBBB5555,0xBB555BBB,0xB55BBBBB,0xB5BBB666
-	.word 0x55555555,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x0BBBBBBB,0x0BBBBBBB
-
-	.word 0xBBBBBBB0,0xBB5555B0,0xB5BBBB50,0xBBB66BB0,0xBB6336B0,0xBB6336BB,0xBBB66BBB,0xBBBBBBBB
-	.word 0x6666BBB5,0x33666BB5,0x33366BBB,0x33366BBB,0x33366BBB,0x33666BBB,0x6666BBBB,0x666BBBBB
-	.word 0x5BBB6666,0x5BB66633,0xBBB66333,0xBBB66333,0xBBB66333,0xBBB66633,0xBBBB6666,0xBBBBB666
-	.word 0x0BBBBBBB,0x0B5555BB,0x05BBBB5B,0x0BB66BBB,0x0B6336BB,0xBB6336BB,0xBBB66BBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBB0000,0x0BBBB000,0x00BBBB00,0x000BBBB0,0x0000BBB0,0x00000BBB,0x000000BB
-	.word 0xBBBBBBBB,0xBBBBB000,0xBB000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0xB00BBBBB,0x000000BB,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0x00000BBB,0x0000BBBB,0x000BBBB0,0x00BBBB00,0x00BBB000,0x0BBB0000,0x0BB00000
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xBCCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC,0x5CCCCCCC
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0x555CCCCC,0x555CCCCC,0x555CCCCC,0x555CCCCC
-
-	.word 0xCCCCCCCC,0xBBBBBBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x555555B5
-	.word 0x5CCCCCCC,0x5BBBBBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xCCCCCCC5,0xBBBBBBB5,0x55555555,0x55555555,0x55555555
-	.word 0x555CBCCC,0x555CCCCC,0x555CCCCC,0x555CCCCC,0x555BBBBB,0x55555555,0x55555555,0x5B555555
-	.word 0xCCCCCCBB,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xBBCCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC
-
-	.word 0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC
-	.word 0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCC44,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0x44CCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCBC,0x77777ECC,0xBBBB7EEC,0x7BAB7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0x77777777,0xBBBB77BB,0xB77BBBB7,0x77777777,0x77777777,0x77777777
-	.word 0xCCCCCCCC,0xCCCCCCCC,0x77777777,0x77BBBB77,0xBBB77BBB,0x77777777,0x77777777,0x77777777
-	.word 0xCCCCCCCC,0xEECCCCCC,0xCC777777,0xCC7BBBBB,0xCC7BAB7B,0xCC7BB777,0xCC7BB777,0xCC77B777
-	.word 0x777B7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC,0x777B7CCC,0x77BB7CCC,0x77B77CCC,0x77BB7CCC
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0xCC7BB777,0xCC7B7777,0xCC7BB777,0xCC77B777,0xCC7BB777,0xCC7B7777,0xCC7BB777,0xCC77B777
-
-	.word 0x177B7CCC,0x77BB7CCC,0x7BAB7CCC,0xBBBB7CCC,0x77777EEC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x77DDDD71,0x77D77D79,0xBB77BBB9,0x7BBBB779,0x77777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x77777777,0x777779E7,0xBBEB7EEB,0xB7EBBBB7,0x77777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCC7BB799,0xCC7BB799,0xCC7BAB99,0xEC7BBB99,0xCE777777,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x002000F0,0xA7771677,0xA40020AA,0x00000630
+	.word 0xAAAA0177,0xAAAA887A,0xA003408A,0x007700B0,0xCCC88800,0xCC1888CC,0x0610CCCC,0x77771FF0
+	.word 0x7088478C,0x777AAA00,0x61704F00,0x88410C10,0xAC887200,0x00C8AAAA,0x6740A103,0xCC0300C8
+	.word 0x50CAAAAA,0x508C6703,0x8862007F,0x005000CC,0xB2032006,0x80C800C0,0xC81E0007,0x8C9B40CC
+	.word 0x300200F5,0x20630037,0x0330A803,0xD803C088,0xC720E340,0x100B217A,0x4AAA7AA1,0x100300FF
+	.word 0x00532000,0x50E7D050,0x10931000,0x19F0FEEF,0x67200030,0x60100C50,0x66105E10,0x0F31FFA7
+	.word 0x4F40AFE0,0xEFB04391,0x83518F30,0xB0FF3FF0,0xF047C03F,0xE14BB13F,0xF10A3043,0xFF00F083
+
+	.word 0x3FF03FF0,0xB3F03FF0,0xB3F04FD0,0x3FF05360,0xF000D0FA,0x003F903F,0x44831130,0xE6400080
+	.word 0x00F003C0,0x4BB40090,0x009013F0,0x11BB7CBB,0x3017F0E4,0x503C1000,0x400B0067,0x0B2D000B
+	.word 0xBB000B0B,0x9E83ACBB,0xBB6300B0,0x00200350,0x30F22BB2,0x00003007,0x2B00102D,0xB0138022
+	.word 0x000BBB1A,0x4C000320,0x0B0E00B0,0xBB0330B2,0x2E100300,0x1B000000,0x6410DF00,0x40B06840
+	.word 0x1000F003,0xF0345023,0x0020FF00,0x03606310,0x03004700,0x03803FB0,0xF4FF00F0,0xF000F07F
+	.word 0xF000F000,0xC4006000,0xFF00207F,0x00F07240,0x00F000F0,0x00F000F0,0x00F000F0,0xF400F0FF
+	.word 0xF000F07F,0xF000F000,0xC4608000,0xF0997F7F,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x40B700F0,0x12F09E00,0x40EE0060,0xF000F003,0x00F0F33F
+
+	.word 0xBFF53FD0,0x8228CB54,0x03100600,0xF5BFF5FF,0xF53FF0FF,0xF53FF0FF,0xF5BFF5FF,0x00F0F1BF
+	.word 0x3FF03FF0,0x88883FF0,0xADBFF522,0x00284FF0,0xBFF52807,0xF528FFF5,0x1A00BFFF,0x90F3F082
+	.word 0xF091F493,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xD400F000,0x003000F0,0x21004022,0x11110300,0xB00310FF,0x301F5000
+	.word 0xB01DD000,0xF00E101F,0x1E70E81F,0x00F03EF0,0x00034010,0x10A96600,0x1EC00603,0x00036001
+	.word 0x25BD0006,0x1C900066,0x03001660,0x04035066,0x66600000,0x113FF060,0x00006B01,0x66008058
+	.word 0x00664800,0x2F03102D,0x03706000,0x10031060,0xF0692013,0x0330C303,0x60062100,0x03206666
+	.word 0xF0FF5DF1,0xF17FF100,0xF13FF13F,0xF11FF07E,0xE5BFF1BF,0x6B113FF0,0x00063721,0x00060300
+
+	.word 0xC6B0FECF,0x06106E31,0x1F901B91,0x42000030,0x00060F11,0x45611110,0xB7511FB0,0x21FF3541
+	.word 0xF000F056,0xF000F000,0xF000F000,0xCB00F000,0x1FF60040,0x0300D999,0x000600DD,0x00DD7003
+	.word 0x000F1003,0xDDDDDD07,0x030080D9,0xD33DDDDD,0xF733DDDD,0x0C200600,0x00C000F0,0x204C109D
+	.word 0x07420049,0xDD9DDD33,0x103E1033,0xFF03003F,0x00C01410,0x03102F20,0x1D300800,0x78000500
+	.word 0xD34030A2,0xD93D8310,0x3303003D,0x338800B9,0x00504920,0x333D5110,0x30BB5F00,0x0B003303
+	.word 0x0B302400,0xA00300D3,0x17008900,0x00D33D3D,0x10D3D348,0x1DC0A80B,0x3D4740D3,0x9999B200
+	.word 0x9DD32E33,0x30DD0300,0x00C30003,0xDD3F9D1B,0x100320DD,0x50661080,0x40371003,0x4750FF03
+	.word 0x034058B0,0xB5003040,0x28300410,0x41FF5511,0xF17C201E,0x7000F04C,0x301AF033,0x786E001F
+
+	.word 0x50500039,0x30C00003,0x333DD903,0x305B01DF,0x4A01D36A,0x7B304310,0x40212FA1,0xD31900BF
+	.word 0x3B71DA10,0x09122620,0x03708FF0,0x800692FF,0x01CA3103,0x22DF61E0,0x12F6216B,0x00A0FF7B
+	.word 0x7F006F30,0x72128600,0x40208312,0x22FF9B42,0x1122008A,0xF0C0203F,0x3092E200,0xFF6B4242
+	.word 0x6B124910,0x00F07B42,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF4FF0050,0xF000F091,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FD,0xF000F000,0x3000F000,0x03104400,0x640050BF,0x232001F0,0x1FF01FF0
+
+	.word 0x1F401FF0,0x1E60407F,0x03F00F00,0x01F033F0,0x01F001F0,0x5001F0F9,0xF073F001,0x442D907F
+	.word 0xBF031066,0x00000000,0x301FF003,0x101F1000,0xF11FF000,0x6FB01FE0,0x1D400831,0x00550006
+	.word 0xF0BB4F00,0x40B0BB00,0x0000C003,0x002F002B,0x5BBBB585,0x5BBBBBB5,0x666BBB1E,0x1D101CC0
+	.word 0x04201800,0xB6660DB5,0x5FF0B5BB,0x100B0060,0x6720C003,0xBB502200,0x6BB0B5BB,0xB0BBB601
+	.word 0xBBBB6336,0x00C00310,0xB500100B,0xB56666BB,0x3366076B,0x80366BBB,0x000F0003,0x2400C017
+	.word 0x5BBBC300,0x5BB66633,0xB663330F,0x000360BB,0x001D1078,0x67308006,0x5B0B5555,0xBC05BBBB
+	.word 0x000B5300,0x6003105B,0x0000105F,0x03008A00,0x500BBBB0,0x1110B006,0x0300FF0B,0x1F205B02
+	.word 0x0A10A400,0x1F30BDF2,0xF0FFC620,0x101F701A,0x1020004B,0x1008405B,0x1F0C0019,0xF0CC0BB0
+
+	.word 0xF000F000,0xF000F000,0x00F0FA00,0x00F000F0,0x001000F0,0x5C0300BC,0x2003F0DB,0xFB21CC03
+	.word 0x00C50040,0xFF03900F,0x32001FD0,0x1FB003C0,0x3C120090,0x51226310,0xF000F0F9,0x0203006F
+	.word 0xCC4BA096,0x976FB0BC,0xBB5B4AC0,0xF0443300,0xF0036003,0x00F0FF00,0x00A000F0,0x038062F0
+	.word 0x7FF014F0,0xF0FF00F0,0x6000F000,0xF056F000,0xF073F07F,0xF800F000,0x00F000F0,0x62E05EF0
+	.word 0x7ECC5C12,0xEC770077,0xCCBBBB7E,0x7B00AB7C,0x77BB7CCC,0xE8B77CCC,0x07000300,0x00770040
+	.word 0xBB77BB00,0xBBB7BB07,0x0B10B77B,0x1F900050,0x771E00A9,0xF0BB1E00,0x10EECC1F,0xBBBB040A
+	.word 0x007BCC7B,0xCFB7775E,0x1E000350,0x67307B7C,0x0FC06F50,0xF0F700F0,0x8000F000,0x77671000
+	.word 0x0FD06F70,0x17666F00,0xF7206F30,0x0701ECBB,0x00711B91,0x7977DDDD,0xB977D77D,0x79DA00B8
+
+	.word 0xF390FC00,0x79E7F750,0xEB770B77,0x1B01EB7E,0x901B21EB,0x0099701F,0x00032067,0x7BBB995E
+	.word 0x1E00A0EC,0x001F90CE
 
 	.section .rodata
 	.align	2
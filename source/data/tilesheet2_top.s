@@ -6,8 +6,8 @@
 @	tilesheet2_top, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2336 = 2848
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,91 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet2_topTiles		@ 14208 unsigned chars
+	.global tilesheet2_topTiles		@ 2336 unsigned chars
 	.hidden tilesheet2_topTiles
 tilesheet2_topTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x33330000,0x33333300,0x33333330,0x33333330,0x33333330,0x33333310,0x33333300
-	.word 0x00000000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000333,0x00003333,0x00033333,0x30033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00333333,0x03333333,0x03333333,0x03333333
-
-	.word 0x33333300,0x33333330,0x33333330,0x33333330,0x33333330,0x33333330,0x33333310,0x33333100
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x66633333,0x63633333,0x31333333,0x33333333
-	.word 0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333,0x03333333
-	.word 0x33333000,0x33111000,0x11000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333311,0x33333100,0x33331000,0x33310000,0x11100000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x31111111,0x10000000
-	.word 0x01333333,0x00333333,0x00333333,0x00333333,0x00133333,0x00013333,0x00001333,0x00000111
-
-	.word 0x33333331,0x33333330,0x33333310,0x33333100,0x33331000,0x33330000,0x33310000,0x33300000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33666333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x13333333,0x03333333,0x01133333,0x00033333,0x00033333,0x00033333,0x00013333,0x00003333
-	.word 0x33100000,0x33000000,0x33000000,0x33000000,0x31000000,0x10000000,0x00000000,0x00000000
-	.word 0x33636333,0x33666333,0x33313333,0x33313333,0x33313333,0x33333333,0x33333310,0x11111100
-	.word 0x33333333,0x33333333,0x33333333,0x13333333,0x03333333,0x03333333,0x00113333,0x00001111
-	.word 0x00001133,0x00000013,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x30000000,0x33300000
-	.word 0x00000000,0x00000000,0x00000000,0x33330000,0x33333000,0x33333300,0x66633333,0x63633333
-	.word 0x00000000,0x33000000,0x33333000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33300000,0x33300000,0x33300000,0x33300000,0x33300000,0x33100000,0x00000000,0x00000000
-	.word 0x66633333,0x31333333,0x31333333,0x31333333,0x33333333,0x33333333,0x33333100,0x33331000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33310000,0x11100000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333331,0x33333110,0x33333000,0x33331000,0x33330000,0x11110000
-
-	.word 0x33333331,0x33331110,0x31110000,0x10000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33333110,0x33331000,0x33310000,0x33300000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33330000,0x33333000,0x33333300,0x33333100,0x33331000,0x33330000,0x11000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x00011113,0x00000001
-	.word 0x33366633,0x33363633,0x33366633,0x33331333,0x33331333,0x33333333,0x33333330,0x33333330
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33333310,0x33311100,0x33100000,0x11000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333330,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000033
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33000000,0x33000000,0x33300000,0x33300000,0x33330000,0x33330000,0x33333000,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x36663333,0x36363333,0x36663333,0x33133333,0x33133333
-	.word 0x00033333,0x00033333,0x00333333,0x00333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00033333,0x03333333,0x03333333
-
-	.word 0x33333330,0x33333330,0x33333310,0x33333100,0x33333000,0x33331000,0x33330000,0x33330000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33336663,0x33336363,0x33336663,0x33333133,0x33333133
-	.word 0x03333333,0x03333333,0x01133333,0x00033333,0x00013333,0x00001333,0x00000333,0x00000133
-	.word 0x33310000,0x33100000,0x31000000,0x33000000,0x33333300,0x33333300,0x33333300,0x33333100
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333133,0x33333333,0x33333333,0x33333333,0x33333333,0x13333333,0x03333333,0x33333333
-	.word 0x00000333,0x00003333,0x00003333,0x00001333,0x00000133,0x00000011,0x00000000,0x00003000
-
-	.word 0x33311000,0x33300000,0x33300000,0x33330000,0x33333000,0x33333300,0x33333300,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00333333,0x00333333,0x00333333,0x00333333,0x00333333,0x00333333,0x00133333,0x03333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x30000000,0x33000000,0x33333000,0x33333300,0x33333330,0x33333330,0x33333300,0x33333300
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33333300,0x33333330,0x33333330,0x33333330
-	.word 0x00000000,0x33000000,0x33000000,0x33300000,0x33333333,0x33333333,0x33366633,0x33363633
-	.word 0x33333330,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33300000,0x33330000,0x33333000,0x33333330
-	.word 0x33333330,0x33333330,0x33333300,0x33333330,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33366633,0x33331333,0x33331333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333331,0x33333310,0x33333300,0x33333100,0x33333000,0x33331000,0x33110000,0x33000000
-	.word 0x33333333,0x33333333,0x33333333,0x33666333,0x33636333,0x33666333,0x33313333,0x33313333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33000000,0x33000000,0x33000000,0x33000000,0x33000000,0x33300000,0x33330000,0x33333000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333000,0x33333000,0x33333000,0x33333300,0x33333300,0x33333330,0x33333330,0x33333330
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000333,0x00003333,0x00033333,0x00333333,0x03333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x36663333,0x36363333,0x36663333,0x33133333,0x33133333,0x33333333,0x33333333
-	.word 0x00033333,0x00333333,0x00333333,0x03333333,0x33333333,0x33333333,0x33333333,0x13333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000003,0x00000003,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x13333333,0x01133333,0x00011333,0x00000333,0x00000111
-	.word 0x01333333,0x00133333,0x00033333,0x00011111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x66633333,0x63633333,0x66633333,0x31333333,0x31333333,0x31333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11333333,0x00133333,0x00033333
-	.word 0x13333333,0x03333333,0x01333333,0x00133333,0x00013333,0x00001111,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11333333
-	.word 0x00013333,0x00003333,0x00033333,0x00333333,0x00333333,0x00333333,0x00011011,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x11133333,0x00011333,0x00000133,0x00000033,0x00000033,0x00000013,0x00000001
-	.word 0x00111111,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000033,0x00033333,0x03333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000033,0x30000033,0x30003333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x33330000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x66333333
-	.word 0x00000000,0x33000000,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333336
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x36333333,0x66333333,0x13333333,0x13333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333336,0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x11133333,0x00011111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33311133,0x31100011,0x10000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x13333333,0x01133333,0x00011111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33331111,0x33310000,0x31100000,0x10000000
-
-	.word 0x33333333,0x33333333,0x33333333,0x33666333,0x33636333,0x33666333,0x33313333,0x33313333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333636,0x33333666,0x33333313,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x11333333,0x00133333,0x00011333,0x00000333,0x00000111
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333311,0x33333100,0x11111000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x11113333,0x00001333,0x00000333,0x00000111,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333331,0x33111110,0x33000000,0x31000000,0x10000000
-	.word 0x00000000,0x00000333,0x00033333,0x00033333,0x00333333,0x03333333,0x03333333,0x00333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000033,0x00000033,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00003333,0x00033333,0x00033333,0x00033333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66333333,0x36333333,0x66333333,0x13333333,0x13333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333336,0x33333336,0x33333336,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00033333,0x00003333,0x00333333,0x03333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000003,0x00003333,0x00033333,0x03333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x63333333,0x63333333,0x63333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333363,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x13333333,0x03333333,0x03333333,0x01333333,0x00133333,0x00033333,0x00013333,0x00003333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333331,0x33333331,0x33333331,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00001333,0x00003333,0x00003333,0x00003333,0x00003333,0x00003333,0x00000333,0x00003333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00033333,0x00033333,0x00033333,0x00033333,0x00033333,0x00033333,0x03333333,0x03333333
-	.word 0x00000000,0x00000003,0x00000333,0x00003333,0x30033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x33000000,0x33300000,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000003,0x00000333,0x00033333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x33300000,0x33300000,0x33333000,0x33333330,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x63333333,0x63333333,0x63333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333366,0x33333363,0x33333366
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333331,0x33333331,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333636,0x33333666,0x33333313,0x33333313,0x33333313,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333666,0x33333636
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333666,0x33333313,0x33333313,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00440000,0x04400000,0x44000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x04000044
-	.word 0x00000000,0x00000000,0x00404000,0x00004440,0x00000020,0x00000000,0x00000000,0x00000040
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00004000,0x00004000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x44000022,0x40040000,0x00000000,0x44000000,0x24000000,0x00000000,0x40000000,0x00000000
-	.word 0x00000040,0x00044004,0x00042044,0x00040442,0x00000420,0x00000044,0x00000024,0x44440000
-	.word 0x00040000,0x00024400,0x00002440,0x00000244,0x00000000,0x00000000,0x00000000,0x00000044
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00400000,0x04400000,0x44000000,0x42000000,0x20000000,0x00000000,0x00000000
-	.word 0x44440000,0x44740000,0x44440000,0x44420000,0x22200004,0x00000402,0x00000200,0x00000000
-	.word 0x00000044,0x00000047,0x00000044,0x00000024,0x00000002,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x55335553,0x55355553,0x55355553,0x66355533,0x65155133,0x61111333,0x11555553
-	.word 0x33333333,0x33355533,0x33355553,0x33355553,0x33335553,0x33331551,0x33333111,0x33355555
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x53355533,0x53555533,0x53555533
-	.word 0x55555553,0x55155133,0x11155533,0x33113333,0x33333333,0x33555335,0x33555535,0x33555535
-	.word 0x33355555,0x33331551,0x33335551,0x33333311,0x33555333,0x35555333,0x35555333,0x35553333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x35553355,0x35555355,0x35555355,0x33555366
-	.word 0x63555333,0x61551333,0x61113333,0x15555533,0x55555533,0x51551333,0x11555333,0x31133333
-	.word 0x33355536,0x33315515,0x33331111,0x33555551,0x33555555,0x33315515,0x33355511,0x33333113
-	.word 0x15513333,0x11133333,0x55555333,0x55555333,0x15513333,0x15553333,0x11333333,0x33333333
-	.word 0x33155165,0x33311161,0x35555511,0x35555555,0x33155155,0x33555111,0x33331133,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x008000F0,0x00334B33,0x80303302,0x03001003
+	.word 0x30F61310,0x5000F01D,0x031F2000,0x03004120,0x0310FB03,0x1FA03E10,0x562069B0,0xD0035003
+	.word 0x7FA0B977,0xF06FF031,0x6300D000,0x7E030066,0x50080063,0xF06B603D,0x007F0003,0x102D006C
+	.word 0x11A71011,0xFB7017F1,0x578F4011,0x00980000,0x00000800,0x701BF134,0x11110D00,0x1E003111
+	.word 0x5101C610,0x0330A44A,0x01030013,0x00060000,0x10017F11,0x30EFB049,0xA163505F,0x1000F04A
+	.word 0x00F0D7EA,0x301300D0,0x870013EB,0x03409F21,0x218300DF,0x0510109D,0xB7200390,0x4A11FF60
+	.word 0x106720FE,0x400350A9,0xF0E400AF,0x115B516B,0x001E00F7,0x0003003F,0xEA0000EA,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0DF00,0x11300070,0x0112B09F,0x824F1213
+	.word 0x1850FF87,0x1FF3CAF1,0x662000F0,0x03B00722,0x40FFB321,0x209CF171,0xF04B4257,0xF07FF000
+	.word 0xFD00F000,0x005000F0,0x00F00B73,0x98101F73,0xFF931010,0xE3526F23,0x17102403,0x0B004502
+	.word 0x3FD077A2,0x6343A0FF,0xF054F183,0xF000F000,0xF100F0FF,0x9FD3F6D3,0x51F02F34,0x03130030
+	.word 0x33F312DC,0x33366607,0x03003633,0x1D130710,0x000310FF,0xF0E75400,0xF000F06F,0xF000F000
+	.word 0x3FF1FF00,0x73103F21,0x43427501,0x00F0B7F1,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF002000,0x19F0F951,0x12F0FB80,0xF76400F0,0xDF415B53,0xF26000FF,0x75CCF15D,0xF2E3654F
+	.word 0x3070D05F,0x2725FF2F,0x1FB3EFD6,0x00F057F2,0xF9560070,0x65FF11A4,0x36FF558F,0x25B3277B
+
+	.word 0x130B6294,0xFFA8967F,0x00F07FF7,0xFEB27184,0x72107740,0x77305151,0x627300EF,0x00410574
+	.word 0x7BA1D003,0x17416B53,0xF000F0FF,0xB100F000,0x5703F082,0xF09D1087,0x00F0FF00,0x00F000F0
+	.word 0xE58000F0,0xF763D760,0xF0FF0350,0xB200F000,0xD227A93C,0x420060C3,0xFF43F1AA,0xAEF01CC1
+	.word 0xAF90FFA2,0x67404BF0,0x00F0D784,0xD200F0FF,0xA26B6A3E,0xB09329FF,0xF0E0F22C,0x00F0FF50
+	.word 0xFFB000F0,0x038103F0,0x00F000F0,0xF0FF00F0,0x4000F000,0x50EF107F,0x91074103,0xFF00F077
+	.word 0x00F000F0,0x00F000F0,0xF0107F40,0x9F6BBFAB,0xF01F60FF,0xF000F000,0xF000F000,0xF5E05100
+	.word 0x0070FF57,0x97605BA5,0x5A1A0040,0xD01300A0,0xF0F7D4F3,0x707FB000,0x1327254F,0x44002305
+	.word 0x00EF9F1B,0x14370513,0xAD08032B,0x00F0C5FA,0xF0FF00F0,0xF07FF000,0xF200D000,0xF00340FC
+
+	.word 0xF7AE2C00,0x4C41B330,0xC7403711,0xF0972B01,0xF100F07F,0x67F000F0,0xA7C1475C,0xF1101100
+	.word 0x00F0CF2B,0x11137F50,0x6F117321,0x03001310,0x0C335CFF,0xF034F062,0xF000F000,0x4000F000
+	.word 0x8F87FE6B,0x27901FF3,0x15B46025,0x00A045F1,0x66F1FF66,0xEC020070,0x00F000F0,0x46F000F0
+	.word 0xF5FB1312,0xF01C4085,0xF000F067,0x7A011300,0xC0DFDB11,0x113B0A00,0xD300B407,0x37F0AB2B
+	.word 0x13FF3C30,0x1F3FF047,0x5F3F6F17,0xF200701F,0xFF59F0E2,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xA000F0FF,0xF0D9D400,0x3300A000,0xD07FB4B7,0x874CFF20,0x1DC01833,0xCF354703
+	.word 0x1D90AA54,0x37FF6B3D,0x71030057,0xAAFF25C3,0xF5334AC7,0xFF00F0FE,0x00F000F0,0x576300F0
+	.word 0x00A033FB,0x5FFB7FC3,0x904FE0FF,0xF009F6CB,0xF33B232F,0x53004043,0x43F3FF3F,0x67100050
+
+	.word 0x43E4C760,0x91106FD0,0xF4FF2F85,0x03003073,0xF2036004,0x10184053,0xFF00F007,0xFF5500E0
+	.word 0x074C0386,0x00E061FC,0x8DF36896,0xF000F0FF,0x90FF8B7D,0xF0736803,0xF000F000,0x00F0FF00
+	.word 0x003000F0,0x03B00B72,0x93611331,0xF5FF0379,0xF98262DF,0x63D7A191,0x4C1FD047,0xFF53FEDF
+	.word 0x003000F0,0x0080FFF1,0x00F0FFF1,0x00F000F0,0xF000F0FF,0xF0F7F100,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0x10FF00F0,0xF599FA00,0xF000F0C7,0x3057F000
+	.word 0xFF00F057,0x00F000F0,0x00F000F0,0xB3F06770,0x11F50070,0x440010A7,0x04400300,0x00F00840
+	.word 0x10C22570,0x40003023,0x00400040,0x80BE2010,0x32F0401F,0x241000F0,0x006028F0,0x6630ED22
+	.word 0x8F102150,0x105E9024,0xAA000404,0x04204400,0x04044200,0x0600D000,0x30442480,0x000244A2
+
+	.word 0x1000FE40,0xE5E00600,0x00F000F0,0x0F51A440,0x0300EC42,0x6310E680,0x10030074,0x9D444207
+	.word 0x02228100,0x6B402910,0x80473010,0x82C0FFB8,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x11F30040
+	.word 0x5300F080,0x53553355,0x20803555,0x35553303,0x15513366,0x1E0B6542,0x55555361,0xEC338E19
+	.word 0x23001300,0x00330350,0x33262B1E,0x0F00F155,0x00F000F0,0x355500E0,0xDB3C0053,0x63000320
+	.word 0x00500055,0x6B001577,0x355E6E30,0x00356400,0x10031016,0x516F1063,0x207700FF,0x5080101D
+	.word 0xD098108C,0x5013005A,0x306641CC,0x1333632B,0x3D006155,0x4C006155,0x55030015,0x00510F00
+	.word 0x8B1A9317,0x42003631,0xF30B5515,0x515B0D00,0x30556F20,0x1317000F,0x7D101826,0x00BF0DFD
+
+	.word 0x200320A8,0x4047000F,0x0E00658E,0x331C6172,0x3B00A800,0x0F005535,0xAC60FF11,0x00F07FF4
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0F000F0,0xF000F000,0x0000B000
 
 	.section .rodata
 	.align	2
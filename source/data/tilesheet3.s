@@ -6,8 +6,8 @@
 @	tilesheet3, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2460 = 2972
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,95 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet3Tiles		@ 14208 unsigned chars
+	.global tilesheet3Tiles		@ 2460 unsigned chars
 	.hidden tilesheet3Tiles
 tilesheet3Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x333BB3BB,0xBB3BBBBB,0xBB3BBBBB,0xBBB333BB,0xBBBBB3BB,0xBBBBB3BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBB3BB333,0xBBBBB3BB,0xBBBBB3BB,0xBB333BBB,0xBB3BBBBB,0xBB3BBBBB
-
-	.word 0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB,0xBBBBB3BB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB,0xBB3BBBBB
-	.word 0xBBBBB3BB,0xBBBBB3BB,0xBBB333BB,0xBB3BBBBB,0xBB3BBBBB,0x333BB3BB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x33333333,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBB3BBBBB,0xBB3BBBBB,0xBB333BBB,0xBBBBB3BB,0xBBBBB3BB,0xBB3BB333,0xBBBBBBBB,0xBBBBBBBB
-
-	.word 0x72222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77722222,0x77222222,0x72222222,0x72222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77722222,0x77222222,0x72222222,0x72222222,0x22222222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-
-	.word 0x22222227,0x22222777,0x22227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77722222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0x22222222,0x22222222,0x22222222,0x22222277
-	.word 0x22222227,0x22222777,0x22227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77222222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0x22222222,0x22222222,0x22222227,0x22222277
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBCCCC,0xBBBBCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCC444CC,0x4444C4CC
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x44444444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x44444444
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xCCCCBBBB,0xCCCCBBBB,0xCCCCCCCC,0xCCCCCCCC,0xCC444CCC,0xCC4C4444
-
-	.word 0xCCCCC4CC,0xCCCCC4CC,0xCCCCC4CC,0xCCCCC4CC,0x4CCCC4CC,0xC44CC4CC,0xCCC4C4CC,0x1CCC44CC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x4444CCCC,0xCCCC4444,0xCCCCCCCC,0x1111CCCC,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCC4444,0x4444CCCC,0xCCCCCCCC,0xCCCC1111,0x11111111
-	.word 0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCCC,0xCC4CCCC4,0xCC4CC44C,0xCC4C4CCC,0xCC44CCC0
-	.word 0x110CC4CC,0x1111CCCC,0x11111CCC,0x100111CC,0x000111CC,0x000000CC,0x00000000,0x00000000
-	.word 0x00111111,0x00111111,0x00001111,0x00001111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x01111110,0x00101000,0x00101000,0x00100000
-	.word 0xCC4CC100,0xCCCC0111,0xCCC11111,0xCC111110,0xCC000000,0xCC000000,0x00000000,0x00000000
-
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBB3BB,0x44BBBBBB,0x22BBBBBB,0x224BBBBB,0x22244BBB,0x22777BBB
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x77222222,0x72222222,0x72222AA2,0x22222A22
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0x44444444,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0xBBBBBBBB,0xBBBBBBBB,0xBB3BBBBB,0xBBBBBB44,0xBBBBBB22,0xBBBBB422,0xBBB44222,0xBBB22222
-	.word 0x27777BBB,0x77772BBB,0x77722BBB,0x77222BBB,0x77222BBB,0x22222BBB,0x22222BBB,0x22222BBB
-	.word 0x22222A22,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0xA7777722,0xA7772222,0xA7722222,0x772222A2,0x772222A2,0x22222222,0x22222222,0x22222222
-	.word 0xBBB2222A,0xBBB22222,0xBBB22227,0xBBB22277,0xBBB22777,0xBBB77777,0xBBB77772,0xBBB77222
-
-	.word 0x22222BBB,0x22222BBB,0x222BBBBB,0x22BBBBBB,0x22BBBBBB,0xBBBBB3BB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x777222A2,0x77222AA2,0x72222222,0x72222222,0x22222222,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x22222227,0x22222777,0x22227777,0x2227A777,0x22777777,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0xBBB22222,0xBBB22222,0xBBBBB222,0xBBBBBB22,0xBBBBBB22,0xBB3BBBBB,0xBBBBBBBB,0xBBBBBBBB
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88868888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88668888,0x88668888,0x88888888,0x88888888
-
-	.word 0x72222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0xA2777772,0xA7777222,0xA7722222,0x77222222,0x72222222,0x72222222,0x2222222A
-	.word 0x22222222,0x22222222,0x22222222,0x22222227,0x22222777,0x22227777,0x22277777,0x22777777
-	.word 0x22277777,0x22777772,0x77777222,0x77A22222,0x77A22222,0x72222222,0x722222AA,0x2222222A
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x222222A2,0x222222A2,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-	.word 0x27777722,0x77772222,0x77722222,0x77222222,0x77222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222227,0x22222277,0x22222777,0x22277777,0x22777772,0x77777222
-
-	.word 0x22222227,0xAA222777,0x2A227777,0x22277777,0x22777777,0x27777722,0x77772222,0x77722222
-	.word 0x77722222,0x77222222,0x72222222,0x72222222,0xA2222222,0xA2222222,0x22222222,0x22222277
-	.word 0x22222227,0x22222777,0x22227777,0x2227777A,0x2277777A,0x27777722,0x77772222,0x77222222
-	.word 0x77722222,0x77222222,0x7222222A,0x72222222,0x22222222,0x22222222,0x22222227,0x22222277
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0xAAAABBBB,0xAAAABBBB,0xAAAACCCC,0xAAAACCCC,0x9999CCCC,0x9999CCCC,0x99999C99,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9999AAAA,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAA999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBAAAA,0xBBBBAAAA,0xCCCCAAAA,0xCCCC99AA,0x99C99999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999990,0x99999990,0x9900D000,0x00D0D000,0x00DDD000,0x00000000,0x00000000
-	.word 0x09999999,0x09999999,0x09999999,0x000D0099,0x000D0000,0x000DD000,0x00000000,0x00000000
-	.word 0x99999000,0x9999D000,0x9999D000,0x00DDD000,0x00DDD000,0xDDDDD000,0xDDDDD000,0x00000000
-	.word 0x09999999,0x00099999,0x000D0099,0x000DD000,0x0000D00D,0x0000000D,0x0000000D,0x00000000
-	.word 0xAAAABBBB,0xAAAABBBB,0xAAAACCCC,0xAAAACCCC,0x9999CCCC,0x9999CCCC,0x99999C99,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9999AAAA,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAA999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBBBAAAA,0xBBBBAAAA,0xCCCCAAAA,0xCCCC99AA,0x99C99999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999990,0x99999990,0x9900D000,0x00D0D000,0x00DDD000,0x00000000,0x00000000
-	.word 0x09999999,0x09999999,0x09999999,0x000D0099,0x000D0000,0x000DD000,0x00000000,0x00000000
-	.word 0x99999000,0x9999D000,0x9999D000,0x00DDD000,0x00DDD000,0xDDDDD000,0xDDDDD000,0x00000000
-	.word 0x09999999,0x00099999,0x000D0099,0x000DD000,0x0000D00D,0x0000000D,0x0000000D,0x00000000
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x68888888,0x66888888
-	.word 0x88888888,0x88888888,0x68888888,0x66668888,0x66666688,0x66666668,0x66666666,0x66666666
-	.word 0x66888888,0x66666668,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666655,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888866,0x86666666,0x66666666,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888886,0x88886666,0x88666666,0x86666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888886,0x88888865
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x68888888,0x66888888
-	.word 0x66688888,0x66668888,0x66666888,0x66666688,0x66666668,0x66666666,0x56666666,0x55566666
-	.word 0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x66665566,0x66666655,0x66666665
-	.word 0x66655566,0x66655555,0x66665555,0x66666655,0x66666666,0x66666666,0x66666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66655556,0x65555555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x65555666,0x55555556,0x55555556,0x55555556,0x55555566,0x55555566,0x55556666
-
-	.word 0x88888666,0x88886666,0x88866666,0x88666666,0x86666665,0x66666665,0x66655665,0x66665665
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888886,0x88888866
-	.word 0x66888888,0x66688888,0x66668888,0x66668888,0x66666888,0x66666888,0x56666888,0x55666688
-	.word 0x55566666,0x65556666,0x66555666,0x66555666,0x56656666,0x55666655,0x55566665,0x55566666
-	.word 0x66666666,0x66666666,0x66666665,0x66655566,0x65555555,0x55555555,0x55555555,0x55555555
-	.word 0x55566666,0x55556666,0x55556666,0x55556666,0x55556666,0x55566665,0x55566555,0x55665555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666665,0x55666655,0x56666655,0x56666655,0x66655555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66666666,0x66666665,0x66655655,0x56665555,0x56655555,0x56655555,0x56555555,0x56555555
-	.word 0x66665666,0x66566666,0x65565666,0x66665555,0x66555555,0x65555555,0x65555555,0x65555555
-	.word 0x88888866,0x88888666,0x88886666,0x88886666,0x88866666,0x88866666,0x88866666,0x88666666
-	.word 0x65566688,0x65556568,0x65555568,0x66555568,0x66665558,0x66555558,0x66555555,0x65555555
-	.word 0x55556666,0x55555566,0x55555556,0x55555556,0x55555556,0x55555566,0x55555566,0x55555566
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55665555,0x56655555,0x66655555,0x66655555,0x66655555,0x66665555,0x66665555,0x66665555
-	.word 0x55555555,0x65555555,0x66666555,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555556,0x55555566,0x55555666
-	.word 0x55555555,0x66555555,0x66655555,0x66666555,0x66666555,0x66665555,0x66665555,0x66665655
-	.word 0x65555555,0x65555555,0x55555556,0x55555566,0x55566666,0x66666666,0x66666666,0x66666555
-	.word 0x88666666,0x86666666,0x86666655,0x86666655,0x86666655,0x86666556,0x66666655,0x66666555
-	.word 0x65555555,0x65555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555566,0x55555556,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55556555,0x55555555,0x55555555
-	.word 0x66665555,0x66665555,0x55666555,0x55555655,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x66656666,0x66655566,0x66666666,0x66666666,0x66666666,0x66666666,0x66655555,0x66555555
-	.word 0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55666666,0x56666666,0x56666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666555,0x66666555,0x66665555,0x66655555,0x66665556,0x66666666,0x66666666,0x66666666
-	.word 0x66666556,0x66666566,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55555555,0x56555555,0x65555558,0x55555558,0x55555558,0x55555558,0x55555558,0x55555688
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x65555555,0x66555555,0x66555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555556,0x55555556,0x55555555,0x55555555,0x55555555,0x55555555,0x66665555
-	.word 0x66555555,0x66555555,0x66666655,0x66666665,0x66666665,0x66666665,0x66666666,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x86666666,0x86666666,0x86666666,0x86666666,0x86666666,0x88666666
-	.word 0x55556688,0x55556888,0x55566888,0x55666888,0x66668888,0x66668888,0x66688888,0x66888888
-	.word 0x65555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555556,0x55555566,0x55555666
-
-	.word 0x55555556,0x55555556,0x55555565,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x66555555,0x66665555,0x66555555,0x55555555,0x55555555,0x55555565,0x55555665,0x66556655
-	.word 0x65665556,0x65555556,0x55555566,0x55555655,0x65555555,0x55555555,0x55555555,0x55555555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666555,0x66666555
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88666666,0x88866666,0x88866666,0x88866666,0x88886666,0x88886666,0x88888666,0x88888866
-	.word 0x66888888,0x68888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x55555666,0x55556666,0x55556666,0x55665568,0x66665688,0x66656888,0x66668888,0x66688888
-	.word 0x55555555,0x55555555,0x55555555,0x66555555,0x66666555,0x66666556,0x66666666,0x66666666
-	.word 0x66555555,0x65555555,0x66655555,0x66655556,0x66555566,0x55555566,0x55555556,0x55555556
-	.word 0x55555555,0x55556666,0x55556666,0x55556666,0x66655666,0x66655666,0x66556665,0x66556665
-	.word 0x66666555,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x86666666,0x88666666,0x88866666,0x88886666,0x88888666
-	.word 0x88888866,0x88888886,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x66888888,0x68888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x66666666,0x66666566,0x66666668,0x66666688,0x66668888,0x68888888,0x88888888,0x88888888
-	.word 0x55555566,0x55555666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666668,0x66888888
-	.word 0x66666665,0x66666666,0x66666666,0x66666656,0x66666555,0x66666666,0x66666656,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x86666666,0x88888866
-	.word 0x66666666,0x66666666,0x86666666,0x88666666,0x88886666,0x88888886,0x88888888,0x88888888
-	.word 0x88888866,0x88888886,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x002000F0,0x005081BB,0xBB333BB3,0x08003BBB
+	.word 0x3303009C,0x100F00B3,0xBB1D6013,0x0000FB33,0x00F00D70,0x1FC01FF0,0x505700B3,0x6A10FF53
+	.word 0x13506B50,0x7FA003F0,0x00F000F0,0x10FF00F0,0xF0674000,0x107FB003,0x201360F3,0xFF00F0A0
+	.word 0x00F0EBF0,0x53401FE0,0x6B405210,0x00400B21,0x2222220D,0x20030072,0x03002700,0x0400774A
+	.word 0x03107777,0x77030027,0x720720BF,0x04401010,0x33402210,0x3FF03760,0xF03FF0FF,0x103F403F
+	.word 0x60312020,0xE003101B,0x5B20FF00,0x53805F60,0x3FF03FF0,0x3F603FF0,0x40FFB3F0,0xF0536008
+	.word 0x100050B3,0x903FF014,0xE622103F,0x8F903FF0,0xCCCC8751,0x00400350,0xCCC40344,0x4444C4CC
+
+	.word 0x1F60DBD1,0x002210FC,0xF01FF000,0x6061901F,0xB8444C00,0x004C1F00,0xB00B0063,0xC4CC4C03
+	.word 0xCCC44C08,0x440C00C4,0x90EF1CCC,0x5051304F,0x0020110B,0x05701DB0,0x30F21910,0x8063001F
+	.word 0x4C5E1003,0x4C0B00C4,0xC0CC4C11,0xC4CC6000,0x2229200C,0x03001CCC,0x00100111,0xCC7F0003
+	.word 0x42001F84,0x0B100340,0x85303FF4,0x10220070,0x10400011,0x03200010,0x03009900,0x52004CC1
+	.word 0xCCC16110,0x10FC1B00,0xC403505A,0x1105207F,0x4B93012F,0x4BBB0122,0x7BBB2224,0xE59F6177
+	.word 0x00001C20,0x2AA2CB51,0x712ACB01,0x1F50F1BF,0x87930BD2,0x22BB5C40,0x240300B4,0x7B03B442
+	.word 0x6300BBB2,0x2B02BB27,0x2BBB7777,0x22030072,0x220350BD,0x63100350,0xFFA2BFF2,0x8E1100A7
+	.word 0xA7720300,0x100800A2,0x2AA39203,0x106300D5,0x03002767,0x27031077,0x77080300,0x0072BBB7
+
+	.word 0xB7722203,0x6B60BB7B,0x9E500400,0x00A2F794,0xEFEB0064,0xF390BFA2,0xD0A7FFA2,0x305F14F3
+	.word 0xEFEA107F,0x93346050,0xF0880030,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FE,0xF000F000,0xF000F000,0x8600E000,0x6012F0DF,0x03406600,0xFFF50030
+	.word 0x6602BFF5,0x220612FE,0x42CB9463,0xF0FFF59A,0xA2FF453F,0x2203408F,0x3F50AA72,0xBFA2BFF5
+	.word 0x20FECF02,0xF5FFF203,0xF53FF0FF,0x20FFF5FF,0x00BDAA13,0xBFF52A0E,0x9280FFF5,0x007AFFE5
+	.word 0xF57A7F08,0x000720FF,0x00FFF5EB,0xF0D1F403,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xF000F000,0x00F000F0,0x003000F0,0xAAAABBBB
+	.word 0xCC031092,0x990350CC,0x99031099,0x03009C6F,0xA0AA0000,0x90133000,0xF71DC000,0x5D3021E0
+
+	.word 0x59206140,0xF044F0C9,0xF900F000,0x00F000F0,0x00F000F0,0x909900F0,0x00100340,0x030000D0
+	.word 0xD00000D0,0x1F61DD69,0x60091600,0x000D0003,0x0300B911,0x400710D0,0x00380000,0xDB0350D0
+	.word 0x03303700,0x600320DD,0x5800093F,0x0D7F3730,0x45405E00,0x7FF17FF1,0x7FF17FF1,0xF1FF7FF1
+	.word 0xF07FF17F,0xF000F000,0xF000F000,0xFF00F000,0x7FF100F0,0x7FF17FF1,0x7FF17FF1,0x7FF17FF1
+	.word 0xF67F81FB,0xF000F01F,0x68002000,0x0F2048A6,0x00666627,0x00686602,0x10005003,0x0F90C623
+	.word 0x666600F0,0xB012F055,0x662F6640,0x650A1086,0x7F601DF0,0x0D10F116,0x501210F1,0xF71F902F
+	.word 0x65888821,0xF0EE16F0,0xC000F000,0x752068FF,0xFBD00600,0x0200FE56,0x1300DAD0,0x15000300
+	.word 0xCF201810,0x66651F55,0xF1032055,0xF02F4007,0xFB181000,0x04003320,0x00F000F0,0x00562C00
+
+	.word 0xFB03502C,0x03203810,0x08017510,0x21863731,0x4750003B,0x65541086,0x03006556,0x6FA13FF1
+	.word 0x710A30F7,0x30075103,0x0E005603,0x03116300,0x10A700FE,0x000E2106,0x2010B08A,0x550B7100
+	.word 0x0300657F,0x3F400060,0x3B1003A0,0x2E10D130,0x9000F0FF,0x40571000,0x30703038,0x305F8063
+	.word 0x00557E7B,0x400D00EF,0x312E7158,0x56CA1181,0x109700FF,0x10742048,0x220320A3,0x5143619F
+	.word 0x0350C047,0x65561010,0x65556568,0x2B006865,0x58660300,0x71584300,0x7A00FF82,0x9FF10830
+	.word 0x00F0DDF0,0x4610C120,0x82FFD740,0x3103604B,0x4329F206,0x7000F07B,0xFF081083,0x57006460
+	.word 0xB130AD10,0x16010330,0x33600751,0x40D381FF,0x008F2373,0x01036014,0x4007106A,0x4B61FF4B
+	.word 0x534000F0,0x00F08670,0x41F200F0,0x11FF0320,0x0048F016,0xE1D44019,0xF3272217,0xFF00F083
+
+	.word 0xD7332410,0x33C100F0,0x9AA3F532,0x37F06C23,0x569FC1AA,0x00653302,0x03905503,0xCFF0FF88
+	.word 0x117100F0,0x5C5052F2,0x3B8163F1,0x40FF3740,0xF4AE90A6,0xF000F0AF,0xF000F000,0xFC00F000
+	.word 0xD3150000,0x5F0303D0,0x58030701,0x564F6888,0x55660300,0x93148973,0x5BF21D10,0x50DF92FF
+	.word 0x9280F2FB,0x61076182,0x11F0424C,0x7C53FFCF,0x7DC24451,0x179200F0,0x00F000F0,0xA0FF00F0
+	.word 0x4173C400,0x65931401,0xF0AB269F,0xD51C1000,0x9D52B300,0x88D00068,0x1468F315,0x4331FFD6
+	.word 0xB3000BE1,0xC750B322,0xDB120F65,0xA2FFE862,0x10BFA553,0x015B163C,0x1003103B,0xFF06F132
+	.word 0x00F000F0,0x135200F0,0x03410761,0x00F00DFF,0x7100F0FF,0x803FF122,0x0000101C,0x45F717C0
+	.word 0x2FA0FFF0,0xA8D06752,0x1E002F20,0x4014FB90,0xF4FF1352,0x49EBF04C,0xB0FBC01B,0xF0FFF0EF
+
+	.word 0xFF00F000,0x31FD0070,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F08000
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	tilesheet3_top, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2304 = 2816
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,89 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet3_topTiles		@ 14208 unsigned chars
+	.global tilesheet3_topTiles		@ 2304 unsigned chars
 	.hidden tilesheet3_topTiles
 tilesheet3_topTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x66660000,0x66666600,0x66666660,0x66666660,0x66666660,0x66666640,0x66666600
-	.word 0x00000000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000666,0x00006666,0x00066666,0x60066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00666666,0x06666666,0x06666666,0x06666666
-
-	.word 0x66666600,0x66666660,0x66666660,0x66666660,0x66666660,0x66666660,0x66666640,0x66666400
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x56566666,0x55566666,0x64666666,0x66666666
-	.word 0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666,0x06666666
-	.word 0x66666000,0x66444000,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666644,0x66666400,0x66664000,0x66640000,0x44400000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x64444444,0x40000000
-	.word 0x04666666,0x00666666,0x00666666,0x00666666,0x00466666,0x00046666,0x00004666,0x00000444
-
-	.word 0x66666664,0x66666660,0x66666640,0x66666400,0x66664000,0x66660000,0x66640000,0x66600000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66565666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x46666666,0x06666666,0x04466666,0x00066666,0x00066666,0x00066666,0x00046666,0x00006666
-	.word 0x66400000,0x66000000,0x66000000,0x66000000,0x64000000,0x40000000,0x00000000,0x00000000
-	.word 0x66555666,0x66555666,0x66646666,0x66646666,0x66646666,0x66666666,0x66666640,0x44444400
-	.word 0x66666666,0x66666666,0x66666666,0x46666666,0x06666666,0x06666666,0x00446666,0x00004444
-	.word 0x00004466,0x00000046,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x60000000,0x66600000
-	.word 0x00000000,0x00000000,0x00000000,0x66660000,0x66666000,0x66666600,0x56566666,0x55566666
-	.word 0x00000000,0x66000000,0x66666000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66600000,0x66600000,0x66600000,0x66600000,0x66600000,0x66400000,0x00000000,0x00000000
-	.word 0x55566666,0x64666666,0x64666666,0x64666666,0x66666666,0x66666666,0x66666400,0x66664000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66640000,0x44400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666664,0x66666440,0x66666000,0x66664000,0x66660000,0x44440000
-
-	.word 0x66666664,0x66664440,0x64440000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66666440,0x66664000,0x66640000,0x66600000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66660000,0x66666000,0x66666600,0x66666400,0x66664000,0x66660000,0x44000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x00044446,0x00000004
-	.word 0x66656566,0x66655566,0x66655566,0x66664666,0x66664666,0x66666666,0x66666660,0x66666660
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66666640,0x66644400,0x66400000,0x44000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x66666660,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000066
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66000000,0x66000000,0x66600000,0x66600000,0x66660000,0x66660000,0x66666000,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x65656666,0x65556666,0x65556666,0x66466666,0x66466666
-	.word 0x00066666,0x00066666,0x00666666,0x00666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00066666,0x06666666,0x06666666
-
-	.word 0x66666660,0x66666660,0x66666640,0x66666400,0x66666000,0x66664000,0x66660000,0x66660000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66665656,0x66665556,0x66665556,0x66666466,0x66666466
-	.word 0x06666666,0x06666666,0x04466666,0x00066666,0x00046666,0x00004666,0x00000666,0x00000466
-	.word 0x66640000,0x66400000,0x64000000,0x66000000,0x66666600,0x66666600,0x66666600,0x66666400
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666466,0x66666666,0x66666666,0x66666666,0x66666666,0x46666666,0x06666666,0x66666666
-	.word 0x00000666,0x00006666,0x00006666,0x00004666,0x00000466,0x00000044,0x00000000,0x00006000
-
-	.word 0x66644000,0x66600000,0x66600000,0x66660000,0x66666000,0x66666600,0x66666600,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00666666,0x00666666,0x00666666,0x00666666,0x00666666,0x00666666,0x00466666,0x06666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x60000000,0x66000000,0x66666000,0x66666600,0x66666660,0x66666660,0x66666600,0x66666600
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x66666600,0x66666660,0x66666660,0x66666660
-	.word 0x00000000,0x66000000,0x66000000,0x66600000,0x66666666,0x66666666,0x66656566,0x66655566
-	.word 0x66666660,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x66600000,0x66660000,0x66666000,0x66666660
-	.word 0x66666660,0x66666660,0x66666600,0x66666660,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66655566,0x66664666,0x66664666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666664,0x66666640,0x66666600,0x66666400,0x66666000,0x66664000,0x66440000,0x66000000
-	.word 0x66666666,0x66666666,0x66666666,0x66565666,0x66555666,0x66555666,0x66646666,0x66646666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66000000,0x66000000,0x66000000,0x66000000,0x66000000,0x66600000,0x66660000,0x66666000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666000,0x66666000,0x66666000,0x66666600,0x66666600,0x66666660,0x66666660,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000666,0x00006666,0x00066666,0x00666666,0x06666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x65656666,0x65556666,0x65556666,0x66466666,0x66466666,0x66666666,0x66666666
-	.word 0x00066666,0x00666666,0x00666666,0x06666666,0x66666666,0x66666666,0x66666666,0x46666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000006,0x00000006,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x46666666,0x04466666,0x00044666,0x00000666,0x00000444
-	.word 0x04666666,0x00466666,0x00066666,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x56566666,0x55566666,0x55566666,0x64666666,0x64666666,0x64666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666,0x00466666,0x00066666
-	.word 0x46666666,0x06666666,0x04666666,0x00466666,0x00046666,0x00004444,0x00000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44666666
-	.word 0x00046666,0x00006666,0x00066666,0x00666666,0x00666666,0x00666666,0x00044044,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x66666666,0x44466666,0x00044666,0x00000466,0x00000066,0x00000066,0x00000046,0x00000004
-	.word 0x00444444,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000066,0x00066666,0x06666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000066,0x60000066,0x60006666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x66660000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x65666666
-	.word 0x00000000,0x66000000,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666665
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x55666666,0x55666666,0x46666666,0x46666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666665,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x44466666,0x00044444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66644466,0x64400044,0x40000000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x46666666,0x04466666,0x00044444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66664444,0x66640000,0x64400000,0x40000000
-
-	.word 0x66666666,0x66666666,0x66666666,0x66565666,0x66555666,0x66555666,0x66646666,0x66646666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666565,0x66666555,0x66666555,0x66666646,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x44666666,0x00466666,0x00044666,0x00000666,0x00000444
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666644,0x66666400,0x44444000,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x44446666,0x00004666,0x00000666,0x00000444,0x00000000
-	.word 0x66666666,0x66666666,0x66666666,0x66666664,0x66444440,0x66000000,0x64000000,0x40000000
-	.word 0x00000000,0x00000666,0x00066666,0x00066666,0x00666666,0x06666666,0x06666666,0x00666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000066,0x00000066,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00006666,0x00066666,0x00066666,0x00066666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x65666666,0x55666666,0x55666666,0x46666666,0x46666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666665,0x66666665,0x66666665,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00066666,0x00006666,0x00666666,0x06666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000006,0x00006666,0x00066666,0x06666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666656,0x66666655,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x46666666,0x06666666,0x06666666,0x04666666,0x00466666,0x00066666,0x00046666,0x00006666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666664,0x66666664,0x66666664,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00004666,0x00006666,0x00006666,0x00006666,0x00006666,0x00006666,0x00000666,0x00006666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00066666,0x00066666,0x00066666,0x00066666,0x00066666,0x00066666,0x06666666,0x06666666
-	.word 0x00000000,0x00000006,0x00000666,0x00006666,0x60066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x66000000,0x66600000,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000006,0x00000666,0x00066666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x66600000,0x66600000,0x66666000,0x66666660,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x56666666,0x56666666,0x56666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666656,0x66666655,0x66666655
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666664,0x66666664,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666565,0x66666555,0x66666555,0x66666646,0x66666646,0x66666646,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666565,0x66666555
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666555,0x66666646,0x66666646,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00003333,0x00003333,0x00002222,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x33333333
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x33333000,0x33333000,0x22222000,0x33333333
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00880000,0x08800000,0x88000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00006600,0x00006000,0x00006000,0x08000088
-	.word 0x00000000,0x00000000,0x00808000,0x00008880,0x00000070,0x00000000,0x00666000,0x00606080
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060,0x00000060
-	.word 0x00008000,0x00008000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x88000077,0x80080000,0x00000000,0x88000000,0x78000000,0x00000000,0x80000000,0x00000000
-	.word 0x00006080,0x00086008,0x00086088,0x00080887,0x00000870,0x00000088,0x00000078,0x88880000
-	.word 0x00080000,0x00078800,0x00007880,0x00000788,0x00000000,0x00000000,0x00000000,0x00000088
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x60800000,0x66800000,0x86600000,0x87600000,0x70000000,0x00000000,0x00000000
-	.word 0x88880000,0x88180006,0x88880006,0x88870000,0x77700008,0x00000807,0x00000700,0x00000000
-	.word 0x00000088,0x00000081,0x00000088,0x00000078,0x00000007,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00066000
-	.word 0x00000000,0x00000000,0x08888880,0x08188180,0x08888880,0x07888870,0x00777000,0x66088000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x08000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00066000,0x88860000,0x07868000,0x00060080,0x00000000,0x00000000,0x80000000,0x88880000
-	.word 0x06070000,0x86080880,0x86088780,0x78878088,0x08008870,0x00807800,0x00000800,0x00000000
-	.word 0x07088800,0x00007880,0x00000070,0x00000000,0x00000000,0x00000000,0x00000000,0x00000060
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00780000,0x00000000,0x00000800,0x00000000,0x00600000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00080000,0x00880000,0x00870000,0x00800000,0x00700000,0x00000000,0x00000000
-	.word 0x00000066,0x00000006,0x00000000,0x00000000,0x00000000,0x00000008,0x00000007,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x008000F0,0x00664B66,0x80606602,0x03004003
+	.word 0x30F61310,0x5000F01D,0x061F2000,0x03004120,0x0310FB06,0x1FA03E10,0x562069B0,0xD0035006
+	.word 0x7FA0B977,0xF06FF064,0x5600D000,0x7E030056,0x50080055,0xF06B603D,0x007F0003,0x402D006C
+	.word 0x44A71044,0xFB7017F1,0x578F4044,0x00980000,0x00000800,0x701BF134,0x44440D00,0x1E006444
+	.word 0x5104C610,0x0330A44A,0x04030046,0x00060000,0x10047F44,0x30EFB049,0xA163505F,0x1000F04A
+	.word 0x00F0D7EA,0x304600D0,0x870046EB,0x03409F21,0x218300DF,0x0510409D,0xB7200390,0x4A11FF60
+	.word 0x504E61FD,0x00AF4003,0x516BF0E4,0x1E00445B,0x003F00EF,0x00EA0003,0x00F0EA00,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x0070BF00,0xB09F1160,0x12130112,0x5087824F
+	.word 0xCAF1FF18,0x00F01FF3,0x07226620,0xB32103B0,0xF1FF7140,0x4257209C,0xF000F04B,0xF000F07F
+	.word 0xFB00F000,0x0B730050,0x1F7300F0,0x10409810,0xFF6F2393,0x2403E352,0x45021710,0x77A20B00
+	.word 0x43A03FD0,0xF18363FF,0xF000F054,0xF0FFF000,0xD3D3F100,0x2F34EC9F,0x003051F0,0x12DC0346
+	.word 0x0F6566F3,0x55666665,0x1D130340,0x00000310,0xF0E754FF,0xF000F06F,0xF000F000,0x213FF100
+	.word 0x7310FF3F,0x43427501,0x00F0B7F1,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0x51002000
+	.word 0xFF19F0F9,0x12F0FB80,0xF76400F0,0xDF415B53,0x5DF26000,0x75CCF1FF,0xF2E3654F,0x3070D05F
+	.word 0xD627252F,0x1FB3FFEF,0x00F057F2,0xF9560070,0x8F6511A4,0x36FFFF55,0x25B3277B,0x130B6294
+
+	.word 0xF7A8967F,0xFF00F07F,0xFEB27184,0x72107740,0x77305151,0x74627300,0x004105BF,0x7BA1D003
+	.word 0x17416B53,0x00F000F0,0xB100F0FF,0x5703F082,0xF09D1087,0xF000F000,0x00F0FF00,0xE58000F0
+	.word 0xF763D760,0x00F00350,0xB2FF00F0,0xD227A93C,0x420060C3,0xC143F1AA,0xFFAEF01C,0xAF90FFA2
+	.word 0x00004BF0,0x00F0D7C4,0x3ED200F0,0xA26B6AFF,0xB09329FF,0xF0E0F22C,0xF000F050,0xFFB0FF00
+	.word 0x038103F0,0x00F000F0,0x00F000F0,0x40FF00F0,0x50EF107F,0x91074103,0xF000F077,0xFF00F000
+	.word 0x00F000F0,0xF0107F40,0x9F6BBFAB,0x00F01F60,0xF000F0FF,0xF000F000,0xF5E05100,0xA5007057
+	.word 0x9760FF5B,0x5A1A0040,0xD01300A0,0x00F0D4F3,0x70DF7FB0,0x4627254F,0x44002305,0x13009F1B
+	.word 0x14BF3705,0xAD08062B,0x00F0C5FA,0x00F000F0,0xF0FF7FF0,0xF200D000,0xF00340FC,0x30AE2C00
+
+	.word 0xDF4C41B3,0xC7403711,0xF0972B04,0xF000F07F,0xC767F000,0xA7C1475C,0xF1404400,0x5000F02B
+	.word 0x44463F7F,0x6F117321,0x03001310,0x620C335C,0xF034F0FF,0xF000F000,0x4000F000,0xF38F876B
+	.word 0x2790FB1F,0x15B46025,0x00A045F1,0x8066F165,0x12F0FF1C,0x00F000F0,0x0F1200D0,0x85F50310
+	.word 0xF0EF6340,0xF000F067,0x7A014600,0x00C0DB11,0x447F3B0A,0xD300B407,0x37F0AB2B,0x47133C30
+	.word 0x1FFF3FF0,0x5F3F6F17,0xF200701F,0xF059F0E2,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00A000F0,0xF0D9D4FF,0x3300A000,0xD07FB4B7,0x33874C20,0x1DC0FF18,0xCF354703,0x1D90AA54
+	.word 0x57376B3D,0x71FF0300,0xAAFF25C3,0xF5334AC7,0xF000F0FE,0xFF00F000,0x576300F0,0x00A033FB
+	.word 0x5FFB7FC3,0xCB904FE0,0xF009F6FF,0xF31E232F,0x80BF5143,0x1000F003,0x6710FF00,0x43E4C760
+
+	.word 0x91106FD0,0x73F42F85,0x03FF0030,0xF0036008,0xF0B0801C,0x5500E000,0xFF0386FF,0x61FC074C
+	.word 0x689600E0,0x00F08DF3,0xFF8B7DF0,0x680390FF,0xF000F073,0xF000F000,0x3000F000,0x0B72FF00
+	.word 0x133103B0,0x03799361,0x8262DFF5,0xA1FF91F9,0xD04763D7,0xFEDF4C1F,0x3000F053,0xFFFFF100
+	.word 0xFFF11CC0,0x00F000F0,0x00F000F0,0xF7F100B0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x99FA0010,0xF0FFC7F5,0xF000F000,0xF0533057,0xF000F000
+	.word 0xFF00F000,0x003000F0,0x00B051FB,0x00F011F5,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0E100,0x00F000F0,0x33330000,0x223F0330,0x10071022,0x7000F009,0xF01FF02B
+	.word 0x00C0B11F,0x10130030,0x22222003,0x50A71FF0,0x03008800,0x08400880,0xB11100B0,0x03306078
+
+	.word 0x23101C00,0x80800030,0x00805900,0x0F507010,0x60806E04,0xF0E72810,0x401E2000,0x40800003
+	.word 0x2000F003,0x30777700,0x10215066,0x7150788F,0x44000420,0x08600804,0x03008800,0x081A0887
+	.word 0x91007000,0x30882470,0x071F88A2,0x10008000,0xE5E00600,0x00F000F0,0x806530AB,0x00864315
+	.word 0x10008703,0x108CE660,0x18000663,0x6B100300,0x009D8887,0x11077781,0x106B4015,0xB8808163
+	.word 0xF082C0F0,0x7824A100,0x8888803F,0x81800908,0x07100818,0xC9008870,0x1901704F,0x3FF30880
+	.word 0x9F7100B0,0x808000F0,0x00888663,0x80078680,0x01B9BEE0,0x07D3105F,0x08088006,0x87808600
+	.word 0x80888608,0x70781687,0x78530088,0x59501A00,0x07083F88,0x10815B11,0x12F05A70,0xCE5100F0
+	.word 0xF0A960FF,0x111C3035,0x117A1141,0x116D70F6,0x65D9FF00,0x00F07E81,0x00F000F0,0x00F000F0
+
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FE00F0,0xF000F000,0xF000F000,0x6000F000,0x00000000
 
 	.section .rodata
 	.align	2
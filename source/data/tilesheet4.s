@@ -6,8 +6,8 @@
 @	tilesheet4, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2508 = 3020
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,97 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet4Tiles		@ 14208 unsigned chars
+	.global tilesheet4Tiles		@ 2508 unsigned chars
 	.hidden tilesheet4Tiles
 tilesheet4Tiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x222222E2,0x22222222,0x88888222,0x22288222,0x22228222,0x22228222,0x22228222
-	.word 0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x2E222222,0x22222222,0x22288888,0x22288222,0x22282222,0x22282222,0x22282222
-
-	.word 0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222,0x22228222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222,0x22282222
-	.word 0x22228222,0x22228222,0x22228222,0x22288222,0x88888222,0x22222222,0x222222E2,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22282222,0x22282222,0x22282222,0x22288222,0x22288888,0x22222222,0x2E222222,0x22222222
-
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777775,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x57777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777755
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777555
-	.word 0x66666666,0x66666666,0xCCCCC666,0x666CC666,0x6666C666,0x6666C666,0x6666C666,0x6666C666
-	.word 0x66666666,0x66666666,0xCCCCCCCC,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0xCCCCCCCC,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x666CCCCC,0x666CC666,0x666C6666,0x666C6666,0x666C6666,0x666C6666
-
-	.word 0x6666C666,0x66666666,0x6666C666,0x6666C660,0x66666660,0x66666660,0x66666660,0x66666660
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x00106666,0x00100666,0x11100066
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666111,0x66666111,0x60166111
-	.word 0x666C6666,0x666C6666,0x666C6666,0x66666666,0x666C6666,0x66666666,0x66666666,0x00666666
-	.word 0x01111000,0x11111000,0x11110000,0x11100000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x11000000,0x11111100,0x11111111,0x01111111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x60166011,0x61111111,0x60100001,0x01100000,0x01000000,0x10000000,0x00000000,0x00000000
-	.word 0x00016666,0x00011106,0x00001116,0x00000106,0x00000100,0x00000011,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222292,0x22222222,0xDDDD8222,0x8888D222,0x88888222,0xDDD88222,0x88888222
-	.word 0x22222222,0x22222222,0x22222222,0xDDDDDDDD,0x88888888,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22222222,0x22222222,0x22222222,0xDDDDDDDD,0x88888888,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22222222,0x29222222,0x22222222,0x2228DDDD,0x222D8888,0x22288888,0x22288DDD,0x22288888
-	.word 0xDDD88222,0x88888222,0xDDD88222,0x88888222,0xDDD88222,0x88888222,0xDDD88222,0x88888222
-	.word 0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888,0xDDDDDDDD,0x88888888
-	.word 0x22288DDD,0x22288888,0x22288DDD,0x22288888,0x22288DDD,0x22288888,0x22288DDD,0x22288888
-
-	.word 0xDDD88222,0x88888222,0x88888222,0x88888222,0x88882222,0x22222222,0x22222292,0x22222222
-	.word 0xDDDDDDDD,0x88888888,0x88888888,0x88888888,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0xDDDDDDDD,0x88888888,0x88888888,0x88888888,0x88888888,0x22222222,0x22222222,0x22222222
-	.word 0x22288DDD,0x22288888,0x22288888,0x22288888,0x22228888,0x22222222,0x29222222,0x22222222
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x999A9999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99AA9999,0x99AA9999,0x99999999,0x99999999
-
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77BBB775,0x77B7B775,0x7777B777
-	.word 0x77777777,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x55555777,0x75555577,0x77755555,0x77777555,0x77777755,0x77777775,0x77777775,0x77777777
-	.word 0x77777775,0x77777777,0x77777777,0x57777777,0x55577777,0x55557777,0x55555777,0x55555577
-	.word 0x7777B777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x777B7777,0x77B77777,0x77B77777
-	.word 0x77777777,0x77777777,0x57777777,0x55777777,0x55577777,0x55555777,0x75555577,0x77755555
-	.word 0x77555557,0x77775555,0x77777555,0x77777755,0x77777755,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777555,0x77777755,0x77777775,0x77777775,0x77777777,0x77777777,0x57777777,0x55777777
-	.word 0x57777777,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777755
-	.word 0xB7777555,0xB7777755,0xB7777775,0x77777775,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x5777777B,0x55577777,0x55557777,0x55555777,0x55555577,0x77555557,0x77775555,0x77777555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x34444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444400
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44404404,0x44004400
-	.word 0x44444444,0x44444444,0x44444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444
-
-	.word 0x44440000,0x40000000,0x40000000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044004,0x00000004,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000400,0x00000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044440,0x00044440,0x00044400,0x00044400,0x00044400,0x00004400,0x00004000,0x00004000
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x34444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444400
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44404404,0x44004400
-	.word 0x44444444,0x44444444,0x44444444,0x04444444,0x04444444,0x04444444,0x04444444,0x04444444
-	.word 0x44440000,0x40000000,0x40000000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044004,0x00000004,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000400,0x00000400,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00044440,0x00044440,0x00044400,0x00044400,0x00044400,0x00004400,0x00004000,0x00004000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0xE9999999,0xEEE99999,0xEEEEE999
-	.word 0x99999999,0x99999999,0xE9999999,0xEEEE9999,0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0xEEEE9999,0xAEEEEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAAEEEEEE
-	.word 0x99999999,0xEEEEEEEE,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0x9999EEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0x99999999,0x99999999,0x9999999E,0x9999EEEE,0x9EEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x9999999E,0x99999EEE,0x999EEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0xEE999999,0xEEE99999,0xEEEE9999,0xEEEEEE99,0xEEEEEEE9,0xEEEEEEEE
-
-	.word 0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE
-	.word 0x9EEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEAAEE,0xEEEEEEEE,0xEAAAAAEE,0xAAAAAAAA
-	.word 0x99999999,0x99999999,0x999999EE,0x99999EAE,0x9999EAEE,0x99EEAEEE,0x9EAEEEEE,0xEEEEEEEE
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xE9999999,0xEE999999,0xEEE99999,0xEEE99999,0xEEEE9999,0xEEEEE999,0xEEEEEE99,0xEEEEEE99
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEAAE,0xEEEEAAAA,0xEEAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAAAAAEEE,0xAAAAEEEE
-	.word 0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEAA,0xEAEEEEAA,0xAAEEEEAA,0xAAEEEEEA,0xEEEEEEEA
-	.word 0x9999999E,0x999999EE,0x99999EEE,0x99999EEE,0x9999EEEE,0x999EEEEE,0x99EEEEEE,0x99EEEEEE
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0xE9999999,0xE9999999,0xEE999999,0xEE999999,0xEEE99999
-
-	.word 0xEEEEEEE9,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAEEEEEEE,0xAAAEEEEE,0xAAAAEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEA,0xEAAAAAAE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEA
-	.word 0xAAAEEEEE,0xAAAAAEEE,0xAAAAAAEE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAEE,0xAAAAAAEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEA,0xEEEEEAAA,0xEEEEEAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAAAAEE,0xEAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEAAAAE,0xAEEAAAAA,0xEAEEAAAA,0xEAAEAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEE,0xAEAAAAEA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAAAE
-	.word 0x9EEEEEAA,0xEEEEEEAA,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEAAA,0xEEEEAAAA,0xEEEEAAAA
-	.word 0x99999999,0x99999999,0x99999999,0x9999999E,0x9999999E,0x999999EE,0x999999EE,0x99999EEE
-	.word 0xEEE99999,0xEEEE9999,0xEEEE9999,0xEEEE9999,0xAEEEE999,0xAAEAE999,0xAAEAE999,0xAAEAAE99
-	.word 0xEEEAAEEE,0xEEEAAAEE,0xEEEEAAAE,0xEEEEEEAE,0xEEEEEEAA,0xAEEEEAAA,0xAAEEEEAA,0xAAAEEEAA
-	.word 0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEAA,0xAEEEEEAA,0xAEEEEEAA
-	.word 0xAAAAAAEE,0xAAAAAAEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEEE,0xAAAEEEEE,0xAAAEEEEE,0xAAEEEEEA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAEEA,0xAAAAAEEE,0xAAAAAEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEAAEAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA
-	.word 0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAAE,0xAAAAAAEE
-	.word 0xEEEEAAAA,0xEEEEAAAA,0xEEEEAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEAAAA
-
-	.word 0x99999EEE,0x9999EEEE,0x9999EEEE,0x9999EEEE,0x999EEEEE,0x999EEEEE,0x999EEEEE,0x99EEEEEE
-	.word 0xAAEAAE99,0xAAEAAE99,0xEEAAAE99,0xAAAAAA99,0xAAAAAAE9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9
-	.word 0xAAAEEEEA,0xAAAEEEEA,0xAAEEEEEE,0xAAEEEEEE,0xAEEEEEEA,0xEEEEEEEA,0xAAEEEEAA,0xAAEEEEAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEEA,0xAAAEEEAA,0xEAAAAAAA,0xAAAAAAAA
-	.word 0xAEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEA,0xAAEEEEEA,0xAAAEEEEA
-	.word 0xEEEEAAAA,0xEAAAEEEE,0xEEAAEAAE,0xEEEEEAAA,0xEAEEAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA
-
-	.word 0xAAAAAAEE,0xAAAAAAAE,0xAAAAEEEE,0xAAAEEAEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEE,0xAEAAAAEE,0xAEEAAEEE
-	.word 0xEEEEEEAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEAAA,0xEEEEEEAA
-	.word 0xAAAAAEEE,0xAAEAAAEE,0xAEEEAEEE,0xAAEAEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEAAAAEE
-	.word 0xEEEEAAAA,0xEEEEEAAA,0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEAE
-	.word 0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE
-	.word 0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9
-	.word 0xAAEEEEAA,0xAAEEEAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA
-	.word 0xAAAEEEEE,0xAAAEEEEE,0xAAAEEEEE,0xEAEAAEEE,0xEAAEEEEE,0xEEEEAAAE,0xEEEEAAAA,0xEEEEAAEA
-	.word 0xEEAAAAAA,0xEEEAAAAA,0xEEEEEAAA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEAAAAAA,0xEAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAE,0xEEAAAAEE
-	.word 0xEEEEEAAE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE
-	.word 0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAAA9,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99,0xAAAAAA99
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAEAAA,0xAAAAAAAA,0xAAAEEAAA,0xAAAEEAAA,0xAAAAEAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEAA
-	.word 0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAAEEEEEE
-
-	.word 0xEEEEEEAE,0xEEEEEEEE,0xEEEAAEEE,0xEAAAAEEE,0xEAAAAEEE,0xEEAAEEEE,0xEEEEEEAA,0xEEEEEEAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x9EEEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE,0x99EEEEEE
-
-	.word 0xAAAAAE99,0xAAAAA999,0xAAAAA999,0xAAAAE999,0xAAAA9999,0xAAAA9999,0xAAAE9999,0xAAE99999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEEAAAAAA,0xEAAAAAAA
-	.word 0xEEEEEAEE,0xEEEEAAAA,0xEAAAAAAA,0xEAAAAAAE,0xEAAAAAAE,0xAAAAAAEE,0xAAAAAAEE,0xAAAAAEEE
-	.word 0xAAEEEEEE,0xAEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xAEEEEEEA,0xAAAAEEAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEEE,0xEEEEEEAE,0xEEEEEEEE,0xAEEEEEEE,0xAAEEEEAA,0xEEEEEEEA,0xEEEEEEEA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEAAAA,0xEEEEAAAA,0xEEEAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEAA
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99EEEEEE,0x999EEEEE,0x999EEEEE,0x999EEEEE,0x9999EEEE,0x9999EEEE,0x9999EEEE,0x99999EEE
-	.word 0xAAE99999,0xAE999999,0xEE999999,0xE9999999,0xE9999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAEAAAEE,0xAAAAAEEE,0xAAAAEEEE,0xAAAEEEE9
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAEEA,0xAAAAAEAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEAAAAA,0xEAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEAAA,0xEEEEEAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xAEAAAAAE
-	.word 0xAAAAAAAE,0xAAAAAEEE,0xAAAAAEEE,0xAAAAAEAA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEEAA,0xEEEEEAAA,0xEEEAAAAA,0xEAAAAAAA,0xEAAAAAAA
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE
-	.word 0x99999EEE,0x999999EE,0x999999EE,0x9999999E,0x9999999E,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xAAEEEE99,0xAEEEEE99,0xAEEEE999,0xEEEE9999,0xEEE99999,0xEAE99999,0xEE999999,0xE9999999
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAEA,0xAAAAAEAA,0xAEEEEEAE,0xEEEEAAAE
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEEEAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAEEEEA,0xEAAEEEEE,0xAAEEEEEE
-	.word 0xAAEAAAAE,0xAAEEAEEA,0xAEEEEEEA,0xAEEEEEEA,0xEEEEEEEA,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAE,0xAAAAAEEE,0xAAAEEEEE,0xEEEEEEEE,0xEEAAAEEE
-	.word 0xEAAAAAAA,0xEAAAAAAA,0xEEAAAAAA,0xEEEAAAAA,0xEEEEAAAA,0xEEEEEAAA,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0x99EEEEEE,0x99EEEEEE,0x999EEEEE,0x9999EEEE,0x99999EEE,0x99999EEE,0x999999EE,0x9999999E
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xEEEEAAEE,0xEEEEEEE9,0xEEEEEE99,0xEEEE9999,0xEEE99999,0xEE999999,0x99999999,0x99999999
-	.word 0xEEEAAAAE,0xAAEAAAEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEE9
-	.word 0xAEEEEEEE,0xAAEEEEEE,0xAAAEEEEE,0xAAAEEEEE,0xAAEEEEEE,0xAAEEEEEE,0xAEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEAAAA,0xAAAAAAAA,0xEAAAAAAA,0xAAAAAAAA,0xEAAAAAAA,0xEAAAAAAA,0xEEEAAAAA,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xAAEEAAEE,0xAAAAAAEE,0xEEEAAEEE,0xEEEAEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE
-	.word 0xEEEEEEEE,0x9EEEEEEE,0x99EEEEEE,0x9999EEEE,0x99999EEE,0x999999EE,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xEEEEE999,0xEEE99999,0xE9999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEE9,0xEEEE9999,0xE9999999,0x99999999,0x99999999
-	.word 0xEEEEEEEE,0xAAEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEE9999,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEA,0xEEEEEEEE,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9999EEEE,0x99999999
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0x9EEEEEEE,0x9999EEEE,0x9999999E,0x99999999,0x99999999
-	.word 0x999EEEEE,0x99999EEE,0x9999999E,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x002000F0,0x0000B022,0x100410E2,0x88888200
+	.word 0x28823D22,0x0B100700,0x00800340,0xF7000088,0x1FF011B0,0x002015F0,0x101F302E,0x7F03005B
+	.word 0x90038022,0xF003F06B,0xF000F000,0xFF00A000,0x03D06FC0,0x0F106FA0,0x1361C330,0xE3F0E3F0
+	.word 0xF01FF0EC,0x286B207F,0x13810331,0x55025777,0x55557755,0x77020075,0x77020083,0x77777755
+	.word 0x03200600,0x7700F09F,0x00020057,0x30330022,0xFF075037,0x30403FF0,0x3FF047C0,0x3E101BA0
+	.word 0x53801F00,0x000A30FF,0x905B4018,0xF09BF030,0xB03FF03F,0xB3F0FF00,0xB3F04FD0,0x3FF05360
+	.word 0x3FF000D0,0x00A03F90,0x00506630,0x66CCCCC6,0x006C7BC6,0x800B1007,0xCC004003,0x0D700000
+
+	.word 0xF000F0FB,0x101FD01F,0x6603005B,0x635003C0,0x600700BE,0x0A000310,0x00F00390,0x11100010
+	.word 0x00066600,0x11100003,0x660B1BF0,0x50611166,0x42001603,0x10EA6F90,0x20075000,0x42000000
+	.word 0x11030001,0x1000002D,0x03001003,0x001100E0,0x0050A21A,0x601CE001,0x17006016,0x4400BA61
+	.word 0x103F0060,0x1003101F,0x0A661F50,0x06000166,0x00163600,0x40E80659,0x1364901D,0x7F649203
+	.word 0x6622DDDD,0x108314D2,0x53DDD803,0xDD00508B,0x130000FE,0x5000105F,0xF01FF00B,0x2900001F
+	.word 0x131F30D3,0x83232D7F,0x8B438DDD,0xF0FF6750,0x50072007,0xF007F047,0x0007F007,0xFF674007
+	.word 0x7FD007F0,0x15000340,0xD3901391,0xF3F00050,0x601FF0FD,0x7067401F,0x211A6003,0x00F09913
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF0DB00F0,0x9A00E000,0x006012F0,0x300340AA,0xBFF5C800,0xBBB7C704,0x77B70300,0x0200FF77
+	.word 0xFFF563F5,0xFFF5FFF5,0x3F403FF0,0xF5EF6370,0x45BFF5BF,0x03007BBF,0xA0A03810,0xF0FD3FF0
+	.word 0xF0FFF53F,0xF5FFF5B3,0xB7FF95BF,0xB77F0700,0x03103B00,0xA900FFE5,0x93803FF0,0xF0FFEEF4
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FA,0xF000F000,0x33003000,0xCD440000,0x006000F0,0x13F04333,0xF03400C0,0x3F80FB12
+	.word 0x00F05FF0,0x002000F0,0xF012F000,0x00F0C600,0x44040020,0xE03F0040,0xD0B60441,0x22000003
+	.word 0x80400601,0x0400A003,0x0004401F,0x03202400,0x184000F0,0x60B71CF0,0x62004000,0xA0000310
+	.word 0xF16D7003,0x7FF1FF1F,0x00A000F0,0x3F907FF1,0x00F05FF0,0xF1FF00F0,0xF000F07F,0xF1008000
+
+	.word 0xF116407F,0xFF7FF17F,0x62F17FF1,0x00F07FF1,0x7FE17FF1,0x00F01FF6,0xF000F0FA,0xF000F000
+	.word 0xE9008000,0xA7EE0200,0xB0EE0200,0x00EEEE13,0x3000A012,0x0A20AF1A,0xAA0300AE,0x0F201A80
+	.word 0x18101D50,0x901C90F8,0xF005103F,0x995F9019,0x70BF9E99,0x1FF09E27,0x2B2000B0,0x2A000400
+	.word 0xF0FF1CF0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0xCB000070,0xE5107301,0x6751D700
+	.word 0x00F06FD1,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00A0F000,0xAFA10312,0xAAAA0462
+	.word 0x00CAAAEA,0x99FC8000,0xEAB311AE,0xBFAE0300,0x20AE0211,0xF026F137,0xF000F000,0xFF00F000
+	.word 0xD7020060,0x7F417B51,0x7B10F712,0x00F0CFF0,0xF000F0FE,0xF000F000,0xF000F000,0xEA545100
+	.word 0x103E11FF,0xF051F303,0x90832100,0xF08EB103,0x20AA5B00,0x6130AE58,0x50EE6A00,0x7FC34303
+
+	.word 0x101810EA,0x23131082,0x1103106B,0xFF7323BB,0x3E417733,0x00F06DF1,0x8F418BD1,0xFFF29331
+	.word 0xF0DAD0EF,0xAE0330E7,0x1C50BF20,0xD600C350,0x607722FF,0x6000F0EB,0x2003102B,0x000B1147
+	.word 0x0600FF2B,0x23210360,0x00E03AF1,0x2C413721,0x70FC0D10,0x107FF003,0xF03210AE,0xAAE4809F
+	.word 0xC210FFEA,0x27009110,0x1AC20912,0xA7609E30,0x9E7F4000,0x28504410,0x1D418F60,0xCB117C91
+	.word 0x41E0CF61,0x501363D3,0xAEEEE903,0xEA3BE999,0x000320AA,0xEA8C326D,0x00566D21,0x220E40FF
+	.word 0x803B2144,0x7100F003,0x3152F12A,0xB3E2FF3F,0x72300330,0x0350AF92,0xE6301A30,0xD0FF00F0
+	.word 0xF014F073,0x6000F0AF,0x60721100,0xFF0B80BB,0x8000E301,0x03D03392,0x8B719D30,0xBD421FB2
+	.word 0x935363FC,0x0003505B,0x307E0010,0x57EEAA03,0xE94D0099,0x80A90300,0x318A1103,0x9A51FF8E
+
+	.word 0x0C10B121,0x00F04244,0x00F000F0,0x71FF0060,0x3003208F,0x2138215B,0xF36F105B,0xFF35725F
+	.word 0x7201E132,0x97424A02,0x47214351,0x19307753,0xA0C720F7,0x6390F04F,0x6500AE9B,0x7F53F830
+	.word 0x3303D0FF,0x00781050,0x145710B2,0x20A688DA,0x2B80FF46,0x00107DF4,0x0340EB64,0x0360B716
+	.word 0xF0FF8B91,0x74D84003,0xF000F00E,0xF000F000,0xF700F000,0x9F729BA2,0xE7342B53,0x559A21EA
+	.word 0xFFE82539,0x00F02BA0,0x00F000F0,0x00F000F0,0xDF6100F0,0x1013E5FF,0x2404150F,0xD097F061
+	.word 0xF18FA100,0x8FB1FF9F,0x03904313,0x7D6041E1,0x00F049D6,0x63FF39C0,0xF04F97D7,0x62FEB0BE
+	.word 0x33E810EC,0xFF8D22CA,0x00F04FFB,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FE,0x2000F000
+	.word 0xA393D100,0xAAD7044F,0x98019976,0xDC040320,0x30940199,0x00FFAE03,0xF0ED1403,0xF200F000
+
+	.word 0x115752FF,0xFF664480,0x53A6D561,0x73A46631,0xB2538921,0x1E709E51,0x783E23FF,0x2100B03F
+	.word 0xF0EF85F7,0xF0278000,0x00F0FF16,0x00F000F0,0x00F000F0,0x005000F0,0x86EF73C6,0x1B1F388B
+	.word 0x3248AEC3,0x0060BF59,0x35FF84D1,0x08FD306B,0xF3A5F14A,0xF0C848E8,0xFD00F000,0x63796240
+	.word 0x7F69D035,0x56000BB2,0xFF5B26AE,0x6740EB57,0x87416EA0,0x5B604097,0x00F0C0F1,0xF000F0FD
+	.word 0xF000F000,0x1000F000,0x1F289E00,0x597C41FF,0xF000F0BF,0x1F006000,0x29B302A3,0xD521FFD7
+	.word 0x850D072D,0x44F3CF31,0x601B2031,0xF0FF2736,0xF62A7000,0x361820D8,0x04E2226F,0xFF8801CE
+	.word 0x14209768,0xC0D95451,0xCF38AB61,0x73B98553,0xF07C53FF,0xF000F000,0xF000F000,0x4400D000
+	.word 0x1B43FFAB,0x8BF1075D,0x00F000F0,0x00F000F0,0x00FFBEB1,0x35231DEF,0x20BF512C,0x3600207E
+
+	.word 0xFF06232E,0x5B4D00E0,0x0758B64B,0xD224EA62,0xFD66248A,0xA0DB51FF,0x21921600,0xF0F9F49F
+	.word 0xF000F000,0x00F0FF00,0x2F2600F0,0x7F710750,0x00F026F1,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0x7000F000,0xFF840100,0x37A5B341,0xAFC1DF61,0x2B70E331,0x94D27D61,0x202730FF,0x508DD11F
+	.word 0xD05FD00F,0x111FF041,0xD7B2FF67,0x1000F722,0x00F0EBF2,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FD
+	.word 0xF000F000,0x1000F000,0x00F00000,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFE00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x000000E0
 
 	.section .rodata
 	.align	2
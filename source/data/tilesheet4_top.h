@@ -6,8 +6,8 @@
 //	tilesheet4_top, 1184x24@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 444 tiles Metatiled by 4x3 not compressed
-//	Total size: 512 + 14208 = 14720
+//	+ 444 tiles Metatiled by 4x3 lz77 compressed
+//	Total size: 512 + 2180 = 2692
 //
 //	Time-stamp: 2021-04-06, 09:05:25
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET4_TOP_H
 #define GRIT_TILESHEET4_TOP_H
 
-#define tilesheet4_topTilesLen 14208
-extern const unsigned int tilesheet4_topTiles[3552];
+#define tilesheet4_topTilesLen 2180
+extern const unsigned int tilesheet4_topTiles[545];
 
 #define tilesheet4_topPalLen 512
 extern const unsigned short tilesheet4_topPal[256];
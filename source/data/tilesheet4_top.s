@@ -6,8 +6,8 @@
 @	tilesheet4_top, 1184x24@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 444 tiles Metatiled by 4x3 not compressed
-@	Total size: 512 + 14208 = 14720
+@	+ 444 tiles Metatiled by 4x3 lz77 compressed
+@	Total size: 512 + 2180 = 2692
 @
 @	Time-stamp: 2021-04-06, 09:05:25
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,508 +17,86 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet4_topTiles		@ 14208 unsigned chars
+	.global tilesheet4_topTiles		@ 2180 unsigned chars
 	.hidden tilesheet4_topTiles
 tilesheet4_topTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x22220000,0x22222200,0x22222220,0x22222220,0x22222220,0x22222240,0x22222200
-	.word 0x00000000,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222226,0x22222222
-	.word 0x00000000,0x00000222,0x00002222,0x00022222,0x20022222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00222222,0x02222222,0x02222222,0x02222222
-
-	.word 0x22222200,0x22222220,0x22222220,0x22222220,0x22222220,0x22222220,0x22222240,0x22222400
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222622
-	.word 0x02222222,0x02222222,0x02222222,0x02222222,0x02222222,0x02222222,0x02222222,0x02222222
-	.word 0x22222000,0x22444000,0x44000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222244,0x22222400,0x22224000,0x22240000,0x44400000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x24444444,0x40000000
-	.word 0x04222222,0x00222222,0x00222222,0x00222222,0x00422222,0x00042222,0x00004222,0x00000444
-
-	.word 0x22222224,0x22222220,0x22222240,0x22222400,0x22224000,0x22220000,0x22240000,0x22200000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22262222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x42222222,0x02222222,0x04422222,0x00022222,0x00022222,0x00022222,0x00042222,0x00002222
-	.word 0x22400000,0x22000000,0x22000000,0x22000000,0x24000000,0x40000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222240,0x44444400
-	.word 0x22222222,0x22222222,0x22222222,0x42222222,0x02222222,0x02222222,0x00442222,0x00004444
-	.word 0x00004422,0x00000042,0x00000004,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x20000000,0x22200000
-	.word 0x00000000,0x00000000,0x00000000,0x22220000,0x22222000,0x22222200,0x22622222,0x22222222
-	.word 0x00000000,0x22000000,0x22222000,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22200000,0x22200000,0x22200000,0x22200000,0x22200000,0x22400000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222400,0x22224000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22240000,0x44400000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222224,0x22222440,0x22222000,0x22224000,0x22220000,0x44440000
-
-	.word 0x22222224,0x22224440,0x24440000,0x40000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222224,0x22222440,0x22224000,0x22240000,0x22200000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22622222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22220000,0x22222000,0x22222200,0x22222400,0x22224000,0x22220000,0x44000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x00044442,0x00000004
-	.word 0x22222222,0x22222222,0x22622222,0x22222222,0x22222222,0x22222222,0x22222220,0x22222220
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222224,0x22222240,0x22244400,0x22400000,0x44000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x22222220,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000022
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22000000,0x22000000,0x22200000,0x22200000,0x22220000,0x22220000,0x22222000,0x22222220
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x62222222,0x22222222,0x22222222
-	.word 0x00022222,0x00022222,0x00222222,0x00222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00022222,0x02222222,0x02222222
-
-	.word 0x22222220,0x22222220,0x22222240,0x22222400,0x22222000,0x22224000,0x22220000,0x22220000
-	.word 0x22222222,0x22222222,0x22222222,0x22262222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x02222222,0x02222222,0x04422222,0x00022222,0x00042222,0x00004222,0x00000222,0x00000422
-	.word 0x22240000,0x22400000,0x24000000,0x22000000,0x22222200,0x22222200,0x22222200,0x22222400
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22622222,0x22222222,0x22222222,0x22222222,0x42222222,0x02222222,0x22222222
-	.word 0x00000222,0x00002222,0x00002222,0x00004222,0x00000422,0x00000044,0x00000000,0x00002000
-
-	.word 0x22244000,0x22200000,0x22200000,0x22220000,0x22222000,0x22222200,0x22222200,0x22222220
-	.word 0x22222222,0x22222222,0x22222222,0x22226222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00222222,0x00222222,0x00222222,0x00222222,0x00222222,0x00222222,0x00422222,0x02222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x20000000,0x22000000,0x22222000,0x22222200,0x22222220,0x22222220,0x22222200,0x22222200
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x22222200,0x22222220,0x22222220,0x22222220
-	.word 0x00000000,0x22000000,0x22000000,0x22200000,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222220,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x22200000,0x22220000,0x22222000,0x22222220
-	.word 0x22222220,0x22222220,0x22222200,0x22222220,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222622,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222224,0x22222240,0x22222200,0x22222400,0x22222000,0x22224000,0x22440000,0x22000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22226222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22000000,0x22000000,0x22000000,0x22000000,0x22000000,0x22200000,0x22220000,0x22222000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222622,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222000,0x22222000,0x22222000,0x22222200,0x22222200,0x22222220,0x22222220,0x22222220
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222262,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000222,0x00002222,0x00022222,0x00222222,0x02222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222262,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00022222,0x00222222,0x00222222,0x02222222,0x22222222,0x22222222,0x22222222,0x42222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x00000002,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x42222222,0x04422222,0x00044222,0x00000222,0x00000444
-	.word 0x04222222,0x00422222,0x00022222,0x00044444,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22622222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222226,0x22222222,0x22222222,0x44222222,0x00422222,0x00022222
-	.word 0x42222222,0x02222222,0x04222222,0x00422222,0x00042222,0x00004444,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x44222222
-	.word 0x00042222,0x00002222,0x00022222,0x00222222,0x00222222,0x00222222,0x00044044,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x22222222,0x44422222,0x00044222,0x00000422,0x00000022,0x00000022,0x00000042,0x00000004
-	.word 0x00444444,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000022,0x00022222,0x02222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000022,0x20000022,0x20002222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x22220000,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x22000000,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222226,0x22222222
-	.word 0x22222222,0x22222222,0x26222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x44422222,0x00044444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22244422,0x24400044,0x40000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x42222222,0x04422222,0x00044444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22224444,0x22240000,0x24400000,0x40000000
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22262222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222226,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x44222222,0x00422222,0x00044222,0x00000222,0x00000444
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222244,0x22222400,0x44444000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x44442222,0x00004222,0x00000222,0x00000444,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222224,0x22444440,0x22000000,0x24000000,0x40000000
-	.word 0x00000000,0x00000222,0x00022222,0x00022222,0x00222222,0x02222222,0x02222222,0x00222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00222622,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000022,0x00000022,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00002222,0x00022222,0x00022222,0x00022222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x26222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00022222,0x00002222,0x00222222,0x02222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000002,0x00002222,0x00022222,0x02222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x42222222,0x02222222,0x02222222,0x04222222,0x00422222,0x00022222,0x00042222,0x00002222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222226,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00004222,0x00002222,0x00002222,0x00002222,0x00002222,0x00002222,0x00000222,0x00002222
-
-	.word 0x22262222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00022222,0x00022222,0x00022222,0x00022222,0x00022222,0x00022222,0x02222222,0x02222222
-	.word 0x00000000,0x00000002,0x00000222,0x00002222,0x20022222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x22000000,0x22200000,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000002,0x00000222,0x00022222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x22200000,0x22200000,0x22222000,0x22222220,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22622222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22622222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x26222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222262,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x62222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x05511111,0x01111111,0x00111111,0x00111111,0x00011111,0x00001111,0x00000111,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000055,0x00000555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00005535,0x00055555,0x00055555,0x00555555,0x00555555,0x05555555,0x05555555,0x03355555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0x55355550
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x55500000,0x55555555,0x55555555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000005
-	.word 0x55535555,0x55535555,0x55535555,0x11155555,0x01135535,0x01555555,0x05555551,0x05555511
-	.word 0x55355555,0x13555555,0x11111135,0x00001111,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x11113555,0x00111111,0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00005555,0x00000555,0x00000055,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55550000,0x55500000,0x55000000,0x50000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x00000055,0x00000555,0x00005555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0x55000000,0x55500000,0x55550000
-	.word 0x00005555,0x00000555,0x00000055,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x00000055,0x00000555,0x00005555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55550000,0x55500000,0x55000000,0x50000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0x55000000,0x55500000,0x55550000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x00000055,0x00000555,0x00005555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0x55000000,0x55500000,0x55550000
-
-	.word 0x00005555,0x00000555,0x00000055,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55550000,0x55500000,0x55000000,0x50000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55550000,0x55500000,0x55000000,0x50000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00005555,0x00000555,0x00000055,0x00000005,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000005,0x00000055,0x00000555,0x00005555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x50000000,0x55000000,0x55500000,0x55550000
+	.word 0x00378010,0x00F0007F,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x008000F0,0x00224B22,0x80202202,0x03004003
+	.word 0x30DB1310,0x2600F01D,0x1F200740,0x00412002,0x10027D03,0x603E1003,0x2069F000,0x03500256
+	.word 0xA077D0DF,0x77F0247F,0x00F000F0,0x6B60A4C0,0x0003F0E2,0x006C007F,0xA7104440,0x17F1D544
+	.word 0x4044FB70,0x9800008F,0x70080000,0xF1340000,0x4400701B,0xDA244444,0xC6101E00,0x304A5104
+	.word 0x03004203,0x00004704,0x04440006,0xEFB04910,0x50FE5F30,0xF14AA163,0xF000F07D,0x30700000
+	.word 0x00FB42EB,0x409F2187,0x21830003,0x0510409D,0x20FE0390,0xD0FFD0B7,0x00AF2000,0x516BF0E4
+	.word 0x00F7445B,0x003F001E,0x00EA0003,0x00F0EA00,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+
+	.word 0xDF00F000,0x007000F0,0xB09F1120,0x12130112,0x7F0A214F,0x50052062,0x30CAF118,0xE056F000
+	.word 0xFF072266,0xB32103B0,0x00F07140,0x4B425720,0x7FF000F0,0xF000F0FF,0x5000F000,0xF00B7300
+	.word 0x129F7000,0x10407FE7,0x526F2393,0x102403E3,0x00450217,0x77A2FF0B,0x4380DFF0,0x54F18363
+	.word 0x833100B0,0xF0FE00F0,0xF100F0FF,0x349FB3D3,0x3051F02F,0x03FF4200,0xF0F312DC,0x5400308B
+	.word 0xF06FF0E7,0xFF00F000,0x00F000F0,0x3F213FF1,0x75017310,0xB7F14342,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0xF9510020,0xFB8019F0,0x00F012F0,0x53FFF764,0x00DF415B
+	.word 0xF15DF260,0x654F75CC,0xFF5FF2E3,0x2F3070D0,0xEFD62725,0x4DD01FB3,0x00F0F7F5,0x4500E0FF
+	.word 0x36FF558F,0x25B3277B,0x130B6294,0xA896FF7F,0x00F07FF7,0x00300EF1,0x72100756,0x30F75151
+
+	.word 0x62730077,0x00410574,0x7BA1D003,0x41FF6B53,0xF066F017,0xB100F000,0x5703F082,0xFF9D1087
+	.word 0x00F000F0,0x00F000F0,0xE58000F0,0xF763D760,0xF00350FF,0xB200F000,0xD227A93C,0xF000D0C3
+	.word 0x1CC1FF11,0xFFA2AEF0,0x4BF0AF90,0x9EF200C0,0xC0FF00F0,0x10936400,0x29FFA203,0xF030F093
+	.word 0xFF00B000,0x00F023F2,0x03F0FFB0,0x00F00381,0x07F100F0,0xF012F0FF,0x107F4000,0x100350EF
+	.word 0x9103000F,0x00F0FF77,0x00F0E6F0,0x00F000F0,0xBFCBFF60,0x60FC9F6B,0xF000F01F,0xF000F000
+	.word 0x0000F000,0xC7F0FF00,0x5BA500D0,0x00409760,0x00A05A1A,0xF3FBD013,0x8300F0D4,0x254FA04E
+	.word 0x23054227,0x1BF74400,0x0513009F,0x022B1437,0xC5FAAD08,0xF0FF00F0,0xF000F000,0xF100F07F
+	.word 0x7000F0E5,0xFB72C200,0xB3305109,0x3721D330,0x2B04C740,0xFC7FF097,0x00F000F0,0x670000E0
+
+	.word 0xA7C1473C,0x40734400,0x00F02BF1,0x44427F50,0x6F117321,0x001310FF,0x0C335C03,0xF034F062
+	.word 0xF000F000,0x00F0FF00,0x8F876B40,0x27A000E0,0x15B46025,0xF0FF45F1,0xF020F03F,0xF000F000
+	.word 0xF4009000,0xF712F062,0x00F000F0,0x005000F0,0x117A0142,0xBF00C0DB,0x07443B0A,0x2BD300B4
+	.word 0x3037F0AB,0xFF47133C,0x171F3FF0,0x1F5F3F6F,0x00F000F0,0xEEF000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00D0BDF0,0x7FB4B733,0x874C20D0,0xC0FF1833,0x3547031D
+	.word 0x90AA54CF,0x376B3D1D,0xFF030057,0xFF25C371,0x334AC7AA,0x00F0FEF5,0x00F000F0,0x6300F0DF
+	.word 0x33FB2657,0x7FC30090,0x4FD05FFB,0x308B64FF,0xD000F003,0xF096F12F,0x7000F000,0x6710FF00
+	.word 0x43F44720,0x9B269FF0,0x73F42F85,0xF0FF00F0,0xF000F000,0x55007000,0x4C0386FF,0xFF61FC07
+
+	.word 0x00F000F0,0x34F100E0,0xFF8B7D90,0x73680390,0xF03DF0FF,0xF000F000,0x3000F000,0xB00B7200
+	.word 0x1331FF03,0x03799361,0x8262DFF5,0xD7A191F9,0xD0FF4763,0xFEDF4C1F,0xF000F053,0xF000F000
+	.word 0xFF008000,0x00F033F8,0x3BF000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF200A000,0xF000F010
+	.word 0xF000F000,0x0080FF00,0x00F0E9F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF0000000
+	.word 0xF000F0B6,0xFF00F000,0x11F50060,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0x8000F000
+	.word 0x111100F0,0x11110551,0x00017611,0x100B0003,0x03000103,0xFF011700,0x00F02BF0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FD00,0x00F000F0
+	.word 0x00F000F0,0x10550010,0xF0057E03,0xF000F017,0xF000F000,0x35005000,0x556800B5,0x03306800
+	.word 0x05035055,0x35310330,0x6031F003,0x55505000,0xF0FE3D10,0x001A0000,0xF000303E,0x1000701B
+	.word 0x553055DE,0x50250053,0x35111503,0x01132555,0x51010800,0x30117F00,0x46109F83,0x9C023513
+	.word 0x27E19712,0xAEF21840,0xF00030FF,0x103FC017,0x108800FF,0xF06EF1A8,0x00F0EF00,0x61F000F0
+	.word 0x11CE2150,0xF01FF018,0x00F0FF00,0x00F000F0,0x00F000F0,0x00D000F0,0x10FF9321,0xF1131103
+
+	.word 0xF000F0BD,0xB000F000,0xFF031100,0x21321341,0x00F07FF1,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00D0FF00,0x00F07FF1,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0x9000F000,0xF0FFF200,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xA2000000,0xF01EF0FF,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF0FFF200,0xFF00F000,0x00F000F0,0x7FF40080,0x00F07FF4
+	.word 0x00F000F0,0x1000F0FF,0xF0FFF26A,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF002000,0x00F07FF1,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xD000F000,0xFFF2FF00,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x005000F0,0x00F0FFF5,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xC000F000
+	.word 0x7FA78000
 
 	.section .rodata
 	.align	2
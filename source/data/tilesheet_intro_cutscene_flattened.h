@@ -6,8 +6,8 @@
 //	tilesheet_intro_cutscene_flattened, 3368x8@4, 
 //	Transparent color : FF,00,FF
 //	+ palette 256 entries, not compressed
-//	+ 421 tiles not compressed
-//	Total size: 512 + 13472 = 13984
+//	+ 421 tiles lz77 compressed
+//	Total size: 512 + 2188 = 2700
 //
 //	Time-stamp: 2021-04-06, 09:05:26
 //	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -18,8 +18,8 @@
 #ifndef GRIT_TILESHEET_INTRO_CUTSCENE_FLATTENED_H
 #define GRIT_TILESHEET_INTRO_CUTSCENE_FLATTENED_H
 
-#define tilesheet_intro_cutscene_flattenedTilesLen 13472
-extern const unsigned int tilesheet_intro_cutscene_flattenedTiles[3368];
+#define tilesheet_intro_cutscene_flattenedTilesLen 2188
+extern const unsigned int tilesheet_intro_cutscene_flattenedTiles[547];
 
 #define tilesheet_intro_cutscene_flattenedPalLen 512
 extern const unsigned short tilesheet_intro_cutscene_flattenedPal[256];
@@ -6,8 +6,8 @@
 @	tilesheet_intro_cutscene_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2188 = 2700
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,86 @@
 
 	.section .rodata
 	.align	2
-	.global tilesheet_intro_cutscene_flattenedTiles		@ 13472 unsigned chars
+	.global tilesheet_intro_cutscene_flattenedTiles		@ 2188 unsigned chars
 	.hidden tilesheet_intro_cutscene_flattenedTiles
 tilesheet_intro_cutscene_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x99777777,0x99997777,0x99999777,0x66999977,0x66996977,0x66669667,0x99666667,0x66666667
-	.word 0x77777999,0x77799699,0x77999999,0x79966966,0x76999966,0x96966696,0x99966696,0x96666996
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x69966667,0x96966667,0x99666677,0x66666677,0x96699777,0x66967777,0x99777777,0x77777777
-	.word 0x99999999,0x99999999,0x79999996,0x79999969,0x77999999,0x77799996,0x77777999,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777755,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x55555555
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777755
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777,0x77777777
-	.word 0x77777777,0x77777777,0x55577777,0x55555555,0x33333333,0x33333333,0x33334443,0x44444444
-	.word 0x77777777,0x77777777,0x55555555,0x33333355,0x33333333,0x33333333,0x33333333,0x34444433
-	.word 0x77777777,0x55555577,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x77777777,0x55555555,0x33333355,0x33333333,0x33333333,0x33343333,0x33333333,0x33333333
-	.word 0x55555777,0x55555555,0x33333333,0x33333333,0x33444333,0x34444443,0x33888333,0x33333333
-	.word 0x55555555,0x35555555,0x33333333,0x33333333,0x33333333,0x33433334,0x43333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x44444433,0x44444443,0x44444444,0x48888333
-	.word 0x55555555,0x33333333,0x33333333,0x34443333,0x44444333,0x44444444,0x44444444,0x44444444
-	.word 0x55555555,0x33333333,0x44333333,0x44343333,0x33333333,0x33333334,0x33334444,0x34343344
-	.word 0x33555555,0x33333333,0x33333333,0x33333334,0x34433333,0x34444333,0x33333333,0x33333333
-	.word 0x34433333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x43334333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333334,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33344333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555533,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33333333,0x33333333,0x33333333,0x33343333,0x33333333,0x33333333
-	.word 0x55555555,0x33333333,0x33334443,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x55555555,0x55555553,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x77755555,0x55555555,0x33333333,0x33333333,0x33333333,0x33344333,0x43333333,0x33333333
-	.word 0x77777777,0x55555555,0x55333333,0x33333333,0x33333333,0x33333333,0x33333433,0x33333333
-
-	.word 0x77777777,0x77555555,0x55555555,0x33333333,0x33333333,0x33433333,0x33333333,0x33333333
-	.word 0x77777777,0x77777777,0x55555555,0x55333333,0x33333333,0x33333333,0x33434333,0x44433333
-	.word 0x77777777,0x77777777,0x77777555,0x55555555,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x33334444,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444344,0x44333333,0x83333333
-	.word 0x33334444,0x44344444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44338888
-	.word 0x33333444,0x43444434,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444434
-	.word 0x33333333,0x33344444,0x33443333,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-
-	.word 0x33333333,0x33333333,0x34333333,0x33333444,0x33344434,0x44444444,0x44444444,0x44444444
-	.word 0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x34444444,0x44444444,0x44444444
-	.word 0x38888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x43333344,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33444444,0x34444444
-	.word 0x33333333,0x33333333,0x34443333,0x44444443,0x44488833,0x88333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44443344,0x44444444,0x44444388,0x43888333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333344,0x44334443,0x33344444,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333334,0x33344333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33344433,0x33338833,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x44333333,0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333443,0x33333344,0x33333388,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33334444,0x43333833,0x44433333,0x83333333,0x33333333
-	.word 0x33333333,0x33333333,0x44433333,0x44443333,0x44444444,0x44444444,0x43388888,0x33333333
-	.word 0x33333333,0x33333333,0x33444444,0x34444444,0x44444444,0x44444444,0x88834444,0x33333388
-	.word 0x33333333,0x33333333,0x33333333,0x44444333,0x44444444,0x44444444,0x44444443,0x44443883
-	.word 0x33333333,0x33333333,0x33333333,0x33333344,0x33333444,0x44334444,0x44444444,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x34444443,0x44444444,0x44444444,0x44444444
-	.word 0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33344443,0x34444444,0x44444444
-
-	.word 0x33333333,0x34333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33443333,0x44444433,0x33888333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444438,0x48888833,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x48834444,0x83333888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444448,0x48888333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x44444444,0x44444444,0x44444444,0x44444444,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444444,0x33338888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33334444,0x34444344,0x44444443,0x33888333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333334,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888833,0x88888888,0x88888883,0x88888333,0x88833333,0x88333333,0x88333333,0x88833333
-
-	.word 0x33333388,0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333338,0x33333388,0x33333388,0x33333888,0x33333888,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x88888833,0x88888833,0x88888333,0x88888333,0x88888333,0x88888333
-	.word 0x33333333,0x33333333,0x33333338,0x33333388,0x33333388,0x33333888,0x33338888,0x33888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444443,0x44444433,0x44443333,0x44433333,0x83333333,0x33333333,0x33333333,0x33333333
-	.word 0x34444444,0x44344444,0x44444444,0x44444444,0x44444888,0x38883333,0x33333333,0x33333333
-	.word 0x44444443,0x44444344,0x44444344,0x33334444,0x33333333,0x33333333,0x44433333,0x43344333
-	.word 0x33444444,0x44444444,0x44444444,0x44444444,0x44444333,0x44433333,0x44333333,0x44444444
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x38888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333433,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x34443333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88833333,0x83333333,0x33333333,0x33333888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333888,0x33333338,0x33333338,0x33888838,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x88883333,0x88888333,0x88888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x83338888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x83333333,0x88888833,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888333,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333388,0x33338888,0x33888888,0x38888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333388,0x33333888,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x34444444,0x44388888,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444444,0x44444444,0x44444448,0x44444433,0x88883333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888883,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x38888888,0x88388888,0x88883333,0x88333333,0x88883333,0x88888833,0x88888883,0x88888888
-	.word 0x33333333,0x33333888,0x88888888,0x88888888,0x88888888,0x33888888,0x88888888,0x88888888
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333388,0x33333338,0x33333333,0x33333333,0x33888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44444333,0x43333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x34444444,0x44444444,0x48888833,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x44433333,0x44444444,0x44444444,0x44444444,0x44444883
-	.word 0x33333333,0x33333333,0x33333333,0x33333444,0x44434444,0x44444444,0x44444444,0x44444444
-
-	.word 0x33333333,0x33333333,0x33333333,0x44333333,0x44433344,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x33334443,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444,0x44444444
-	.word 0x33333333,0x88888833,0x88888888,0x88888884,0x44888844,0x44444444,0x44444444,0x44444444
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888444,0x88844444,0x88444444,0x84444444
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33338888,0x33338888,0x33388888,0x33388888,0x33888888,0x38888888,0x38888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888833,0x88883333,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333
-	.word 0x38888888,0x38888888,0x33388888,0x33338888,0x33338388,0x88888333,0x83333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33338888,0x33883333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88338883,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x44444488,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88883333,0x88888333
-	.word 0x44444444,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338,0x88888888
-	.word 0x44444444,0x44444444,0x44448833,0x88883333,0x88883333,0x88888833,0x88888883,0x88888888
-
-	.word 0x44444444,0x44444444,0x44444444,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x44444444,0x44444444,0x44444444,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888844,0x88888844,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33338888,0x33888888,0x33888888,0x33888888,0x38888888,0x38888888,0x38888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x38833333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333383,0x33333333,0x33333333,0x38333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333388,0x88888833
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88883333,0x88888833,0x88888888
-	.word 0x88833333,0x88888333,0x88888833,0x88888833,0x88888883,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x38888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333338,0x33333338,0x33333338,0x33333338,0x33333388,0x33333888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x88833333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333338
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888333,0x88833333,0x88333333,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888833,0x88888833,0x88883333,0x88833333,0x88333333
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x33388888,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x33333888,0x33333338,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x83333333,0x33333333,0x33333333,0x33333333,0x33333333
-
-	.word 0x88888888,0x88888888,0x88888888,0x83333888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x33333333,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888833,0x33333333,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888833,0x33333333,0x33333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888833
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x38888888,0x33333888,0x33333338
-	.word 0x33333888,0x33333888,0x33338888,0x33333888,0x33333338,0x33333333,0x33333333,0x33333333
-
-	.word 0x33333333,0x88333333,0x88833333,0x88833333,0x88833333,0x83333333,0x88333333,0x88333333
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33338888,0x33888888,0x38888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x33333333,0x33333333,0x33333333,0x33333333,0x33333338,0x33333388,0x33333888,0x33338888
+	.word 0x0034A010,0x00F0006D,0xF07700A0,0x9900D000,0x99100200,0x03009777,0x77669999,0x66996900
+	.word 0x66669667,0x66661167,0x66030099,0x1D007999,0x00799620,0x6677991A,0x79009669,0x76999966
+	.word 0x40966696,0x99030096,0x96666996,0x00F0FF11,0x6EF000A0,0xB1F000B0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x3000F0DF,0x00F02200,0xB1F100A0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0F000F0,0xF000F000,0x7700F000,0x26666777
+	.word 0x03006996,0xAA037796,0x00660300,0x96699777,0x66967777,0x031A00F0,0x30D913D7,0x99999600
+	.word 0x00696F79,0x96C71303,0xD713D403,0x00F000F0,0xB000F0FF,0xF051F200,0xF000F000,0xF000F000
+
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF003000,0x00F091F1,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFD00F000,0x00F000F0
+	.word 0x00F000F0,0x002000F0,0xFF12F055,0x00001C80,0x1FF015F0,0x1E6000F0,0x1C901FF0,0xF01FF0FF
+	.word 0xF000F01F,0xF000F01F,0xF01FF01F,0x1FF0FF1F,0x1FF01FF0,0x1FF000F0,0x23401FF0,0xB0FF19F0
+
+	.word 0xF015F043,0x7000F01F,0xF000F063,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0D4,0x6F215700,0x43004033,0x33331E44,0x50000044,0x501CA01D,0x443E4400,0xF01C7034
+	.word 0xF000101E,0x3400103B,0x301F70F4,0x001E7076,0x57004378,0x886B8333,0x5A400E20,0x433DB035
+	.word 0x1F502920,0x4493C0BB,0x00203F00,0xB0484300,0xF757001F,0x00401C50,0xF1001F80,0x30030034
+	.word 0x9B3D009D,0x34341000,0xB5303E90,0x70431043,0x0F10FFC0,0x10E000C0,0xAF20AD30,0x13F01FF0
+	.word 0xF0FF3BF0,0xF000F01D,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x37F20000
+	.word 0x1FF01ED0,0xC01FF0FE,0x502F7100,0xF0CF121F,0x531F3000,0x8043F0DF,0xBF22751F,0x8F3114A0
+	.word 0xDF52CF21,0xF02A10FF,0xC01F6082,0x200A6243,0x1043F01F,0x2310AF22,0x757F7343,0x00A02360
+
+	.word 0x0090CDB2,0x601FF0FA,0x10030300,0x8303001A,0x6744E722,0x0023F034,0x10888800,0x6315131A
+	.word 0x00A0FF52,0x63303510,0x6BF03123,0x11318560,0x34784B30,0x831027A0,0x9070D3F0,0x7F888888
+	.word 0x2095F138,0xF09320BC,0x20436019,0x47118047,0x33301034,0x33104888,0x53E05C34,0x117340CF
+	.word 0x7188831F,0x1277B0A4,0xFF5A204B,0xFA8199F0,0x00F0B3F3,0x33005CE0,0x00F099F0,0xF000F0FF
+	.word 0xF000F000,0xF000F000,0x01994000,0xEDF0FFA6,0x00E000F0,0x70F10611,0x642000F0,0x387D2810
+	.word 0xAD231C13,0x915617C2,0xA1381752,0xEF51DC9F,0x02832170,0xA38CD0BE,0x7F834402,0x233FB238
+	.word 0x82AF1014,0xB342F0CA,0xFF17F12C,0xE3222310,0x12402720,0x6B400CF2,0x00F000F0,0xC000F0FF
+	.word 0xF0EB36B5,0xF000201A,0x01009018,0x13039D02,0x19F04888,0x29115761,0xC7EB0248,0x1F70A7E3
+
+	.word 0x47484444,0xF41FF06F,0x1FF0FF0F,0x00F06F64,0x03002320,0xBF235401,0x60FFCEF0,0xF04EF100
+	.word 0xF000F000,0xF000F000,0xEF0060FB,0x0010A004,0x00886D02,0x209C009B,0xFF0340A0,0xC3148332
+	.word 0x00E02640,0x44124650,0x0C003860,0xF00350FF,0xF000F000,0x1000F000,0x10032084,0x0390FF92
+	.word 0x7B307FF0,0x9E800800,0x00F000F0,0xF0FF00F0,0xF000F000,0xF100C000,0x220090F0,0xFF572213
+	.word 0x37F40310,0xB2738733,0x2300FE05,0x12245971,0xE60410FF,0x32881A4D,0x27BFA272,0xF267203B
+	.word 0x6A71FFCF,0x1DF0EF61,0xDEF10070,0x00F000F0,0xF0FF00F0,0x2000F000,0xF020F300,0xF095F400
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0x22004000,0x3233225F
+	.word 0x0000C0F7,0xA711FF13,0x42330320,0x0060BFF3,0x1FF05333,0xC0BF1DF0,0x78F0831F,0x31E01F40
+
+	.word 0x12F0A1F0,0x34FF5FB0,0xA0026483,0xB40FF12F,0xF000F083,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x7FF50060,0xDF130040,0xF8D200FF,0x761F702F,0xD1AF239F,0xF0BB4593,0x1F50DF00,0x21382F01
+	.word 0x311A313D,0x20965144,0x37F2FF23,0x57D10F60,0x76F05291,0x00F000F0,0xF0FF00F0,0x2000F000
+	.word 0xFAF73B00,0x680040D7,0xDF0FF8B3,0x00804070,0x804B2583,0xB03B293F,0xFB62E023,0x553043C0
+	.word 0x3FA027F8,0x00844B41,0xD7240803,0xEFD21FA0,0x44240044,0x1A100400,0x10FF0300,0xF000F032
+	.word 0xF000F000,0xF000F000,0xFE00F000,0x00F000F0,0x00F000F0,0x004000F0,0xFF38DB53,0xE3630340
+	.word 0xC3F1E723,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x03210010,0x86FC2561,0x1FE44FF1,0x11FF4B41,0x140F005B,0xF4373965,0x2037A06F,0xFF18F005
+
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x84F0AA20,0x130090FF,0xF0061024,0x537B3619,0x2A1DD063
+	.word 0x0000FF2F,0x0900A763,0x1F958952,0x00B0ABF3,0xF0FF1FF0,0xF0181000,0xF000F01C,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0xBFF70000,0x410080FF,0x40BE6B89,0xF7DF5303
+	.word 0xF000F0A1,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xE000F000,0xFFBFFF00,0x0EB01DA0,0x00F02BF0,0x00F000F0,0xDF417033,0x7800F0FF,0x14C12340
+	.word 0xFAF8416F,0xF000F00E,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x000000F0,0x0080DFF3,0x905892FF
+	.word 0xF0835B03,0xF000F000,0xF2BD6200,0xCCF2FF5F,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0
+
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0xEB2700D0,0x4BF14721,0xCB911410,0xB1250350
+	.word 0xF03330FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0xFD310070,0xA3EC16F0,0xFDF00060
+	.word 0xE9FF1FE0,0xF05BC013,0xF000C01F,0xC01FC01F,0xFFD7F023,0x1DF023B0,0x00F027B0,0x00F000F0
+	.word 0x2741D303,0x21275FFF,0x903BC1F5,0x500F32A6,0xF2072103,0x00F0FF1F,0x14F08F21,0xDBFF2FB1
+	.word 0x00504FF1,0x10805B94,0x0000001D
 
 	.section .rodata
 	.align	2
@@ -6,8 +6,8 @@
 @	title_1_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2828 = 3340
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,109 @@
 
 	.section .rodata
 	.align	2
-	.global title_1_flattenedTiles		@ 13472 unsigned chars
+	.global title_1_flattenedTiles		@ 2828 unsigned chars
 	.hidden title_1_flattenedTiles
 title_1_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x88885555,0x77888555,0x88888855,0x88888885
-	.word 0x55555555,0x55555555,0x55555555,0x55588885,0x77777778,0x77777777,0x77777777,0x77777788
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55558877,0x55577777,0x55877787
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88855555,0x88855555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x58888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x78777888,0x88778888,0x88788888,0x77788888,0x87788888,0x87888888,0x88888888,0x88888888
-	.word 0x55778887,0x55788887,0x58787777,0x58777887,0x58778888,0x88788888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x88885555,0x87778855,0x78888885,0x88888888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x55555588,0x55577777,0x55777777,0x55877777,0x58877888,0x88878888
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x85555555,0x88555555,0x88885555,0x88888555,0x88885555,0x88888888,0x88888888
-	.word 0x55555555,0x85555588,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-
-	.word 0x55555555,0x55555888,0x55888888,0x58888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x88885555,0x88885555,0x88888555,0x88888855
-	.word 0x88885555,0x88885555,0x88885555,0x88885555,0x88888555,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555558,0x88888588,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x88555555,0x88885555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55558885,0x55888888,0x58888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55588888,0x55588888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555558,0x55555555,0xCCCCCCCC
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x88888855,0x55555555,0xCCCCCCCC
-	.word 0x55555555,0x88885555,0x88885555,0x88888555,0x88888855,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x58888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x85555555,0x88555555,0x88555555,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x55555555,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAACCCCCC,0xAAAAAACC,0xAAAAAAAC,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xACCCCCCC,0xAAAAAAAC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDAAAAAAA,0xDDAAAAAA,0xCDDDDAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDDDDDAAA,0xCCDDDDDD,0xCCCCCCDD,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDDDDDDAA,0xCCCCDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xDDDDDDDA,0xCCCCDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xAAAAAAAA,0xDDDAAAAA,0xCCCDDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCAA,0xCCDDDDDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC22C,0xCCCCC22C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAACCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAC,0xADDCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAACCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCAAA,0xAAAAAAAA
-	.word 0x2CCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x222CCCCC,0x222CAAAA
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA
-
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xDAAAAAAA,0xDDDAAAAA,0xDDDDAAAA,0xCDDDDAAA,0xCCCDDDDA
-	.word 0xAAAAAAAA,0xDDDAAAAA,0xDDDDDAAA,0xCCCDDDDD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCDDDDD,0xCCCCCCDD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x2222CCCC,0x22222CCC
-	.word 0xCCCC2222,0xCCCC2222,0xCCC22222,0xCCC22222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCC22222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAADDCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xAAAAAAAA,0xAAADDDCC,0xDCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAD,0xAADDDDCC,0xDDDCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAD,0xAAADDDDD,0xDDDDCCCC,0xDCCCCCCC
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0xAAAAAADD
-	.word 0x222AAAAA,0x222AAAAA,0x2222AAAA,0x22222AAA,0x222222AA,0x222222AA,0x222222AA,0x22222AAA
-	.word 0xDAAAAAAA,0xDDAAAAAA,0xDDAAAAAA,0xDDDAAAAA,0xDDDDAAAA,0xCDDDDAAA,0xCDDDDAAA,0xCCDDDAAA
-	.word 0xCCCCDDDD,0xCCCCCDDD,0xCCCCCCDD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCC22CCCC,0xCC22CCCC,0xCC2CCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xECCCCCCC,0xEECCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xEEEEEEEC,0xEEEEEEEE,0xEEEEEEEE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCEEE,0xCCCEEEEE,0xCCCEEEEE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222CCC,0x22222CCC,0x22222CCC,0x22222CCC,0x2222222C,0x2222222C,0x22222222,0x22222222
-	.word 0xCCC22222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCCCC222,0xCCCC2222,0xCCCC2222,0xCCC22222
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xAAAADDDC,0xAAADDCCC,0xAADDCCCC,0xADDCCCCC,0xDDCCCCCC,0xDCCCCCCC,0xDCCCCCCC,0x2CCCCCCC
-	.word 0x2222222A,0x2222222A,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCDDDAA,0xCCCDDDAA,0xCCCDDDDA,0xCCCCDDDA,0xCCCCDDDA,0xCCCCDDDD,0xCCCCDDDD,0xCCCCCDDD
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xC22CCCCC,0xC22CCCCC,0x662CCCCC,0x662CCCCC,0x6222CCCC,0x6222CCCC,0x6622CCCC,0x6622CCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC6,0xCCCCCC66,0xCCCCCC66,0xCCCCCC66,0xCCCCCC66,0xCCCCC666
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xC11111CC,0x111111CC,0x11111CCC,0x111CCCCC,0x111111CC,0x111111CC,0x1111111C
-	.word 0xEECCCCCC,0xEEECCCCC,0xEEE11111,0xEEEE1111,0xEEEE1111,0xEEEE1111,0xEEEE1111,0xEEEE1111
-	.word 0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xCEEEEEEE,0xCCEEEEEE,0xCCCEEEEE
-
-	.word 0xCEEE7EEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEEEEE,0xEEEEECCC,0xEEEECC8C,0xEEECCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE,0xCCCCCCCE
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222222,0x2222222C,0x2222222C,0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222
-	.word 0xCCC22222,0xCCC22222,0xCC222222,0xCC222222,0xCCC22222,0xCCC22222,0xCCCC2222,0xCCCC2222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x2CCCCCCC
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCDDD,0xCCCCCDDD,0xCCCCCDDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD,0xCCCCCCDD
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x6622CCCC,0x6622CCCC,0x662CCCCC,0x662CCCCC,0x662CCCCC,0x2222CCCC,0x22222CCC,0x62222CCC
-	.word 0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCCC6666,0xCCC66666,0xCC666662,0xCC666666
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x33111111,0x3311111C,0x33311119,0x33311139
-	.word 0xEEE41111,0xEE441111,0x44441111,0x44499E41,0x44414EE4,0x4434EE43,0x439EEE43,0x334EE433
-	.word 0xCCCEEEEE,0xCCCEEEEE,0xCCCEEEEE,0xCCEEEE44,0xC4444444,0x44444444,0x44444444,0x44444443
-	.word 0xEEECCCCC,0xEEECCCCC,0x4EECCCCC,0x444ECCCC,0x14444CCC,0x93444444,0x43344444,0x43333444
-	.word 0xCCCCCCCE,0xCCCCCC14,0xCCCCC1E1,0x111114E4,0x111114EE,0x1111114E,0x11111144,0x11111114
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCCC111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x222CCCCC,0x222CCCCC,0x222CCCCC,0x222CCCC1,0x222CC111
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCC222,0xCCCCCC22,0xCCCCCC22,0xCCCCC222,0xCCCCC222,0xCCC22222,0xCCC22222,0xCCC22222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x2CCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC2,0xCCCCCCC2,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x2CCCCCCC,0x22CCCCCC,0x2222CCCC,0x2222CCCC,0x22222CCC,0x22222CCC,0x22222CCC,0x22222CCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCD,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCC2CC,0xCCCCC2CC,0xCCCCC22C,0xCCCC622C,0xCCCC622C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x6222CCCC,0x6222CCCC,0x622CCCCC,0x622CCCCC,0x6222CCCC,0x22222CCC,0x22222CCC,0x22222CCC
-	.word 0xC6666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666662,0x66666662,0x66666622
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCCC6,0xCCCCCC66
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x9CCCCCCC,0x99CCCCCC,0x999CCCCC,0x999CCCCC,0x999CCCCC,0x999CCCCC,0x9999CCCC,0x9999CCCC
-	.word 0x33111399,0x11113999,0x11139999,0x11339999,0x11333999,0x13399999,0x339B9999,0x39BBB999
-	.word 0x34444333,0x34E33111,0x33331111,0x11111111,0x11111111,0x11111111,0x11111113,0x11111333
-	.word 0x33333333,0x33333333,0x33333333,0x33331111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x33333333,0x11333333,0x11133333,0x11111133,0x11111111,0x71111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111177,0x11111771,0x77777117,0x77777777,0x77771111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111177
-	.word 0x222111C1,0x22111111,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222221,0x22211111,0x2111C111,0x11C11111,0x11111111
-	.word 0xCCC22222,0xCCCC2222,0xCCCC2222,0xCCCC2222,0xCCCC2222,0xCCCCC222,0xC1CCC221,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22CCCCCC,0x2222CCCC,0x2222CCCC,0xC2222CCC,0xC2222CCC,0x222222CC,0x222222CC,0x222222CC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x22CCCCCC
-	.word 0x22222CCC,0x222222CC,0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCC2622C,0xCC26622C,0xCC6662CC,0xC26662CC,0xC26622CC,0xC26622CC,0xA266222C,0x2266222C
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCA,0xCCCCCAA2
-
-	.word 0x22222CCC,0x222222CC,0x2222222C,0x2222222C,0x222222CC,0x22222CCC,0x2222CCCC,0x222CCCCC
-	.word 0x66666662,0x66666662,0x66666662,0x66666622,0x66666622,0x66666222,0x66662222,0x66222222
-	.word 0xCCCCC666,0xCCC66666,0xCC666666,0xC2666666,0xC2666666,0xC2266666,0xC2226666,0xC2226666
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999B9CC,0x999BB9CC,0x999BB9CC,0x99BB999C
-	.word 0x9BBBB999,0xBBBBB999,0xBBBB9999,0x99999999,0xBB999999,0xBBBB9999,0xBBBB9999,0xBBBB9999
-
-	.word 0x11113339,0x11113399,0x11113999,0x1113399B,0x111399BB,0x11339BBB,0x33339BBB,0x339999BB
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111113
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77711111,0x77111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111777,0x11177777,0x11777777,0x77777777,0x77777771,0x77777771,0x77777711,0x77771111
-	.word 0x11111111,0x11111111,0x11111111,0x11111117,0x11111177,0x11117777,0x11177777,0x11777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0xCCCCCC11,0xCCCCC111,0xCCCC1111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCC1CC,0x21111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC222222C,0xC2222222,0xC2222222,0xC2222222,0xC2222221,0xCC222211,0xCC111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22662222,0x22662222,0x26222222,0x66222222,0x66222222,0x22222222,0x6222222C,0x222222CC
-	.word 0xCCCAAA22,0xCCAAAA22,0xAAAAA222,0xAAAAA222,0xAAAAA222,0xAAAAA222,0xAAAA2222,0xAAAA2222
-	.word 0x222CCCCC,0x222CCCCC,0x222CCCCC,0x222CCCAA,0x222CAAAA,0x222AAAAA,0x222AAAAA,0x22AAAAAA
-	.word 0x26662222,0x26622222,0x26622222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0xCC226662,0xCC226622,0xC2266622,0xC2266662,0x22666662,0xC2626622,0x22226222,0x26222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC2,0xCCCCCCC2
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0xCCCCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x99CCCCCC,0x999CCCCC,0x999CCCCC
-	.word 0x99B99999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xBBB99999,0xBB999999,0xB9999999,0x99999999,0x99999999,0x99999999,0x99999999,0xBB999999
-	.word 0x3399999B,0x3399999B,0x3399999B,0x99999999,0x999B9999,0x9BBBBB99,0x9BBBBBBB,0x9BBBBBBB
-	.word 0x11111113,0x11111113,0x11111113,0x11111113,0x11111113,0x11111133,0x11111339,0x11113339
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777111,0x77771111,0x77711111,0x71111111,0x11111111,0x11111111
-	.word 0x11111111,0x11177777,0x17777777,0x77777777,0x77777777,0x77777777,0x77771111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111777,0x17777777,0x77777777,0x77777777,0x77777711
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111777,0x11177777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCC11,0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCCC111,0xCCCC1111,0xCCCC1111,0xCC111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x22222CCC,0x22222CCC,0x222222CC,0x222222CC,0x222222CC,0x2222222C,0x2222222C,0x2222222C
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x2CCCCCCC,0x2CCCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC
-	.word 0x2222222C,0x2222222C,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAAAA2222,0xAAAA2222,0xAAA22222,0xAAA22222,0xAA222222,0xAA222222,0xAA222222,0xAA222222
-	.word 0x22AAAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x222AAAAA,0x2222AAAA,0x22222AAA
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xCCCCC222,0xACCCCC22,0xACCCCC22,0xAACAAC22,0xAAAAAC22,0xAAAAAA22,0xAAAAAA22,0xAAAAAA22
-
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCA,0xCCCCCCAA,0xCCCCCCAA,0xCCCCAAAA,0xCCCAAAAA,0xCAAAAAAA
-	.word 0x999CCCCC,0x9999CCCC,0x9999CCCC,0x9999CCCC,0x9999BB9C,0x999BBBB9,0x99BBBBB9,0x99BBBB99
-	.word 0x99B99999,0xBBB99999,0xB1139999,0xB1119999,0x11113999,0x11113999,0x11113999,0x11133999
-	.word 0xBBB99999,0xB9999999,0x9999999B,0x99999999,0x99999999,0x99999991,0x99999911,0x99999111
-	.word 0x9BBBBBBB,0xBBBBBBBB,0xBBBBBBBB,0xBBBBBBB9,0xBBBBBBB9,0xBBBBBB99,0xBBBB9999,0x99999999
-	.word 0x11113339,0x11133399,0x11133399,0x11333999,0x11333999,0x11333999,0x13339999,0x33399999
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77771111,0x77711111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77777771,0x77777711,0x77711111,0x71111111,0x11111111,0x11111111
-	.word 0x11111117,0x11111777,0x11111777,0x11117777,0x11777777,0x77777777,0x77777771,0x77777711
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111177,0x77777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111177
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xC1111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCC1,0xCCCC1111,0xCCC11111,0xCC111111,0x11111111
-	.word 0x2222222C,0x2222222C,0x2222222C,0x2222222C,0x222222CC,0x222222CC,0x222222CC,0x22222CCC
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x22CCCCCC,0x222CCCCC,0x222CCCCC,0x2222CCCC
-
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAA222222,0xAA222222,0xAA222222,0xAAA22222,0xAAA22222,0xAAA22222,0xAA222222,0xAA222222
-	.word 0x22222AAA,0x22222AAA,0x22222AAA,0x22222AAA,0x22222AAA,0x2222AAAA,0x22222AAA,0x222222AA
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222,0x22222222
-	.word 0xAAAAA222,0xAAAA2222,0xAAAA2222,0xAAA22222,0xAAA22222,0xAAA22222,0xAAA22222,0xAAA22222
-	.word 0xAAAAAAAA,0xAAAAAAAA,0xAAAAAAAA,0x9BAAAAAA,0xBB9AAAAA,0xB99AAAAA,0x999AAAAA,0x999AAAAA
-	.word 0x9BBB9999,0x99999999,0x99999999,0x99999999,0x99999999,0x9999999B,0x99999999,0x99999999
-
-	.word 0x11133999,0x1113399B,0x11113999,0x11111111,0x11111113,0x11111133,0x11111339,0x11133333
-	.word 0x99991111,0x99911111,0x99111111,0x91111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999911,0x99999911,0x99999111
-	.word 0x33399999,0x33999999,0x33999999,0x33999999,0x33999999,0x33999999,0x33999999,0x99999999
-	.word 0x11111111,0x11111113,0x11111333,0x11111333,0x11111333,0x11111333,0x11113333,0x11133333
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777111,0x77711111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x77777777,0x77777777,0x77771111,0x77111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11117777,0x17777777,0x77777777,0x77777777,0x77777711,0x77777111,0x77711111,0x77111111
-	.word 0x11111111,0x11111111,0x11111117,0x11111777,0x11111777,0x11117777,0x77777777,0x77777777
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111117,0x11111177
-
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222C11,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222111,0x22111111,0x11111111,0x11111111,0x11111111,0x11111111,0x11111111
-	.word 0x22222222,0x22222222,0x22222222,0x22222221,0x22222111,0x22221111,0x22111111,0x21111111
+	.word 0x0034A010,0x00F00068,0xE05500A0,0x55888800,0x77888513,0x85880600,0x19900300,0x58888502
+	.word 0x70777855,0x00C48800,0x553FF003,0x35007755,0x57077777,0x87778755,0x00F01CF0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x002000F0,0x00F071F1,0x00F000F0
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF1003000,0xF000F091,0xF000F000,0xFB00F000,0x00F000F0,0x00F000F0,0x03850030
+	.word 0xDC031045,0x960300F0,0xF0030058,0x8800F000,0x77780388,0x77888878,0x0C200810,0x870300BA
+	.word 0x03100800,0x03870020,0x882087EA,0x78AF0378,0x77788758,0x105700F8,0x302B1003,0x55759000
+	.word 0x877E7788,0x1C701304,0x08101F80,0x1214F313,0xF703EF77,0x47006600,0xF0BFF087,0xF000F000
+
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000
+	.word 0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FB,0xF000F000,0x85005000
+	.word 0x4B020300,0x209B26FD,0x237F9207,0x7000F028,0x3120581F,0xC637F3FF,0xF000F0DF,0x50832000
+	.word 0xC03F2087,0x89F0FB03,0x00F000F0,0x0000B7F0,0xF00000CC,0x1FF0FC19,0x1FF000F0,0x1FF01FF0
+	.word 0xCCCC1FF0,0x010710DF,0x0C28553E,0x1F201FF0,0x1FF01971,0xB01A50FF,0x141F701D,0x000E10E1
+	.word 0xF09BA103,0x2710BF5F,0xF0034058,0x1000901F,0xF01FF0AF,0x1FF0FF00,0x15F01FF0,0x00F01FF0
+	.word 0x00F01FF0,0xF0FF1FF0,0xF01FF01F,0xF000F01F,0xF000F01F,0xFF00F01F,0x00401FF0,0x13B37FE1
+	.word 0x00F05FF2,0x1FF01FF0,0xF21FC0FF,0x447F301F,0xF060B21B,0xF05FF03F,0x1FF0FF1F,0x1FB019F0
+
+	.word 0x00F000F0,0x00F000F0,0xF0FC00F0,0xF000F000,0xF000F000,0xAC005000,0xAAAA3EAA,0x007015F0
+	.word 0x1FF01E00,0xFFCA1FA0,0x00F014F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFE00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x2FCC00F0,0x0FC02CCC
+	.word 0x13F412AA,0x60005017,0x00F0DE18,0x90AC1F50,0xF000F02F,0xDA000000,0xDD030082,0xCDDDDAAA
+	.word 0x9FDD19F0,0xDDCC0010,0x310077F0,0xB0B01A20,0xE0D936B0,0xCD1D7000,0xF0201CF0,0x38F0CCCC
+	.word 0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF09700F0,0xB0C2CC00,0x03402C03,0x00F000F0,0xF000F0FB,0xF000F000,0xAC007000,0x0080B7F5
+
+	.word 0x351112CF,0xF0ADDCFB,0xF0CDB21D,0xEFFFE23B,0x1FF05FF0,0xF0CA1FD0,0x0623C01F,0xD01F405A
+	.word 0x0310A313,0x2C03B022,0xF3AAAA22,0x00F00310,0x779300F0,0x4813DDDA,0x00E77B13,0x331F6302
+	.word 0xD3CCCD40,0xF3131025,0x00F0FF1D,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FF00F0,0xF000F000
+	.word 0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00C000F0,0x203BF2CF
+	.word 0x02222203,0x20000042,0x7F030009,0x3003C0C2,0xF000F013,0xF000F000,0xF300F000,0x00F000F0
+	.word 0x00E000F0,0x43F3ADDC,0x23AD0080,0x2320DD43,0x731DF0DC,0x2720ADAB,0x1314DD7B,0x40D3EEA2
+	.word 0x20DD2710,0x7B34264F,0x7062F3DC,0x00680300,0xA3032A00,0x222F0310,0x22060022,0x03700600
+	.word 0x0B570F10,0x730320FF,0x2003409B,0x10BA1665,0xF0C1F66C,0x00F0FF00,0x067200F0,0x00F0FED7
+
+	.word 0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xD600F000,0x000000F0,0xEE0300EC
+	.word 0x180016F0,0x0070EFEE,0x34001DF0,0x000300CE,0xF0031004,0x00F0FF00,0x00F000F0,0x004000F0
+	.word 0x0390A303,0x23FFB213,0xC30060B6,0x93B203B3,0xF000F0D3,0xFF00F000,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0xF000F0FB,0xF000F000,0xDC00F000,0x43347103,0x18FB23F5,0x40D7230F
+	.word 0xA2032C03,0xDF031022,0x003000F0,0x004317AA,0x034B1703,0xFE0320AE,0xB743B323,0x00F000F0
+	.word 0x009000F0,0x4F2C4959,0x22033066,0x10034062,0x3003000B,0x00C67F00,0xA00C1003,0xF0141003
+	.word 0xF000F000,0x00F0FC00,0x00F000F0,0x00F000F0,0xCCCC00F0,0xC1111111,0xCC110300,0xFC03001C
+	.word 0x0B200400,0x0E000300,0xA3130F00,0x1117EEEC,0x0300E111,0xF003E0EE,0x6E002000,0x23BA13CE
+
+	.word 0x0B207EA3,0xE01300A0,0x1D00FF8C,0x86905710,0x03D0CD13,0x00F000F0,0x70FB00F0,0x53231200
+	.word 0x93BBF3B3,0x034022BF,0xF0FF7F97,0xF000F04F,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x5B0020FF,0x2503F01F,0x9000F03D,0x505B2700,0x3000FF03
+	.word 0x00F003D0,0x00F000F0,0xA7530090,0x23CCBF53,0x62CF55C3,0xF00D0066,0xBFCCC603,0x10661810
+	.word 0xF000F00C,0xF000F000,0xFD00F000,0x00F000F0,0x00C000F0,0x00D0A203,0x02B70333,0x31111933
+	.word 0x03003933,0xE4112811,0x1044A703,0x9E414403,0xE4444900,0x4344414E,0x003440EE,0x33439E03
+	.word 0xD0334EE4,0x03104757,0x44920344,0xDCC44444,0x00200300,0x33030043,0x4E0320A3,0x4ECC01CC
+	.word 0x444CCC44,0x00160014,0x34444493,0x33344443,0xA3134350,0xE1030014,0x35CCCCC1,0x110414E4
+
+	.word 0x004E0300,0x03004484,0x140A00F7,0x0000603F,0x6904CC22,0x1A40B3A0,0x2C234BA9,0x00C10360
+	.word 0xF2C11103,0xBEF3FF3E,0x0B10548B,0x93777F27,0x00F000F0,0xF0FF00F0,0x6200F000,0x5F00E0E3
+	.word 0xF000F086,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0xB168C760,0xF0EFD8FF,0x1700B000
+	.word 0xF003F062,0x41002000,0x4D27FF18,0x03104107,0x00D000F0,0x31506F57,0x80DF0B00,0xC6A3039F
+	.word 0x00A00300,0x0320BB03,0x50FF1C10,0xD08A1745,0xF0DDF303,0xF000F000,0xAD00F000,0x009C00A0
+	.word 0x06009903,0x209903C0,0x13990003,0x39993311,0x10811111,0x33999908,0x00399911,0x39990003
+	.word 0x9B999913,0xB9089933,0x033339BB,0xE3311165,0xD2033476,0x0070CB03,0x00E81313,0x80F63304
+	.word 0x2423D000,0x331A400C,0x1C802C00,0x36F48871,0x10771111,0x11111718,0x7771171F,0x11000020
+
+	.word 0x00F01210,0x00C30000,0xC12F2026,0x00222111,0x77031006,0x0025F021,0x21008018,0x26000300
+	.word 0x10BCD703,0x1F40C12B,0x03606B77,0xC2211F02,0x2020CC7F,0x00704EF1,0x00F04F14,0xDB8240F2
+	.word 0x0320C27F,0xE1F7EC77,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0x5000F000,0x13B73300
+	.word 0xDBF8FD07,0x00F000F0,0x56F00020,0x016264C0,0x26621E32,0x101007CC,0x303B0103,0x221D2C03
+	.word 0x0300A266,0x00403FF0,0x7F0300CA,0xC00410A2,0x1073219F,0x27932113,0xFFAFA380,0x0C000320
+	.word 0x2A00D913,0x8F278A17,0x0300CA13,0x0330C257,0x22030026,0x79F00320,0xF0FD00F0,0xF000F000
+	.word 0x33005000,0xB90360A7,0x9B420310,0x999C0320,0xA30399BB,0x0300FE9B,0x03100800,0x0B400020
+	.word 0xCE030330,0xD603C011,0x1111D703,0x1113399B,0xE703BB45,0x10339BBB,0x20003303,0xD3AFE3F7
+
+	.word 0xD000F0E3,0x86137100,0xD353A7F3,0x77A803BF,0xCE130400,0xDA13D313,0x10200310,0x53DFC3FF
+	.word 0x301930D3,0xF000F033,0x8000F000,0x4101FE00,0xABF8F337,0x1738DFA3,0x2A0243E4,0xE517EFC2
+	.word 0x43040350,0x5C3404C2,0x801FF4A2,0x1FF4FF00,0x00F01FF0,0x00F000F0,0x00F000F0,0x68FF0060
+	.word 0x2C03F09E,0xF000F09E,0xF300F000,0xEE00F0BF,0x46236020,0x40262A10,0x010C2008,0x20846257
+	.word 0xCCCAAA7D,0x22820F22,0xAAAA3DA2,0x140003A0,0x93990310,0x590310AA,0x2A0310AA,0x22000340
+	.word 0x57006622,0x0340626E,0x046200F0,0x00261422,0x6261C226,0xDA130320,0x6222C262,0x04FF1E20
+	.word 0x1000F058,0xF043F900,0x03008000,0xFB03D09B,0xA0036737,0x00F09643,0x13B90030,0xDE0310B7
+	.word 0x170028F0,0x50A3039B,0x00123003,0xBB1FBB09,0x0340BB9B,0x03D0A313,0xEA03D413,0xFB13117F
+
+	.word 0x00F000F0,0x00A000F0,0x1C9084F3,0x040040FD,0x24CF4306,0x43DFA70F,0x2B5017CB,0x40DBF7FF
+	.word 0x702B2427,0x3000F427,0x44272400,0x00F0FF57,0x00F000F0,0x00F000F0,0x28380060,0x20FF00F0
+	.word 0x24FC1100,0x6027F063,0x7C00501F,0xFF8F647F,0x00D049F2,0x33886B5A,0x6FF7CB56,0x00F000F0
+	.word 0x90BFF3FE,0x6403406D,0xD067F01F,0xA2AB5300,0x220340BE,0xA31303A0,0x0390AF73,0xFA2A1C00
+	.word 0x00F04DF0,0x00A000F0,0x20AC7F3D,0xCA0FAC03,0x20AC22AA,0x50036070,0xEF0A18D8,0x03200C10
+	.word 0x04AA0400,0x001E0077,0xB80B7B16,0xE79C0310,0x13961352,0x99B113A3,0xB111991F,0x03602B2B
+	.word 0xBF23331B,0x70B38D07,0x03009100,0x11991800,0xA7430800,0x000020FF,0x10032053,0x37AF5714
+	.word 0x1047009F,0x7B1BFF03,0x10000350,0x00F01D30,0x00F000F0,0xF0FF00F0,0xF000F000,0xD000F000
+
+	.word 0xF0F36300,0xFF1D2000,0xF3770030,0xCB631FB4,0x2F20CF23,0xFFF32768,0x405780FF,0xB019F05B
+	.word 0xF000F023,0xA000F000,0xD7F3F700,0xDFE30080,0x68C1D723,0x6AAB931F,0x0350FF7F,0x00F058F3
+	.word 0xBFD300F0,0x336703F0,0xF0FF2FF0,0x53AF9300,0x13C773C3,0x4303E0A3,0xFF2010BB,0x00F000F0
+	.word 0x008000F0,0x7FB0EB87,0x00C00330,0xAAAA9B05,0x0300BB9A,0x7F0300B9,0x37031099,0xA000B022
+	.word 0x1AA30310,0xF7AF13F7,0x1F970010,0xF91E931E,0x10A80311,0x7F030008,0xF7DFD191,0x43DB4392
+	.word 0x00A313DF,0xFF03F004,0x7360AF47,0x03906F10,0x61FB2D2F,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xC000F000,0xF727FF00,0x0050FFF3,0xF3F7EFC7,0xF3B7F333,0x60FF5370,0x5027F42F
+	.word 0x6000F057,0xF016F02F,0xFB00F000,0xA30300B0,0x007014F0,0x0C11C212,0xFC0A1014,0x1F301DF0
+
+	.word 0x26000050,0x2F602B40,0x00000021
 
 	.section .rodata
 	.align	2
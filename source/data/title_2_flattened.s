@@ -6,8 +6,8 @@
 @	title_2_flattened, 3368x8@4, 
 @	Transparent color : FF,00,FF
 @	+ palette 256 entries, not compressed
-@	+ 421 tiles not compressed
-@	Total size: 512 + 13472 = 13984
+@	+ 421 tiles lz77 compressed
+@	Total size: 512 + 2408 = 2920
 @
 @	Time-stamp: 2021-04-06, 09:05:26
 @	Exported by Cearn's GBA Image Transmogrifier, v0.8.16
@@ -17,482 +17,94 @@
 
 	.section .rodata
 	.align	2
-	.global title_2_flattenedTiles		@ 13472 unsigned chars
+	.global title_2_flattenedTiles		@ 2408 unsigned chars
 	.hidden title_2_flattenedTiles
 title_2_flattenedTiles:
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99499999,0x44999999,0x49999999,0x44449999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999994,0x99999994
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-	.word 0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999299,0x99999999,0x99999999,0x92999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x29999999,0x29999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999992,0x99999992,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999499,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99944999,0x99994999,0x99994999,0x99944999,0x99949999,0x99449999,0x44499999,0x94499999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x44444449,0x99999944,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999944,0x99999449,0x99994499
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x89999999,0x99999999,0x99999999,0x99999999,0x99998899
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99929999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x49999999,0x44999999
-	.word 0x99994999,0x99994999,0x99994999,0x99994499,0x99999949,0x99999994,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99949999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88889999,0x98888889,0x99988888
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99998999,0x99999988,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x69999999,0x66899999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66668999,0x88666668,0x88886666,0x98888866
-	.word 0x99999999,0x99999999,0x98889999,0x99988889,0x99999888,0x99999988,0x99999999,0x99999999
-	.word 0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99949999,0x99949999,0x49949999,0x44449999,0x94499999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999994,0x99999949,0xCC999999
-	.word 0x99999999,0x99999999,0x99999999,0xCC999999,0xCCCCC999,0xCCCCCCC9,0xCCCCCCCC,0xCCCCCCCC
-	.word 0x99999999,0x99999999,0x99999999,0x9CCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x999999CC,0x9999CCCC,0x9999CCCC,0x9999CCCC
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99989999,0x99999899
-	.word 0x99999999,0x88999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88999999,0x99999999,0x99998899
-	.word 0x86669999,0x88888999,0x99888899,0x99998888,0x99999998,0x99999999,0x99999999,0x99999999
-	.word 0x99988888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66669999,0x66666999,0x66666699,0x66666669
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0xCC999999,0xCCC99999,0xCCC99999,0xCCC99999,0xCCC99999,0xCC999999,0x93999999,0x99999999
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x9CCCCCCC,0x33333333
-	.word 0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0xCCCCCCCC,0x33CCCCCC,0x93339CCC,0x99933333,0x99999933
-	.word 0x9999CCCC,0x99993CCC,0x9999339C,0x99999333,0x99999993,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x9AAAA999,0xAAAAA299,0xAAA22229,0xAA277729,0xAA777729
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x9999999A,0x9999999A,0x9999999A,0x9999999A
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88899999,0x88888999,0x98888899
-	.word 0x99999999,0x89999999,0x98899999,0x99888899,0x99998888,0x99999888,0x99999999,0x99999999
-	.word 0x99999889,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0xAA229999,0x22222999,0x22222299,0x77772299,0x77777299
-	.word 0x99999999,0x99999999,0x99999999,0x9999999A,0x999999A2,0x99999222,0x99999222,0x99999227
-	.word 0x99999899,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x69999999,0x66999999,0x66699999,0x66669999,0x66666999,0x66666669,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88999999,0x89999999
-	.word 0xA277D729,0x22777299,0x92222999,0xBB999999,0xBB588899,0xBB588889,0xBB558888,0xBB558888
-	.word 0x9999999A,0x99999999,0x88888899,0x888888BB,0x8888BBBB,0x988BBBBB,0x9BBBBBBB,0x9BBBBBBB
-	.word 0x99988889,0x99998888,0x99999888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x7DD77299,0x7DD77299,0x77772299,0x22222999,0x79999999,0x75559999,0x55555999,0x55555999
-	.word 0x99999227,0x99999227,0x99999922,0x99999992,0x99999997,0x99995557,0x99955557,0x99555555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x39999999,0x33399999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x93339999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66999999,0x66669999,0x66666999
-	.word 0x66999999,0x66669999,0x66666699,0x66666669,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88888899,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88888889,0x88888888,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x89999999,0x88888899,0x88888888,0x88888888,0x88888888
-
-	.word 0x99999999,0x89999999,0x88888999,0x88888888,0x88888888,0x88888888,0x88888888,0x99999888
-	.word 0x99999999,0x99999988,0x99999988,0x99999988,0x99999988,0x99999988,0x99999999,0x99999999
-	.word 0xBB558889,0xB5558889,0x55558889,0x55599989,0x55599999,0x55599999,0x55599999,0x55599999
-	.word 0x555BBBBB,0x5555BBBB,0x55555555,0x55555555,0x55555555,0x55555555,0x99555555,0x99775555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x55555999,0x55555599,0x55555599,0x55555599,0x55555999,0x55555599,0x55555599,0x55555599
-	.word 0x99555555,0x95555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555,0x55555555
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x39999995,0x33999995,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x39999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999939,0x99999933,0x99999993,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66669999
-	.word 0x99999999,0x69999999,0x66699999,0x66666999,0x66666669,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88888899
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x88889999,0x88888888,0x88888888
-
-	.word 0x99999999,0x88999999,0x88888999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888899,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x99999888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x98888888,0x99988888,0x99999998,0x99999999
-	.word 0x88888888,0x88888888,0x88888888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x88888888,0x99988888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x55599999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99779977,0x97799977,0x97799977,0x97999779,0x97999779,0x97999779,0x99999799,0x99999799
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x55555599,0x55555999,0x55559999,0x99779999,0x99779999,0x99777999,0x99777999,0x99977999
-	.word 0x95555555,0x99555555,0x99995559,0x99997779,0x99997779,0x99997799,0x99997799,0x99997999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99993339,0x99999333,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66669999,0x66666699,0x66666669,0x66666666
-	.word 0x66666669,0x66666666,0x66666666,0x66666666,0x76666666,0x77666666,0x77766666,0x77766666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666677,0x66666777,0x66667777,0x66667777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99988888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x99999999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888
-	.word 0x88889999,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x98888888
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x88888888,0x98888888,0x99999998,0x99999999
-	.word 0x88888888,0x88888888,0x88888888,0x88888888,0x99988888,0x99999999,0x99999999,0x99999999
-	.word 0x88888888,0x88888888,0x99988888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99998888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999989,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99979999,0x99979999,0x99979999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99997999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66666999,0x66666669,0x66666666
-	.word 0x66999999,0x66669999,0x66666999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x77766666,0x77766666,0x99766666,0x99766666,0x7776EEE6,0x777EEEE6,0x77EEEEEE,0x66EEEEEE
-	.word 0x66677777,0x66677777,0x66677777,0x66677777,0x66677777,0x66667777,0x66611777,0x67711116
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x88888888,0x88888888,0x88888888,0x98888888,0x99988899,0x99999999,0x99999999,0x99999999
-
-	.word 0x88888888,0x88888888,0x88888888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99998888,0x99999998,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88999999,0x88889999
-	.word 0x99999999,0x99999999,0x99999999,0x66899999,0x66666899,0x66666666,0x88888888,0x88888888
-	.word 0x99999999,0x99999999,0x99999999,0x88666666,0x88886666,0x88888886,0x88888888,0x99999888
-	.word 0x99999999,0x88899999,0x88888899,0x99888866,0x99998888,0x99999988,0x99999999,0x99999999
-
-	.word 0x99988888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66669999
-	.word 0x69999999,0x66699999,0x66669999,0x66666999,0x66666669,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x6EEEEEEE,0x6EEEEEE6,0xEEEEEEE6,0xEEEEEE66,0xEEEEE666,0xEEEEE611,0xEEEEE111,0xEEE111E6
-
-	.word 0x77711166,0x77771766,0x777711EE,0x7777771E,0x7777771E,0x7777711E,0x7777111E,0x7771111E
-	.word 0x66666667,0x66666777,0x66667777,0x66677777,0x66777777,0x67777777,0x77777777,0x77777777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666677
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x88899999,0x88669999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x98888888,0x99988888,0x99999998
-	.word 0x99999999,0x99999999,0x88999999,0x98899999,0x99888999,0x99999999,0x99999999,0x99999999
-	.word 0x88888999,0x99888888,0x99999988,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999888,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66666669,0x66666666,0x66666666
-	.word 0x99999999,0x69999999,0x66669999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0xE1111E66,0x1111EE66,0x111EE666,0x11EE6666,0x11E66666,0xEEE66666,0xEE666666,0xE6666666
-	.word 0x7111111E,0x11111111,0x11111111,0x11117711,0x11117711,0x11111EEE,0x11111EEE,0x111111EE
-	.word 0x77777777,0x77777771,0x77777771,0x77777771,0x77777771,0x77777711,0x77777711,0x77777111
-
-	.word 0x66666677,0x66666677,0x66666777,0x66666777,0x66667777,0x66677777,0x66777777,0x66777777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x89999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99888999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999
-	.word 0x99999999,0x99999999,0x99999999,0x69999999,0x66699999,0x66669999,0x66666669,0x66666666
-	.word 0x66699999,0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x11111166,0x11111116,0x11EEE666,0xEEE66666,0xE6666666,0x66666666
-	.word 0x111111EE,0x11711111,0x17711111,0x177E1111,0x17EEEE11,0x11EEEEEE,0x11EEEEEE,0x111EEE66
-	.word 0x77777711,0x77777711,0x77777711,0x77777771,0x77777771,0x77777711,0x77777711,0x77777711
-	.word 0x66777777,0x67777777,0x66777777,0x66777777,0x66777777,0x66777777,0x66677777,0x66677777
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66699999,0x66666699
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x66669999,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x66669999,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66669999,0x66666669,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x111EE666,0x111EE666,0x11111666,0x11116666,0x11166666,0x16666666,0x66666666,0x66666666
-	.word 0x77777711,0x777777EE,0x777777EE,0x17777E11,0x67776111,0x66666111,0x66661111,0x66611116
-	.word 0x66667777,0x66666777,0x66661117,0x66611111,0x66111116,0x61111666,0x11116666,0x11166666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666661
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66699999
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x69999999,0x66666666
-	.word 0x99999999,0x99999999,0x99999999,0x99999999,0x99999999,0x66999999,0x66666666,0x66666666
-
-	.word 0x99999999,0x99999999,0x99999999,0x66999999,0x66666699,0x66666666,0x66666666,0x66666666
-	.word 0x99999999,0x66669999,0x66666699,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66111666,0x11116666,0x11666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x11666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
-	.word 0x66666611,0x66666111,0x66661116,0x66611166,0x66611666,0x66666666,0x66666666,0x66666666
-	.word 0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666,0x66666666
+	.word 0x0034A010,0x00F0006F,0xF09900A0,0xF000F000,0xAB00F000,0x10490060,0x08304404,0xF0071044
+	.word 0x0000BF00,0xF0034094,0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF1FF0050,0xF000F071,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FF,0xF000F000,0x3000F000,0xF091F100,0x0020BD00,0xF00DF092,0xC000F000
+	.word 0x03402900,0x4000F0FF,0xF058F054,0xF000F000,0xF000F000,0x00E0FF00,0xA50370F3,0xB2131400
+	.word 0x95530320,0x00EFBE23,0xF0102004,0x00004432,0x006016F0,0x50FF3D20,0xF000F046,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FD00F0,0xF000F000
+
+	.word 0xF000F000,0x89003000,0x887F0DA0,0x00F020F0,0x00F000F0,0x00F000F0,0xF3FF0010,0xF000F0FD
+	.word 0xF000F000,0xF000F000,0xBF00C000,0x7344F113,0x200D20FB,0xD0F4F306,0xFF21F000,0x00F000F0
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0xF000F000,0x00F0FF00
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x880300D0,0x88888988,0xF0020098,0x2103CE1A,0x999916F3
+	.word 0x00F029F0,0x509945B0,0x66060069,0x666619F0,0x662C6668,0x88020088,0x56800200,0x897F9888
+	.word 0x11100E00,0x8BF07F90,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xBC005000
+	.word 0x4B945F57,0x505FF71B,0x99452B25,0xC0CC4199,0xC999CC1A,0x0200CCCC,0xA00060C7,0x9CCCCC1C
+	.word 0x1FE01A80,0x10FF5050,0xF0035015,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0
+
+	.word 0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000,0x0200F000,0xFD72FFE8,0x18F0E6F2
+	.word 0x00F000F0,0x00F000F0,0x30C79B13,0x66052056,0x0C049986,0x02101204,0xF4E7E3FF,0xF000F023
+	.word 0xF000F000,0xF000F000,0x00F0FC00,0x00F000F0,0x006000F0,0x66668F04,0x00699923,0x66666603
+	.word 0x9FF40600,0xF000F0F6,0x0300B000,0x03C0C945,0xE6936623,0x00F01C20,0x339C0050,0x16F00000
+	.word 0x003340CC,0x33339319,0xC3339993,0x03003F20,0x9C99993C,0x12000C00,0xF05430FF,0xF000F000
+	.word 0xF000F000,0xF000F000,0x00F0FE00,0x00F000F0,0x00F000F0,0x00B000F0,0x9AAA00A9,0xAAAAA299
+	.word 0xA2042229,0x277729AA,0xAA770300,0x9A22D0B9,0x00F003C0,0x8889FF12,0x52FFF342,0x061310DC
+	.word 0x9203337C,0xF61500F2,0xE000F0FB,0x00F000F0,0xAA220000,0x10222999,0x10229922,0x99777703
+
+	.word 0x0300DD72,0x10A2BBC0,0x10260A25,0x2E1A2703,0xF07CF0FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x0000FF00,0x00F083F2,0x00F000F0,0x2B080080,0x697F9B13,0x9B139F63,0x00F000F0,0x00F04AF0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0F8,0xC000F000,0x895D1600,0x772CD729,0x22E702A2,0xCD12F702,0x880899BB
+	.word 0x0089BB58,0x55888803,0x630320C4,0x888888A3,0xBB881000,0xBB040080,0xBB988BBB,0x9B7FBBBB
+	.word 0x132A0310,0x0BF79343,0x00F000F0,0xF0E300F0,0x6000F000,0x7DD77200,0xAF130320,0x99BB1380
+	.word 0x99997999,0x990F7555,0x10555559,0x10A31303,0xA4181003,0x0097E010,0x10555703,0x7E999503
+	.word 0xF0220055,0xF000F000,0x8000F000,0x00FF3900,0xC01A1602,0xF01D1600,0xF000F000,0xFF00C000
+
+	.word 0x27478B43,0x2F470B50,0x00F000F0,0x00F000F0,0xF0BFF3FF,0xF000F000,0xF000F000,0xF000F000
+	.word 0x00F0FF00,0x00F000F0,0x00F000F0,0x008000F0,0xF0FF8B19,0x03001000,0xF000100B,0x70BD1618
+	.word 0xDF4FE000,0x1F801B80,0x5034A089,0x105B4600,0xA403D024,0x03556B70,0x00B555AF,0xA3895503
+	.word 0xC099F002,0x5BBBBB03,0xE9020300,0x0200F0FF,0xF0DEA6FF,0xF000F000,0xF000F000,0x00F0FE00
+	.word 0xA7130070,0x03308C30,0x06400FC0,0xBEF0E795,0x00F01C40,0x80039599,0x83F30300,0x030040FF
+	.word 0xF0A30388,0x10141000,0xF0A8F334,0x0000FF00,0x00307733,0x1B079303,0x00F017F7,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF0000000,0xFF00F0B6,0x00F000F0,0x00F000F0,0xEB2200C0,0x531316F0
+	.word 0x29FFE2FF,0x2900F0EF,0xF000F0F0,0x4300F000,0x14F09F3F,0x18109888,0x8CF3B659,0x88A300B0
+
+	.word 0xF000F0FF,0xF000F000,0x1300A000,0x5000F0A7,0x20774800,0x10977901,0x99977903,0x260360FF
+	.word 0xF00310C8,0xF000F000,0xF000F000,0x00F0FE00,0x6A0700F0,0x0800B343,0x0320AD10,0x0350BF79
+	.word 0x20BB5397,0x501650E5,0xD0A91726,0x3917FE00,0x00F029F7,0x002000F0,0x8FF30BE7,0x00765E66
+	.word 0x06007703,0x00B00340,0x7F771010,0x00030067,0xF0031008,0xF000F000,0xFF00F000,0x00F000F0
+	.word 0xBF3300F0,0xC6F27F12,0x15F0B272,0xF01F90FF,0xF00BB313,0xF3171000,0xA11A601F,0x1790FF70
+	.word 0x1F103FF3,0x00F013F0,0x00F000F0,0xF0FF00F0,0xF700A000,0xF01CF0BB,0xF000F000,0xFF00F000
+	.word 0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0x54004000,0x204CF448,0xF0A3F300
+	.word 0x00B0FF00,0x0F2007A7,0x00F0AB4A,0x00F000F0,0x7640A753,0x99764500,0x7776EEE6,0x7EEEE601
+
+	.word 0xEEEEEE77,0x03B00310,0x03F067A3,0x6117BB13,0x113F1666,0xF0C90371,0xF000F000,0xF000F000
+	.word 0x00F0FD00,0x3CE300F0,0x7EF63FF3,0x66991FA0,0x00F0FFAB,0x00F000F0,0x00F000F0,0x7A1000F0
+	.word 0x890FBDF3,0xB0689966,0x00F8A1D7,0x5F191016,0x892AE486,0x1A00C727,0xDFA02B3E,0xF0FF37F4
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF000F0FF,0x0A000000,0x3A7F2393,0xF383439B,0x00F0FE86,0x00F000F0,0x00F000F0,0xA3030010
+	.word 0x30E6556E,0x0C10EE03,0x11080066,0xE1080310,0x00E6EEEE,0x71116604,0x17667700,0x11EE7777
+	.word 0x1E771777,0x71034077,0x0F100300,0x13EB1B00,0x138F77C0,0x031077DB,0x20030067,0x71F0FF00
+	.word 0x1CF00070,0x00F000F0,0x56F100B0,0xF0F300F0,0xF000F000,0x99130300,0x00FAF266,0xA3DAEF00
+
+	.word 0x33001650,0xB0362098,0xF0862346,0x3440FF48,0x00F03CF4,0x00F000F0,0x00F000F0,0xF0FF00F0
+	.word 0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x57030010,0x00D0DB16
+	.word 0x7063B3FF,0x205BF22B,0xF012F01F,0xF000F000,0x00F0F800,0x00F000F0,0x00D000F0,0x00E1111E
+	.word 0x1111EE66,0x111EE666,0x00CD03D7,0x0310E603,0x101900EE,0x15150003,0x50117111,0x03307700
+	.word 0xFF1400EE,0x0E100320,0xCE030000,0x141003A0,0x0C100320,0x6B4400FF,0xF0E7F373,0xF000F08F
+	.word 0xF1008000,0xFAF9FF9F,0x2D9000F0,0x00F059F3,0x00F000F0,0xF0FF00F0,0xF000F000,0xF000F000
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xE000F0FF,0xC0831300
+	.word 0x7AEB360F,0xF20F007F,0x00F0FF16,0x00F000F0,0x00F000F0,0x00F000F0,0xF0FE00F0,0xF000F000
+
+	.word 0xF000F000,0x03005000,0x00EE168B,0x53BA0303,0x1610E6BF,0xC233A313,0x11170071,0x11177E11
+	.word 0x177FEEEE,0x0600A607,0xC4132700,0xBFE3AF83,0x47FF8247,0x30B3638F,0xF08B3B03,0xF000F000
+	.word 0xFF007000,0x00F0F2F1,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000,0xF000F000
+	.word 0xF000F000,0x00F0FF00,0x00F000F0,0x00F000F0,0x17F03733,0xF0FF9FF1,0xFA1F9017,0xF000F073
+	.word 0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x00F000F0,0xF000F0FF,0xF000F000
+	.word 0x6000F000,0x10971700,0xDC03DB03,0x0066E413,0x16150008,0xA3131E50,0x0340EE40,0x17777E11
+	.word 0x770B6111,0x50611167,0x6F376129,0x177FA603,0x331F3D20,0x4B701840,0x004000F0,0xF0FF2400
+	.word 0xF200C000,0xF000F03F,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0,0x6B160030
+
+	.word 0x6000F0FF,0x50FFF01C,0x401FF100,0x5046D317,0x5EF3FF2E,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0xF0FF00F0,0xF000F000,0xF000F000,0xF000F000,0xFF00F000,0x00F000F0,0x00F000F0,0x00F000F0
+	.word 0x00F000F0,0xF000F0FD,0xF000F000,0x13823300,0x8BF3668B,0xF00030FF,0x131CC017,0x104630CD
+	.word 0xF0B5F308,0x00708000
 
 	.section .rodata
 	.align	2
@@ -196,12 +196,32 @@ void Text::assign(const char* str, const OptColors& colors)
 }
 
 
+void Text::assign(LocalizedStrView str, const OptColors& colors)
+{
+    this->erase();
+
+    this->append(str, colors);
+}
+
+
 void Text::append(const char* str, const OptColors& colors)
 {
     if (str == nullptr or not validate_str(str)) {
         return;
     }
 
+    this->append(str, str_len(str), colors);
+}
+
+
+void Text::append(LocalizedStrView str, const OptColors& colors)
+{
+    this->append(str.data_, str.length_, colors);
+}
+
+
+void Text::append(const char* str, u32 length, const OptColors& colors)
+{
     if (config_.double_size_) {
         auto write_pos = static_cast<u8>(coord_.x + len_ * 2);
 
@@ -212,7 +232,7 @@ void Text::append(const char* str, const OptColors& colors)
                 ++len_;
             },
             str,
-            str_len(str));
+            length);
 
     } else {
         auto write_pos = static_cast<u8>(coord_.x + len_);
@@ -224,7 +244,7 @@ void Text::append(const char* str, const OptColors& colors)
                 ++len_;
             },
             str,
-            str_len(str));
+            length);
     }
 }
 
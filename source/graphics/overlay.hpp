@@ -1,6 +1,7 @@
 #pragma once
 
 
+#include "localization.hpp"
 #include "platform/platform.hpp"
 
 
@@ -50,9 +51,11 @@ public:
 
     void assign(const char* str, const OptColors& colors = {});
     void assign(int num, const OptColors& colors = {});
+    void assign(LocalizedStrView str, const OptColors& colors = {});
 
     void append(const char* str, const OptColors& colors = {});
     void append(int num, const OptColors& colors = {});
+    void append(LocalizedStrView str, const OptColors& colors = {});
 
     void erase();
 
@@ -76,6 +79,8 @@ public:
 private:
     void resize(u32 len);
 
+    void append(const char* str, u32 length, const OptColors& colors);
+
     Platform& pfrm_;
     const OverlayCoord coord_;
     Length len_;
@@ -1,6 +1,7 @@
 #include "localization.hpp"
 #include "platform/platform.hpp"
 #include "script/lisp.hpp"
+#include <limits>
 
 
 class str_const {
@@ -1241,10 +1242,19 @@ bool locale_requires_doublesize_font()
 }
 
 
-LocalizedText locale_string(Platform& pfrm, LocaleString ls)
-{
-    auto result = allocate_dynamic<LocalizedStrBuffer>(pfrm);
+// The start of each line in the strings file for a language, indexed by
+// LocaleString, plus the position just past the final line. We index the
+// strings file when we first look up a string in a language, rather than
+// scanning through the file on every lookup.
+static struct {
+    int language_ = -1;
+    const char* data_ = nullptr;
+    u16 offsets_[int(LocaleString::count) + 1];
+} string_table;
+
 
+static void index_strings(Platform& pfrm)
+{
     auto languages = lisp::get_var("languages");
 
     auto lang = lisp::get_list(languages, ::language_id);
@@ -1253,31 +1263,64 @@ LocalizedText locale_string(Platform& pfrm, LocaleString ls)
         lang->expect<lisp::Cons>().car()->expect<lisp::Symbol>().name_;
     fname += ".txt";
 
-    if (auto data = pfrm.load_file_contents("strings", fname.c_str())) {
-        const int target_line = static_cast<int>(ls);
+    auto data = pfrm.load_file_contents("strings", fname.c_str());
+    if (not data) {
+        pfrm.fatal("missing strings file for language");
+    }
+
+    u32 pos = 0;
+    for (int i = 0; i < int(LocaleString::count); ++i) {
+        string_table.offsets_[i] = pos;
 
-        int index = 0;
-        while (index not_eq target_line) {
-            while (*data not_eq '\n') {
-                if (*data == '\0') {
+        while (data[pos] not_eq '\n') {
+            if (data[pos] == '\0') {
+                if (i + 1 < int(LocaleString::count)) {
                     pfrm.fatal("null byte in localized text");
                 }
-                ++data;
+                // The final line lacks a trailing newline, pretend that it
+                // has one.
+                break;
             }
-            ++data;
-
-            ++index;
+            ++pos;
         }
+        ++pos;
 
-        while (*data not_eq '\0' and *data not_eq '\n') {
-            result->push_back(*data);
-            ++data;
+        if (pos > std::numeric_limits<u16>::max()) {
+            pfrm.fatal("strings file too large");
         }
+    }
+    string_table.offsets_[int(LocaleString::count)] = pos;
 
-        return result;
-    } else {
-        pfrm.fatal("missing strings file for language");
+    string_table.data_ = data;
+    string_table.language_ = ::language_id;
+}
+
+
+LocalizedStrView locale_string_view(Platform& pfrm, LocaleString ls)
+{
+    if (string_table.language_ not_eq ::language_id) {
+        index_strings(pfrm);
+    }
+
+    if (int(ls) < 0 or int(ls) >= int(LocaleString::count)) {
+        pfrm.fatal("locale string id out of range");
     }
+
+    const auto begin = string_table.offsets_[int(ls)];
+    const auto end = string_table.offsets_[int(ls) + 1];
+
+    // Exclude the newline.
+    return {string_table.data_ + begin, u32(end - begin - 1)};
+}
+
+
+LocalizedText locale_string(Platform& pfrm, LocaleString ls)
+{
+    auto result = allocate_dynamic<LocalizedStrBuffer>(pfrm);
+
+    *result += locale_string_view(pfrm, ls);
+
+    return result;
 }
 
 
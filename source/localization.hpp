@@ -18,6 +18,31 @@ using LocalizedText = DynamicMemory<LocalizedStrBuffer>;
 LocalizedText locale_string(Platform& pfrm, LocaleString ls);
 
 
+// A localized string, pointing directly into the strings file for the current
+// language. Lines in the strings file end with a newline rather than a null
+// terminator, so the view carries a length. The view remains valid until the
+// language changes. For displaying text, prefer views over locale_string(),
+// which copies the string into a scratch buffer.
+struct LocalizedStrView {
+    const char* data_;
+    u32 length_;
+};
+
+
+LocalizedStrView locale_string_view(Platform& pfrm, LocaleString ls);
+
+
+template <u32 Capacity>
+StringBuffer<Capacity>& operator+=(StringBuffer<Capacity>& str,
+                                   LocalizedStrView view)
+{
+    for (u32 i = 0; i < view.length_; ++i) {
+        str.push_back(view.data_[i]);
+    }
+    return str;
+}
+
+
 StringBuffer<31> locale_language_name(int language);
 
 LocalizedText locale_localized_language_name(Platform& pfrm, int language);
@@ -1,5 +1,12 @@
+#include "log_ring.hpp"
+#include "texture_loader.hpp"
+#include "job_system.hpp"
+#include "mixer.hpp"
+#include "resource_archive.hpp"
 #include "number/random.hpp"
 #include "platform/platform.hpp"
+#include "replay.hpp"
+#include "saveJournal.hpp"
 #include "script/lisp.hpp"
 #include <limits>
 
@@ -24,12 +31,15 @@
 #include "SFML/Graphics.hpp"
 #include "SFML/Network.hpp"
 #include "SFML/System.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
-#include <list>
 // The game logic and graphics used to run on different threads. But the game is
 // efficient enough to run on a gameboy, so there isn't really any need for
 // threading.
@@ -50,6 +60,26 @@ Platform::DeviceName Platform::device_name() const
 std::string resource_path();
 
 
+// Off (i.e. one thread) unless asked for with --jobs. The game hands the job
+// system one entity group per job, and a frame's worth of groups currently
+// takes less time to update than it takes to wake the worker threads.
+static u32 job_count(Platform& pfrm)
+{
+    if (auto jobs = pfrm.get_opt('j')) {
+        return std::max(1, atoi(jobs));
+    }
+
+    return 1;
+}
+
+
+static const ResourceArchive& resources()
+{
+    static const ResourceArchive archive(resource_path());
+    return archive;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 // TileMap
 ////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +167,43 @@ static constexpr Vec2<u32> resolution{240, 160};
 static const TileDesc glyph_region_start = 504;
 
 
+// Feeds the software mixer's output to SFML. SFML calls onGetData() from its own
+// streaming thread, which makes this the mixer thread.
+class MixerStream : public sf::SoundStream {
+public:
+    MixerStream(Mixer& mixer) : mixer_(mixer)
+    {
+        initialize(Mixer::channel_count, Mixer::sample_rate);
+    }
+
+    ~MixerStream()
+    {
+        stop();
+    }
+
+private:
+    bool onGetData(Chunk& data) override
+    {
+        mixer_.mix(buffer_.data(), frames_per_chunk);
+
+        data.samples = buffer_.data();
+        data.sampleCount = buffer_.size();
+
+        return true;
+    }
+
+    void onSeek(sf::Time) override
+    {
+    }
+
+    // 512 frames at 16kHz, i.e. 32ms of latency per chunk.
+    static constexpr u32 frames_per_chunk = 512;
+
+    Mixer& mixer_;
+    std::array<s16, frames_per_chunk * Mixer::channel_count> buffer_;
+};
+
+
 class Platform::Data {
 public:
     sf::Texture spritesheet_texture_;
@@ -146,6 +213,10 @@ public:
     sf::Texture background_texture_;
     sf::Shader color_shader_;
 
+    TextureLoader texture_loader_;
+
+    JobSystem jobs_;
+
     using GlyphOffset = int;
 
     std::map<GlyphOffset, TileDesc> glyph_table_;
@@ -182,14 +253,14 @@ public:
 
     Vec2<u32> window_size_;
 
-    // std::mutex audio_lock_;
     sf::Music music_;
-    std::list<sf::Sound> sounds_;
-    std::map<std::string, sf::SoundBuffer> sound_data_;
+    Mixer mixer_;
+    MixerStream mixer_stream_;
 
 
     Data(Platform& pfrm)
-        : overlay_(&overlay_texture_, {8, 8}, 32, 32),
+        : texture_loader_(resources()), jobs_(job_count(pfrm)),
+          overlay_(&overlay_texture_, {8, 8}, 32, 32),
           map_0_(&tile0_texture_, {32, 24}, 16, 20),
           map_1_(&tile1_texture_, {32, 24}, 16, 20),
           background_(&background_texture_, {8, 8}, 32, 32),
@@ -217,7 +288,8 @@ public:
                           return sf::Style::Titlebar | sf::Style::Close |
                                  sf::Style::Resize;
                       }
-                  }())
+                  }()),
+          mixer_stream_(mixer_)
     {
         window_.setVerticalSyncEnabled(true);
         // window_.setMouseCursorVisible(false);
@@ -227,40 +299,36 @@ public:
 
         rt_.create(240, 160);
 
-        const auto vignette_path =
-            resource_path() + ("images" PATH_DELIMITER) + "vignette.png";
-        if (not vignette_texture_.loadFromFile(vignette_path)) {
+        const auto vignette = resources().find("images", "vignette.png");
+        if (not vignette or
+            not vignette_texture_.loadFromMemory(vignette->data_,
+                                                 vignette->size_)) {
             error(pfrm, "failed to load vignette texture");
         }
 
-        auto sound_folder = resource_path() + ("sounds" PATH_DELIMITER);
-        // lisp::loadv<lisp::Symbol>("sound-dir").name_;
-
-        for (auto& dirent : std::filesystem::directory_iterator(sound_folder)) {
-            const auto filename = dirent.path().stem().string();
-            static const std::string prefix("sound_");
-            const auto prefix_loc = filename.find(prefix);
+        resources().for_each(
+            "sounds",
+            [this](const std::string& filename, ResourceArchive::File file) {
+                static const std::string prefix("sound_");
 
-            if (prefix_loc not_eq std::string::npos) {
-                std::ifstream file_data(dirent.path(), std::ios::binary);
-                std::vector<s8> buffer(
-                    std::istreambuf_iterator<char>(file_data), {});
+                const auto stem = filename.substr(0, filename.rfind('.'));
+                if (stem.compare(0, prefix.size(), prefix) not_eq 0) {
+                    return;
+                }
 
                 // The gameboy advance sound data was 8 bit signed mono at
                 // 16kHz. Here, we're upsampling to 16bit signed.
                 std::vector<s16> upsampled;
+                upsampled.reserve(file.size_);
 
-                for (s8 sample : buffer) {
-                    upsampled.push_back(sample << 8);
+                for (u32 i = 0; i < file.size_; ++i) {
+                    upsampled.push_back(s8(file.data_[i]) << 8);
                 }
 
-                sf::SoundBuffer sound_buffer;
-                sound_buffer.loadFromSamples(
-                    upsampled.data(), upsampled.size(), 1, 16000);
+                mixer_.load(stem.substr(prefix.size()), std::move(upsampled));
+            });
 
-                sound_data_[filename.substr(prefix.size())] = sound_buffer;
-            }
-        }
+        mixer_stream_.play();
     }
 };
 
@@ -386,7 +454,28 @@ Microseconds Platform::DeltaClock::reset()
     // get things to run correctly.
     constexpr float scaling_factor = (60.f / 59.59f);
 
-    return val * scaling_factor;
+    return replay::delta(val * scaling_factor);
+}
+
+
+static const auto delta_clock_epoch = std::chrono::steady_clock::now();
+
+
+Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - delta_clock_epoch);
+
+    // NOTE: TimePoint is only an int, so the sample wraps after roughly half an
+    // hour. duration() computes the difference with unsigned arithmetic, so
+    // wrapping does not matter, as long as the measured interval is short.
+    return static_cast<TimePoint>(static_cast<u32>(elapsed.count()));
+}
+
+
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    return static_cast<u32>(t2) - static_cast<u32>(t1);
 }
 
 
@@ -592,6 +681,8 @@ void Platform::Keyboard::poll()
             break;
         }
     }
+
+    replay::filter_input(*::platform, states_);
 }
 
 
@@ -691,6 +782,12 @@ void Platform::push_task(Task* task)
 }
 
 
+void Platform::parallel_for(u32 count, ParallelFn fn, void* context)
+{
+    data_->jobs_.run(count, fn, context);
+}
+
+
 void Platform::Screen::clear()
 {
     for (auto it = task_queue.begin(); it not_eq task_queue.end();) {
@@ -711,30 +808,18 @@ void Platform::Screen::clear()
     ::platform->data()->fade_overlay_.setFillColor(
         ::platform->data()->fade_color_);
 
-    {
-        // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-        auto& sounds = ::platform->data()->sounds_;
-        for (auto it = sounds.begin(); it not_eq sounds.end();) {
-            if (it->getStatus() == sf::Sound::Status::Stopped) {
-                it = sounds.erase(it);
-            } else {
-                ++it;
-            }
-        }
-    }
-
     {
         // std::lock_guard<std::mutex> guard(texture_swap_mutex);
         while (not texture_swap_requests.empty()) {
             const auto request = texture_swap_requests.front();
             texture_swap_requests.pop();
 
-            sf::Image image;
+            // Usually, the loader has already decoded the image in the
+            // background, and we only need to upload it.
+            const auto source =
+                ::platform->data()->texture_loader_.get(request.second);
 
-            auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-            if (not image.loadFromFile(image_folder + request.second +
-                                       ".png")) {
+            if (not source) {
                 error(*::platform,
                       (std::string("failed to load texture ") + request.second)
                           .c_str());
@@ -743,9 +828,9 @@ void Platform::Screen::clear()
                 info(*::platform,
                      (std::string("loaded image ") + request.second).c_str());
             }
+
+            sf::Image image = *source;
             image.createMaskFromColor({255, 0, 255, 255});
-            image.saveToFile("/home/evan/blind-jump-portable/build/test." +
-                             request.second + ".png");
 
             // For space savings on the gameboy advance, I used tile0 for the
             // background as well. But it was meta-tiled as 4x3, so we need to
@@ -832,19 +917,18 @@ void Platform::Screen::clear()
             const auto rq = glyph_requests.front();
             glyph_requests.pop();
 
-            auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-            sf::Image character_source_image_;
-            const auto charset_path =
-                std::string(image_folder) + rq.second.texture_name_ + ".png";
-            if (not character_source_image_.loadFromFile(charset_path)) {
-                error(
-                    *::platform,
-                    (std::string("failed to open charset image " + charset_path)
-                         .c_str()));
+            const auto charset =
+                ::platform->data()->texture_loader_.get(rq.second.texture_name_);
+            if (not charset) {
+                error(*::platform,
+                      (std::string("failed to open charset image ") +
+                       rq.second.texture_name_)
+                          .c_str());
                 exit(EXIT_FAILURE);
             }
 
+            const sf::Image& character_source_image_ = *charset;
+
             // This code is so wasteful... so many intermediary images... FIXME.
 
             auto& texture = ::platform->data()->overlay_texture_;
@@ -1278,9 +1362,12 @@ void Platform::Screen::draw(const Sprite& spr)
 ////////////////////////////////////////////////////////////////////////////////
 
 
+static Vec2<Float> spatialized_audio_listener_pos;
+
+
 void Platform::Speaker::set_position(const Vec2<Float>& position)
 {
-    // sf::Listener::setPosition({position.x, 0, position.y});
+    spatialized_audio_listener_pos = position;
 }
 
 
@@ -1295,13 +1382,14 @@ static std::string current_music;
 
 void Platform::Speaker::play_music(const char* name, Microseconds offset)
 {
-    std::string path = resource_path() + ("sounds" PATH_DELIMITER);
+    const auto filename = std::string("music_") + name + ".ogg";
 
-    path += "music_";
-    path += name;
-    path += ".ogg";
+    // NOTE: sf::Music streams from the archive's memory, which stays mapped
+    // for as long as the game runs.
+    const auto file = resources().find("sounds", filename.c_str());
 
-    if (::platform->data()->music_.openFromFile(path.c_str())) {
+    if (file and
+        ::platform->data()->music_.openFromMemory(file->data_, file->size_)) {
         ::platform->data()->music_.play();
         ::platform->data()->music_.setLoop(true);
         ::platform->data()->music_.setPlayingOffset(sf::microseconds(offset));
@@ -1331,46 +1419,51 @@ void Platform::Speaker::play_sound(const char* name,
                                    int priority,
                                    std::optional<Vec2<Float>> position)
 {
-    (void)priority; // We are not using the priority variable, because we're a
-                    // powerful desktop pc, we can play lots of sounds at once,
-                    // and do not need to evict sounds! Or do we...? I think
-                    // SFML does have a hard upper limit of 256 concurrent audio
-                    // streams, but we'll probably never hit that limit, given
-                    // that the game was originally calibrated for the gameboy
-                    // advance, where I was supporting four concurrent audio
-                    // streams.
-
-    // std::lock_guard<std::mutex> guard(::platform->data()->audio_lock_);
-    auto& data = ::platform->data()->sound_data_;
-    auto found = data.find(name);
-    if (found not_eq data.end()) {
-        ::platform->data()->sounds_.emplace_back(found->second);
-
-        auto& sound = ::platform->data()->sounds_.back();
-
-        sound.play();
-
-        // sound.setRelativeToListener(static_cast<bool>(position));
-
-        // if (position) {
-        //     sound.setAttenuation(0.2f);
-        // } else {
-        //     sound.setAttenuation(0.f);
-        // }
-
-        // sound.setMinDistance(160.f);
-        // if (position) {
-        //     sound.setPosition({position->x, 0, position->y});
-        // }
-    } else {
+    auto& mixer = ::platform->data()->mixer_;
+
+    const auto sound = mixer.find(name);
+    if (not sound) {
         error(*::platform, (std::string("no sound data for ") + name).c_str());
+        return;
+    }
+
+    Float l_vol = 1.f;
+    Float r_vol = 1.f;
+
+    if (position) {
+        // Same falloff as the gameboy advance, but with stereo panning, because
+        // desktop pcs generally have two speakers.
+        const auto dist = distance(*position, spatialized_audio_listener_pos);
+
+        if (dist >= 48) {
+            const Float distance_scale = 0.0005f;
+
+            const auto inv_sqr_intensity =
+                1.f / (distance_scale * ((dist / 4) * dist));
+
+            l_vol = inv_sqr_intensity;
+            r_vol = inv_sqr_intensity;
+        }
+
+        const auto pan = clamp(
+            (position->x - spatialized_audio_listener_pos.x) / 120.f, -1.f, 1.f);
+
+        l_vol *= std::min(1.f, 1.f - pan);
+        r_vol *= std::min(1.f, 1.f + pan);
     }
+
+    mixer.play(*sound, priority, Mixer::gain(l_vol), Mixer::gain(r_vol));
 }
 
 
-bool is_sound_playing(const char* name)
+bool Platform::Speaker::is_sound_playing(const char* name)
 {
-    return false; // TODO...
+    auto& mixer = ::platform->data()->mixer_;
+
+    if (auto sound = mixer.find(name)) {
+        return mixer.is_playing(*sound);
+    }
+    return false;
 }
 
 
@@ -1404,7 +1497,7 @@ bool Platform::RemoteConsole::printline(const char* text, bool show_prompt)
 
 
 static const char* const logfile_name = "logfile.txt";
-static std::ofstream logfile_out(logfile_name);
+static LogRing log_ring(logfile_name, &std::cout);
 
 
 static Severity log_threshold;
@@ -1422,47 +1515,13 @@ void Platform::Logger::log(Severity level, const char* msg)
         return;
     }
 
-    auto write_msg = [&](std::ostream& target) {
-        target << '[' <<
-            [&] {
-                switch (level) {
-                default:
-                case Severity::info:
-                    return "info";
-                case Severity::warning:
-                    return "warning";
-                case Severity::error:
-                    return "error";
-                }
-            }() << "] "
-               << msg << '\n';
-
-        if (level == Severity::error or level == Severity::warning) {
-            target << std::flush;
-        }
-    };
-
-    write_msg(logfile_out);
-    write_msg(std::cout);
+    log_ring.push(level, msg);
 }
 
 
 void Platform::Logger::read(void* buffer, u32 start_offset, u32 num_bytes)
 {
-    const std::string data = [&] {
-        std::ifstream logfile_in(logfile_name);
-        std::stringstream strbuf;
-        strbuf << logfile_in.rdbuf();
-        return strbuf.str();
-    }();
-
-    if (int(data.size() - start_offset) < int(num_bytes)) {
-        return;
-    }
-
-    for (u32 i = start_offset; i < start_offset + num_bytes; ++i) {
-        ((char*)buffer)[i - start_offset] = data[i];
-    }
+    log_ring.read(start_offset, buffer, num_bytes);
 }
 
 
@@ -1566,13 +1625,11 @@ Platform::Platform()
     screen_.view_.set_size(screen_.size().cast<Float>());
 
 
-    auto shader_folder = resource_path() + ("shaders" PATH_DELIMITER);
-    // lisp::loadv<lisp::Symbol>("shader-dir").name_;
-
+    const auto shader = resources().find("shaders", "colorShader.frag");
 
-    if (not data_->color_shader_.loadFromFile(
-            shader_folder + std::string("colorShader.frag"),
-            sf::Shader::Fragment)) {
+    if (not shader or not data_->color_shader_.loadFromMemory(
+                          std::string(shader->data_, shader->size_),
+                          sf::Shader::Fragment)) {
         error(*this, "Failed to load shader");
     }
     data_->color_shader_.setUniform("texture", sf::Shader::CurrentTexture);
@@ -1607,28 +1664,111 @@ void Platform::soft_exit()
 static const char* const save_file_name = "save.dat";
 
 
-bool Platform::write_save_data(const void* data, u32 length, u32 offset)
+// The savefile uses the same journaled layout as cartridge flash, so we keep
+// a copy of the whole file in memory, and write through whichever bytes
+// change.
+class SaveFileDevice : public SaveJournal::Device {
+public:
+    SaveFileDevice(const char* path) : path_(path)
+    {
+        contents_.fill(0xff);
+
+        std::ifstream in(path_, std::ios_base::in | std::ios_base::binary);
+        if (in) {
+            in.read((char*)contents_.data(), contents_.size());
+            // The savefile might predate the journal.
+            full_size_ = u32(in.gcount()) == contents_.size();
+        }
+    }
+
+    void read(u32 offset, void* dest, u32 length) override
+    {
+        memcpy(dest, contents_.data() + offset, length);
+    }
+
+    bool write(u32 offset, const void* data, u32 length) override
+    {
+        memcpy(contents_.data() + offset, data, length);
+        return store(offset, length);
+    }
+
+    bool erase_sector(u32 sector) override
+    {
+        const u32 offset = sector * SaveJournal::sector_size;
+        memset(contents_.data() + offset, 0xff, SaveJournal::sector_size);
+        return store(offset, SaveJournal::sector_size);
+    }
+
+private:
+    bool store(u32 offset, u32 length)
+    {
+        if (not full_size_) {
+            std::ofstream out(path_,
+                              std::ios_base::out | std::ios_base::binary |
+                                  std::ios_base::trunc);
+            out.write((const char*)contents_.data(), contents_.size());
+            if (not out) {
+                return false;
+            }
+            full_size_ = true;
+            return true;
+        }
+
+        if (not file_.is_open()) {
+            file_.open(path_,
+                       std::ios_base::in | std::ios_base::out |
+                           std::ios_base::binary);
+        }
+
+        file_.seekp(offset);
+        file_.write((const char*)contents_.data() + offset, length);
+        file_.flush();
+
+        return bool(file_);
+    }
+
+    const char* path_;
+    std::array<u8, SaveJournal::sector_size * SaveJournal::sector_count>
+        contents_;
+    bool full_size_ = false;
+    std::fstream file_;
+};
+
+
+static SaveJournal& save_journal()
 {
-    std::ofstream out(save_file_name,
-                      std::ios_base::out | std::ios_base::binary);
+    static SaveFileDevice device(save_file_name);
+    static SaveJournal journal(device);
+    return journal;
+}
 
-    out.write(reinterpret_cast<const char*>(data), length);
 
-    return true;
+bool Platform::write_save_data(const void* data, u32 length, u32 offset)
+{
+    if (replay::playing()) {
+        // Don't clobber the real save file with the game state from a replay.
+        auto& save = replay::save_data();
+        save.resize(std::max(save.size(), size_t(offset + length)));
+        memcpy(save.data() + offset, data, length);
+        return true;
+    }
+
+    return save_journal().write(data, length, offset);
 }
 
 
 bool Platform::read_save_data(void* buffer, u32 data_length, u32 offset)
 {
-    std::ifstream in(save_file_name, std::ios_base::in | std::ios_base::binary);
-
-    if (!in) {
-        return false;
+    if (replay::playing()) {
+        auto& save = replay::save_data();
+        if (save.size() < offset + data_length) {
+            return false;
+        }
+        memcpy(buffer, save.data() + offset, data_length);
+        return true;
     }
 
-    in.read(reinterpret_cast<char*>(buffer), data_length);
-
-    return true;
+    return save_journal().read(buffer, data_length, offset);
 }
 
 
@@ -1651,6 +1791,12 @@ void Platform::sleep(u32 frames)
 }
 
 
+void Platform::prefetch_texture(const char* name)
+{
+    data_->texture_loader_.prefetch(name);
+}
+
+
 void Platform::load_sprite_texture(const char* name)
 {
     // std::lock_guard<std::mutex> guard(texture_swap_mutex);
@@ -1674,19 +1820,13 @@ void Platform::load_tile1_texture(const char* name)
 
 bool Platform::overlay_texture_exists(const char* name)
 {
-    auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-    std::ifstream f(image_folder + name + ".txt");
-    return f.good();
+    return resources().exists("images", (std::string(name) + ".txt").c_str());
 }
 
 
 bool Platform::load_overlay_texture(const char* name)
 {
-    auto image_folder = resource_path() + ("images" PATH_DELIMITER);
-
-    std::ifstream f(image_folder + name + ".txt");
-    if (not f.good()) {
+    if (not overlay_texture_exists(name)) {
         return false;
     }
 
@@ -1804,24 +1944,13 @@ void Platform::feed_watchdog()
 }
 
 
-static std::map<std::string, std::string> files;
-
-
 const char* Platform::load_file_contents(const char* folder,
                                          const char* filename) const
 {
-    const auto name = std::string(folder) + PATH_DELIMITER + filename;
-    const auto found = files.find(name);
-    if (found == files.end()) {
-        std::fstream file(resource_path() + name);
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        files[name] = buffer.str();
-    } else {
-        return found->second.c_str();
+    if (auto file = resources().find(folder, filename)) {
+        return file->data_;
     }
-
-    return files[name].c_str();
+    return nullptr;
 }
 
 
@@ -1840,7 +1969,19 @@ int main(int argc, char** argv)
     ::argv = argv;
 
     Platform pf;
+
+    if (auto path = pf.get_opt('p')) {
+        replay::start_playback(pf, path);
+    } else if (auto path = pf.get_opt('r')) {
+        auto& journal = save_journal();
+        std::vector<u8> save_data(journal.size());
+        journal.read(save_data.data(), save_data.size(), 0);
+        replay::start_recording(pf, path, save_data);
+    }
+
     start(pf);
+
+    replay::stop_recording();
 }
 
 
@@ -1852,6 +1993,12 @@ const char* Platform::get_opt(char opt)
             op.add<popl::Switch>("h", "help", "produce help message");
         auto eval_option =
             op.add<popl::Value<std::string>>("e", "eval", "evaluate lisp");
+        auto record_option = op.add<popl::Value<std::string>>(
+            "", "record", "record input to a replay file");
+        auto playback_option = op.add<popl::Value<std::string>>(
+            "", "playback", "play back a replay file");
+        auto jobs_option = op.add<popl::Value<std::string>>(
+            "j", "jobs", "number of threads for the simulation step");
 
         op.parse(::argc, ::argv);
 
@@ -1862,6 +2009,27 @@ const char* Platform::get_opt(char opt)
                 return eval_result.c_str();
             }
             break;
+
+        case 'r':
+            if (record_option->is_set()) {
+                static std::string record_path = record_option->value();
+                return record_path.c_str();
+            }
+            break;
+
+        case 'p':
+            if (playback_option->is_set()) {
+                static std::string playback_path = playback_option->value();
+                return playback_path.c_str();
+            }
+            break;
+
+        case 'j':
+            if (jobs_option->is_set()) {
+                static std::string jobs = jobs_option->value();
+                return jobs.c_str();
+            }
+            break;
         }
     } catch (...) {
         // ... TODO ...
@@ -1902,11 +2070,218 @@ SynchronizedBase::~SynchronizedBase()
 ////////////////////////////////////////////////////////////////////////////////
 
 
+// Single producer, single consumer byte queue, for passing network data between
+// the game thread and the network thread without locking.
+template <u32 capacity> class ByteRing {
+public:
+    static_assert((capacity & (capacity - 1)) == 0,
+                  "capacity must be a power of two");
+
+    static constexpr u32 size()
+    {
+        return capacity;
+    }
+
+    u32 readable() const
+    {
+        return head_.load(std::memory_order_acquire) -
+               tail_.load(std::memory_order_relaxed);
+    }
+
+    u32 writable() const
+    {
+        return capacity - (head_.load(std::memory_order_relaxed) -
+                           tail_.load(std::memory_order_acquire));
+    }
+
+    // Largest contiguous region available for reading.
+    const u8* read_region(u32& length) const
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        const auto offset = tail % capacity;
+        length = std::min(readable(), capacity - offset);
+        return &data_[offset];
+    }
+
+    // Largest contiguous region available for writing.
+    u8* write_region(u32& length)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        const auto offset = head % capacity;
+        length = std::min(writable(), capacity - offset);
+        return &data_[offset];
+    }
+
+    void consume(u32 length)
+    {
+        tail_.store(tail_.load(std::memory_order_relaxed) + length,
+                    std::memory_order_release);
+    }
+
+    void commit(u32 length)
+    {
+        head_.store(head_.load(std::memory_order_relaxed) + length,
+                    std::memory_order_release);
+    }
+
+    // Copy out the first length bytes, across the wraparound point if
+    // necessary, without consuming them.
+    void peek(u8* out, u32 length) const
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        for (u32 i = 0; i < length; ++i) {
+            out[i] = data_[(tail + i) % capacity];
+        }
+    }
+
+    bool write(const u8* data, u32 length)
+    {
+        if (writable() < length) {
+            return false;
+        }
+        const auto head = head_.load(std::memory_order_relaxed);
+        for (u32 i = 0; i < length; ++i) {
+            data_[(head + i) % capacity] = data[i];
+        }
+        commit(length);
+        return true;
+    }
+
+    void clear()
+    {
+        tail_.store(head_.load(std::memory_order_acquire),
+                    std::memory_order_release);
+    }
+
+private:
+    std::array<u8, capacity> data_;
+    std::atomic<u32> head_{0};
+    std::atomic<u32> tail_{0};
+};
+
+
+// All socket calls happen on a dedicated network thread, so that a slow or
+// unresponsive peer never stalls the game loop. The game thread only touches
+// the message queues and a few atomic flags.
 struct NetworkPeerImpl {
+    enum class State : u8 { idle, listening, connecting, connected, closed };
+
+    // Room for a bit over three hundred messages in each direction.
+    using Queue = ByteRing<4096>;
+
     sf::TcpSocket socket_;
     sf::TcpListener listener_;
+
+    std::thread thread_;
+    std::atomic<State> state_{State::idle};
+    std::atomic<bool> stop_{false};
+
+    Queue inbound_;
+    Queue outbound_;
+
+    // Game thread only.
     bool is_host_ = false;
-    int poll_consume_position_ = 0;
+
+    // Counts since the last call to NetworkPeer::stats().
+    int tx_count_ = 0;
+    int rx_count_ = 0;
+    int tx_loss_ = 0;
+    u32 peak_outbound_ = 0;
+
+    State reported_state_ = State::idle;
+    std::optional<Platform::NetworkPeer::ConnectionCallback> callback_;
+    std::array<u8, Platform::NetworkPeer::max_message_size> staging_;
+
+
+    // Runs establish() on a new network thread, followed by the send/receive
+    // loop, if establish() managed to connect.
+    void start(State initial_state, std::function<bool()> establish)
+    {
+        shutdown();
+
+        state_ = initial_state;
+        stop_ = false;
+        inbound_.clear();
+        outbound_.clear();
+
+        tx_count_ = 0;
+        rx_count_ = 0;
+        tx_loss_ = 0;
+        peak_outbound_ = 0;
+
+        thread_ = std::thread([this, establish] {
+            if (establish()) {
+                state_ = State::connected;
+                run();
+            }
+            socket_.disconnect();
+            listener_.close();
+            state_ = State::closed;
+        });
+    }
+
+
+    void shutdown()
+    {
+        stop_ = true;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+
+    void run()
+    {
+        sf::SocketSelector selector;
+        selector.add(socket_);
+
+        socket_.setBlocking(false);
+
+        while (not stop_) {
+            u32 length;
+
+            // Flush outbound data.
+            while (true) {
+                auto data = outbound_.read_region(length);
+                if (length == 0) {
+                    break;
+                }
+
+                std::size_t sent = 0;
+                const auto status = socket_.send(data, length, sent);
+                outbound_.consume(sent);
+
+                if (status == sf::Socket::Disconnected or
+                    status == sf::Socket::Error) {
+                    return;
+                }
+                if (sent < length) {
+                    break; // Socket buffer full, try again later.
+                }
+            }
+
+            if (not selector.wait(sf::milliseconds(1))) {
+                continue;
+            }
+
+            // Receive directly into the inbound queue. If the queue is full,
+            // leave the data in the socket, until the game catches up.
+            auto dest = inbound_.write_region(length);
+            if (length == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+
+            std::size_t received = 0;
+            const auto status = socket_.receive(dest, length, received);
+            inbound_.commit(received);
+
+            if (status == sf::Socket::Disconnected or
+                status == sf::Socket::Error) {
+                return;
+            }
+        }
+    }
 };
 
 
@@ -1914,8 +2289,6 @@ Platform::NetworkPeer::NetworkPeer() : impl_(nullptr)
 {
     auto impl = new NetworkPeerImpl;
 
-    impl->socket_.setBlocking(true);
-
     impl_ = impl;
 }
 
@@ -1923,11 +2296,7 @@ Platform::NetworkPeer::NetworkPeer() : impl_(nullptr)
 void Platform::NetworkPeer::disconnect()
 {
     auto impl = (NetworkPeerImpl*)impl_;
-    impl->socket_.disconnect();
-
-    if (is_connected()) {
-        error(*::platform, "disconnect failed?!");
-    }
+    impl->shutdown();
 }
 
 
@@ -1943,6 +2312,12 @@ bool Platform::NetworkPeer::supported_by_device()
 }
 
 
+void Platform::NetworkPeer::on_connection_change(ConnectionCallback callback)
+{
+    ((NetworkPeerImpl*)impl_)->callback_.emplace(callback);
+}
+
+
 void Platform::NetworkPeer::listen()
 {
     auto impl = (NetworkPeerImpl*)impl_;
@@ -1951,13 +2326,24 @@ void Platform::NetworkPeer::listen()
 
     info(*::platform, ("listening on port " + std::to_string(port)).c_str());
 
-    impl->listener_.listen(55001);
-    impl->listener_.accept(impl->socket_);
+    impl->is_host_ = true;
 
-    info(*::platform, "Peer connected!");
+    impl->start(NetworkPeerImpl::State::listening, [impl, port] {
+        if (impl->listener_.listen(port) not_eq sf::Socket::Done) {
+            return false;
+        }
 
-    impl->is_host_ = true;
-    impl->socket_.setBlocking(false);
+        sf::SocketSelector selector;
+        selector.add(impl->listener_);
+
+        while (not impl->stop_) {
+            if (selector.wait(sf::milliseconds(50))) {
+                return impl->listener_.accept(impl->socket_) == sf::Socket::Done;
+            }
+        }
+
+        return false;
+    });
 }
 
 
@@ -1969,28 +2355,52 @@ void Platform::NetworkPeer::connect(const char* peer)
 
     auto port = lisp::loadv<lisp::Integer>("network-port").value_;
 
-    auto addr = "127.0.0.1";
+    std::string addr = "127.0.0.1";
     // Conf{*::platform}.expect<Conf::String>(
     // ::platform->device_name().c_str(), "host_address");
 
     info(*::platform,
-         ("connecting to " + std::string(addr) + ":" + std::to_string(port))
-             .c_str());
+         ("connecting to " + addr + ":" + std::to_string(port)).c_str());
 
-    if (impl->socket_.connect(addr, port) == sf::Socket::Status::Done) {
-        info(*::platform, "Peer connected!");
-    } else {
-        error(*::platform, "connection failed :(");
-    }
+    impl->start(NetworkPeerImpl::State::connecting, [impl, addr, port] {
+        // Connect without blocking, so that disconnect() can cancel a pending
+        // attempt right away, rather than waiting out the timeout.
+        impl->socket_.setBlocking(false);
+
+        const auto status = impl->socket_.connect(addr, port);
+        if (status not_eq sf::Socket::Done and
+            status not_eq sf::Socket::NotReady) {
+            return false;
+        }
+
+        // NOTE: A pending connection is neither readable nor does it have a
+        // remote address. If the socket becomes readable without a remote
+        // address, the attempt failed.
+        sf::SocketSelector selector;
+        selector.add(impl->socket_);
+
+        sf::Clock timeout;
+        while (not impl->stop_ and timeout.getElapsedTime() < sf::seconds(10)) {
+            const bool readable = selector.wait(sf::milliseconds(50));
+
+            if (impl->socket_.getRemoteAddress() not_eq sf::IpAddress::None) {
+                return true;
+            }
 
-    impl->socket_.setBlocking(false);
+            if (readable) {
+                return false;
+            }
+        }
+
+        return false;
+    });
 }
 
 
 bool Platform::NetworkPeer::is_connected() const
 {
     auto impl = (NetworkPeerImpl*)impl_;
-    return impl->socket_.getRemoteAddress() not_eq sf::IpAddress::None;
+    return impl->state_ == NetworkPeerImpl::State::connected;
 }
 
 
@@ -1998,47 +2408,45 @@ bool Platform::NetworkPeer::send_message(const Message& message)
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
-    std::size_t sent = 0;
-    impl->socket_.send(message.data_, message.length_, sent);
-
-    if (sent not_eq message.length_) {
-        warning(*::platform, "part of message not sent!");
+    // NOTE: Messages go out whole, or not at all. The caller may retry.
+    if (not impl->outbound_.write((const u8*)message.data_, message.length_)) {
+        ++impl->tx_loss_;
         return false;
     }
 
+    ++impl->tx_count_;
     return true;
 }
 
 
-static std::vector<u8> receive_buffer;
-
-
 void Platform::NetworkPeer::update()
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
-    if (impl->poll_consume_position_) {
-        receive_buffer.erase(receive_buffer.begin(),
-                             receive_buffer.begin() +
-                                 impl->poll_consume_position_);
-    }
+    const auto state = impl->state_.load();
 
-    impl->poll_consume_position_ = 0;
+    impl->peak_outbound_ =
+        std::max(impl->peak_outbound_, impl->outbound_.readable());
 
-    std::array<char, 1024> buffer = {0};
-    std::size_t received = 0;
+    if (state not_eq impl->reported_state_) {
+        using State = NetworkPeerImpl::State;
 
-    while (true) {
-        impl->socket_.receive(buffer.data(), sizeof buffer, received);
+        const bool was_connected = impl->reported_state_ == State::connected;
+        impl->reported_state_ = state;
 
-        if (received > 0) {
-            std::copy(buffer.begin(),
-                      buffer.begin() + received,
-                      std::back_inserter(receive_buffer));
+        if (state == State::connected) {
+            info(*::platform, "Peer connected!");
+        } else if (state == State::closed) {
+            if (was_connected) {
+                info(*::platform, "peer disconnected");
+            } else {
+                error(*::platform, "connection failed :(");
+            }
         }
 
-        if (received < sizeof buffer) {
-            break;
+        if ((state == State::connected or state == State::closed) and
+            impl->callback_) {
+            (*impl->callback_)(*::platform, state == State::connected);
         }
     }
 }
@@ -2049,35 +2457,63 @@ Platform::NetworkPeer::poll_message()
 {
     auto impl = (NetworkPeerImpl*)impl_;
 
-    if (receive_buffer.empty()) {
+    u32 length;
+    auto data = impl->inbound_.read_region(length);
+
+    if (length == 0) {
         return {};
     }
 
-    if (impl->poll_consume_position_ >= (int)receive_buffer.size()) {
-        return {};
+    // If a message straddles the end of the ring, copy it into a small staging
+    // buffer, so that the caller still sees contiguous bytes.
+    if (length < max_message_size) {
+        const auto total = std::min(impl->inbound_.readable(), max_message_size);
+        if (total > length) {
+            impl->inbound_.peek(impl->staging_.data(), total);
+            return Message{(byte*)impl->staging_.data(), total};
+        }
     }
 
-    return Message{(byte*)&receive_buffer[impl->poll_consume_position_],
-                   (u32)receive_buffer.size() - impl->poll_consume_position_};
+    return Message{(byte*)data, length};
 }
 
 
 void Platform::NetworkPeer::poll_consume(u32 length)
 {
     auto impl = (NetworkPeerImpl*)impl_;
-    impl->poll_consume_position_ += length;
+    impl->inbound_.consume(length);
+    ++impl->rx_count_;
 }
 
 
 Platform::NetworkPeer::~NetworkPeer()
 {
-    delete (NetworkPeerImpl*)impl_;
+    auto impl = (NetworkPeerImpl*)impl_;
+    impl->shutdown();
+    delete impl;
 }
 
 
 Platform::NetworkPeer::Stats Platform::NetworkPeer::stats()
 {
-    return {0, 0, 0, 0, 0};
+    auto impl = (NetworkPeerImpl*)impl_;
+
+    // The socket does its own retransmission, so the only losses that we can
+    // observe are messages that didn't fit in the outbound queue. And the
+    // closest thing to link saturation is how full the outbound queue got.
+    const Stats result{impl->tx_count_,
+                       impl->rx_count_,
+                       impl->tx_loss_,
+                       0,
+                       int(100 * impl->peak_outbound_ /
+                           NetworkPeerImpl::Queue::size())};
+
+    impl->tx_count_ = 0;
+    impl->rx_count_ = 0;
+    impl->tx_loss_ = 0;
+    impl->peak_outbound_ = 0;
+
+    return result;
 }
 
 
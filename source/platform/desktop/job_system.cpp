@@ -0,0 +1,133 @@
+#include "job_system.hpp"
+#include <algorithm>
+
+
+JobSystem::JobSystem(u32 thread_count)
+{
+    for (u32 i = 0; i < std::max(thread_count, u32(1)); ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+
+    for (u32 i = 1; i < queues_.size(); ++i) {
+        threads_.emplace_back([this, i] { worker(i); });
+    }
+}
+
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wake_.notify_all();
+
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+
+bool JobSystem::pop(u32 queue, u32& job)
+{
+    auto& q = *queues_[queue];
+    std::lock_guard<std::mutex> lock(q.mutex_);
+
+    if (q.jobs_.empty()) {
+        return false;
+    }
+
+    job = q.jobs_.front();
+    q.jobs_.pop_front();
+    return true;
+}
+
+
+bool JobSystem::steal(u32 thief, u32& job)
+{
+    for (u32 i = 1; i < queues_.size(); ++i) {
+        auto& q = *queues_[(thief + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(q.mutex_);
+
+        if (not q.jobs_.empty()) {
+            job = q.jobs_.back();
+            q.jobs_.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void JobSystem::work(u32 queue)
+{
+    u32 job;
+    while (pop(queue, job) or steal(queue, job)) {
+        fn_(context_, job);
+
+        if (remaining_.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.notify_one();
+        }
+    }
+}
+
+
+void JobSystem::worker(u32 queue)
+{
+    u32 generation = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] {
+                return not running_ or generation not_eq generation_;
+            });
+
+            if (not running_) {
+                return;
+            }
+
+            generation = generation_;
+        }
+
+        work(queue);
+    }
+}
+
+
+void JobSystem::run(u32 count, Fn fn, void* context)
+{
+    if (count == 0) {
+        return;
+    }
+
+    if (queues_.size() == 1 or count == 1) {
+        for (u32 i = 0; i < count; ++i) {
+            fn(context, i);
+        }
+        return;
+    }
+
+    fn_ = fn;
+    context_ = context;
+    remaining_ = count;
+
+    for (u32 i = 0; i < count; ++i) {
+        auto& q = *queues_[i % queues_.size()];
+        std::lock_guard<std::mutex> lock(q.mutex_);
+        q.jobs_.push_back(i);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    work(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return remaining_ == 0; });
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "number/numeric.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// A small work-stealing job system, for running Platform::parallel_for() on
+// host builds. Each call deals its jobs out among per-thread deques. Every
+// thread works through its own deque from the front, and once it runs dry,
+// steals jobs from the back of the others' deques. The calling thread pitches
+// in, rather than sitting idle until the workers finish.
+//
+// The jobs are coarse (the game hands over one entity group per job), so we
+// deal them out one at a time, rather than in batches.
+
+
+class JobSystem {
+public:
+    using Fn = void (*)(void* context, u32 index);
+
+    // The calling thread counts as one of the threads, so we start one fewer
+    // worker.
+    JobSystem(u32 thread_count);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+
+    // Returns once fn has run for every index. Not reentrant.
+    void run(u32 count, Fn fn, void* context);
+
+    u32 thread_count() const
+    {
+        return queues_.size();
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex_;
+        std::deque<u32> jobs_;
+    };
+
+    bool pop(u32 queue, u32& job);
+    bool steal(u32 thief, u32& job);
+
+    // Runs jobs until there's nothing left to run or to steal.
+    void work(u32 queue);
+
+    void worker(u32 queue);
+
+    // Queue zero belongs to the calling thread.
+    std::vector<std::unique_ptr<Queue>> queues_;
+
+    Fn fn_ = nullptr;
+    void* context_ = nullptr;
+    std::atomic<u32> remaining_{0};
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    u32 generation_ = 0;
+    bool running_ = true;
+
+    std::vector<std::thread> threads_;
+};
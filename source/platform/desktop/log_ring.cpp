@@ -0,0 +1,208 @@
+#include "log_ring.hpp"
+#include <chrono>
+#include <cstring>
+#include <string>
+
+
+LogRing::LogRing(const char* path, std::ostream* echo)
+    : file_(path, std::ios_base::out | std::ios_base::binary), echo_(echo),
+      path_(path)
+{
+    for (u32 i = 0; i < slot_count; ++i) {
+        slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+
+    thread_ = std::thread([this] { run(); });
+}
+
+
+LogRing::~LogRing()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+
+void LogRing::push(Severity severity, const char* msg)
+{
+    const u32 length = strlen(msg);
+    const u32 slots_needed = (length + slot_text_size - 1) / slot_text_size;
+    const u32 count = std::min(max_record_slots, std::max(u32(1), slots_needed));
+
+    u32 pos = enqueue_pos_.load(std::memory_order_relaxed);
+
+    while (true) {
+        // The consumer frees slots in order, so if the last slot that we need
+        // is free, then so are all of the others.
+        auto& last = slots_[(pos + count - 1) % slot_count];
+        const s32 diff =
+            last.sequence_.load(std::memory_order_acquire) - (pos + count - 1);
+
+        if (diff == 0) {
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + count, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    u32 remaining = std::min(length, count * slot_text_size);
+
+    for (u32 i = 0; i < count; ++i) {
+        auto& slot = slots_[(pos + i) % slot_count];
+        const u32 n = std::min(remaining, slot_text_size);
+
+        slot.severity_ = severity;
+        slot.count_ = count;
+        slot.length_ = n;
+        memcpy(slot.text_, msg + i * slot_text_size, n);
+        remaining -= n;
+    }
+
+    // Publish in reverse order, so that once the consumer sees the first slot
+    // of the record, it knows that the rest of the record is there too.
+    for (u32 i = count; i > 0; --i) {
+        slots_[(pos + i - 1) % slot_count].sequence_.store(
+            pos + i, std::memory_order_release);
+    }
+
+    // Get important messages to disk promptly, in case we're about to
+    // crash. Also wake the writer whenever we fill another quarter of the
+    // ring, so that bursts of messages don't overflow it.
+    constexpr u32 quarter = slot_count / 4;
+    if (severity >= Severity::warning or
+        (pos + count) / quarter not_eq pos / quarter) {
+        wake_.notify_one();
+    }
+}
+
+
+static const char* severity_label(Severity severity)
+{
+    switch (severity) {
+    default:
+    case Severity::info:
+        return "info";
+    case Severity::warning:
+        return "warning";
+    case Severity::error:
+        return "error";
+    }
+}
+
+
+void LogRing::drain(std::string& out)
+{
+    while (true) {
+        auto& first = slots_[dequeue_pos_ % slot_count];
+        if (first.sequence_.load(std::memory_order_acquire) not_eq
+            dequeue_pos_ + 1) {
+            break;
+        }
+
+        out += '[';
+        out += severity_label(first.severity_);
+        out += "] ";
+
+        const u32 count = first.count_;
+        for (u32 i = 0; i < count; ++i) {
+            auto& slot = slots_[(dequeue_pos_ + i) % slot_count];
+            out.append(slot.text_, slot.length_);
+
+            // Hand the slot back to the producers, one lap ahead.
+            slot.sequence_.store(dequeue_pos_ + i + slot_count,
+                                 std::memory_order_release);
+        }
+
+        out += '\n';
+
+        dequeue_pos_ += count;
+    }
+}
+
+
+void LogRing::run()
+{
+    std::string text;
+
+    while (true) {
+        bool exiting;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait_for(lock, std::chrono::milliseconds(20));
+            exiting = not running_;
+        }
+
+        text.clear();
+
+        if (auto dropped = dropped_.exchange(0, std::memory_order_relaxed)) {
+            text += "[warning] log ring full, dropped ";
+            text += std::to_string(dropped);
+            text += " messages\n";
+        }
+
+        drain(text);
+
+        if (not text.empty()) {
+            file_.write(text.data(), text.size());
+            file_.flush();
+            if (echo_) {
+                *echo_ << text << std::flush;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            file_size_.fetch_add(text.size(), std::memory_order_relaxed);
+            flushed_pos_ = dequeue_pos_;
+        }
+        flushed_.notify_all();
+
+        if (exiting) {
+            return;
+        }
+    }
+}
+
+
+void LogRing::flush()
+{
+    const u32 target = enqueue_pos_.load(std::memory_order_relaxed);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.notify_one();
+
+    // NOTE: signed difference, in case the ring position wraps.
+    flushed_.wait(lock, [&] { return s32(flushed_pos_ - target) >= 0; });
+}
+
+
+u32 LogRing::read(u32 offset, void* buffer, u32 num_bytes)
+{
+    flush();
+
+    const u32 size = file_size_.load(std::memory_order_relaxed);
+    const u32 avail = offset < size ? std::min(num_bytes, size - offset) : 0;
+
+    if (avail) {
+        if (not reader_.is_open()) {
+            reader_.open(path_, std::ios_base::in | std::ios_base::binary);
+        }
+        reader_.clear();
+        reader_.seekg(offset);
+        reader_.read((char*)buffer, avail);
+    }
+
+    memset((char*)buffer + avail, 0, num_bytes - avail);
+
+    return avail;
+}
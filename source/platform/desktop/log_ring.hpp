@@ -0,0 +1,95 @@
+#pragma once
+
+#include "number/numeric.hpp"
+#include "severity.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+
+// Asynchronous logging for the desktop build. Logging a message copies it into
+// a lock-free ring of fixed-size binary records, and a background thread drains
+// the ring, formats the records, and writes them to the logfile (and
+// optionally, echoes them to a console stream). So logging from the game loop
+// never waits on file I/O.
+//
+// The ring is a bounded multi-producer queue, in the style of Dmitry Vyukov's
+// MPMC queue: each slot carries a sequence number, which tells producers when
+// the slot is free, and tells the consumer when the slot holds a complete
+// record. Long messages occupy several consecutive slots, which the producer
+// reserves all at once, so that messages from different threads cannot
+// interleave. If the ring is full, we drop the message, and the writer reports
+// the number of dropped messages later on.
+
+
+class LogRing {
+public:
+    LogRing(const char* path, std::ostream* echo);
+    ~LogRing();
+
+    LogRing(const LogRing&) = delete;
+
+    // Thread safe, lock free.
+    void push(Severity severity, const char* msg);
+
+    // Blocks until everything pushed so far reaches the logfile.
+    void flush();
+
+    // Copies up to num_bytes of the logfile contents, starting at
+    // offset. Zero-fills whatever part of the buffer extends past the end of
+    // the logfile. Returns the number of bytes copied.
+    u32 read(u32 offset, void* buffer, u32 num_bytes);
+
+private:
+    struct Slot {
+        std::atomic<u32> sequence_;
+
+        // The first slot of a record holds the severity and total slot
+        // count, subsequent slots continue the text.
+        Severity severity_;
+        u8 count_;
+        u8 length_;
+        char text_[57];
+    };
+
+    static_assert(sizeof(Slot) == 64);
+
+    static constexpr u32 slot_count = 1024;
+    static constexpr u32 slot_text_size = sizeof Slot::text_;
+
+    // Longer messages get truncated.
+    static constexpr u32 max_record_slots = 32;
+
+    // Formats all complete records into the output string.
+    void drain(std::string& out);
+
+    void run();
+
+    Slot slots_[slot_count];
+
+    std::atomic<u32> enqueue_pos_{0};
+    u32 dequeue_pos_ = 0;
+
+    std::atomic<u32> dropped_{0};
+
+    std::ofstream file_;
+    std::ostream* echo_;
+
+    // Logfile bytes written, and the ring position that the file contents
+    // reflect, for flush().
+    std::atomic<u32> file_size_{0};
+    u32 flushed_pos_ = 0;
+
+    std::ifstream reader_;
+    const char* path_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable flushed_;
+    bool running_ = true;
+
+    std::thread thread_;
+};
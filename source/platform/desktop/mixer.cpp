@@ -0,0 +1,244 @@
+#include "mixer.hpp"
+#include <cstring>
+
+#if defined(__SSE2__) or defined(_M_X64) or                                     \
+    (defined(_M_IX86_FP) and _M_IX86_FP >= 2)
+#define MIXER_SSE2
+#include <emmintrin.h>
+#endif
+
+
+static u32 hash_name(const char* name)
+{
+    // FNV-1a
+    u32 hash = 2166136261u;
+    while (*name) {
+        hash ^= u8(*name++);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+
+Mixer::Mixer()
+{
+    for (auto& s : voice_sounds_) {
+        s.store(no_sound, std::memory_order_relaxed);
+    }
+}
+
+
+Mixer::Gain Mixer::gain(Float volume)
+{
+    return static_cast<Gain>(clamp(volume, 0.f, 1.f) * unity_gain);
+}
+
+
+Mixer::SoundHandle Mixer::load(const std::string& name,
+                               std::vector<s16>&& samples)
+{
+    const SoundHandle handle = sounds_.size();
+    sounds_.push_back({name, std::move(samples)});
+
+    // Rebuild the index, keeping the table at most half full, so that probe
+    // sequences stay short.
+    size_t table_size = 16;
+    while (table_size < sounds_.size() * 2) {
+        table_size *= 2;
+    }
+
+    index_.assign(table_size, no_sound);
+
+    for (SoundHandle h = 0; h < sounds_.size(); ++h) {
+        auto slot = hash_name(sounds_[h].name_.c_str()) & (table_size - 1);
+        while (index_[slot] not_eq no_sound) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        index_[slot] = h;
+    }
+
+    return handle;
+}
+
+
+std::optional<Mixer::SoundHandle> Mixer::find(const char* name) const
+{
+    if (index_.empty()) {
+        return {};
+    }
+
+    const auto mask = index_.size() - 1;
+
+    for (auto slot = hash_name(name) & mask; index_[slot] not_eq no_sound;
+         slot = (slot + 1) & mask) {
+        if (sounds_[index_[slot]].name_ == name) {
+            return index_[slot];
+        }
+    }
+
+    return {};
+}
+
+
+void Mixer::play(SoundHandle sound, int priority, Gain left, Gain right)
+{
+    const auto head = request_head_.load(std::memory_order_relaxed);
+    const auto next = (head + 1) % request_queue_size;
+
+    if (next == request_tail_.load(std::memory_order_acquire)) {
+        // The mixer thread has fallen far behind. Dropping a sound effect is
+        // better than stalling the game loop.
+        return;
+    }
+
+    requests_[head] = {sound, priority, left, right};
+    request_head_.store(next, std::memory_order_release);
+}
+
+
+bool Mixer::is_playing(SoundHandle sound) const
+{
+    for (auto& s : voice_sounds_) {
+        if (s.load(std::memory_order_relaxed) == sound) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void Mixer::start(const PlayRequest& request)
+{
+    int slot = -1;
+
+    for (int i = 0; i < voice_count; ++i) {
+        if (voices_[i].data_ == nullptr) {
+            slot = i;
+            break;
+        }
+    }
+
+    if (slot == -1) {
+        int lowest = 0;
+        for (int i = 1; i < voice_count; ++i) {
+            if (voices_[i].priority_ < voices_[lowest].priority_) {
+                lowest = i;
+            }
+        }
+
+        if (voices_[lowest].priority_ >= request.priority_) {
+            return;
+        }
+
+        slot = lowest;
+    }
+
+    auto& sound = sounds_[request.sound_];
+
+    auto& v = voices_[slot];
+    v.data_ = sound.samples_.data();
+    v.position_ = 0;
+    v.length_ = sound.samples_.size();
+    v.priority_ = request.priority_;
+    v.left_ = request.left_;
+    v.right_ = request.right_;
+
+    voice_sounds_[slot].store(request.sound_, std::memory_order_relaxed);
+}
+
+
+// NOTE: The mixing functions compute (sample * gain) >> 16, i.e. half of the
+// actual Q15 product, and accumulate with saturation. The final pass doubles
+// the mixed signal. Mixing at half scale gives us a bit of headroom before
+// overlapping loud sounds start to clip.
+
+
+static void
+mix_voice_scalar(s16* out, const s16* in, u32 count, s16 left, s16 right)
+{
+    for (u32 i = 0; i < count; ++i) {
+        const s32 l = out[i * 2] + ((in[i] * left) >> 16);
+        const s32 r = out[i * 2 + 1] + ((in[i] * right) >> 16);
+        out[i * 2] = clamp(l, -32768, 32767);
+        out[i * 2 + 1] = clamp(r, -32768, 32767);
+    }
+}
+
+
+static void mix_voice(s16* out, const s16* in, u32 count, s16 left, s16 right)
+{
+#ifdef MIXER_SSE2
+    const __m128i gains = _mm_set_epi16(
+        right, left, right, left, right, left, right, left);
+
+    // Four mono input samples expand to eight interleaved stereo samples,
+    // i.e. one vector's worth of output.
+    u32 i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i mono = _mm_loadl_epi64((const __m128i*)(in + i));
+        const __m128i stereo = _mm_unpacklo_epi16(mono, mono);
+        const __m128i scaled = _mm_mulhi_epi16(stereo, gains);
+
+        __m128i* dest = (__m128i*)(out + i * 2);
+        _mm_storeu_si128(dest, _mm_adds_epi16(_mm_loadu_si128(dest), scaled));
+    }
+
+    mix_voice_scalar(out + i * 2, in + i, count - i, left, right);
+#else
+    mix_voice_scalar(out, in, count, left, right);
+#endif
+}
+
+
+static void finalize(s16* out, u32 sample_count)
+{
+    u32 i = 0;
+
+#ifdef MIXER_SSE2
+    for (; i + 8 <= sample_count; i += 8) {
+        __m128i* dest = (__m128i*)(out + i);
+        const __m128i v = _mm_loadu_si128(dest);
+        _mm_storeu_si128(dest, _mm_adds_epi16(v, v));
+    }
+#endif
+
+    for (; i < sample_count; ++i) {
+        out[i] = clamp(out[i] * 2, -32768, 32767);
+    }
+}
+
+
+void Mixer::mix(s16* output, u32 frame_count)
+{
+    auto tail = request_tail_.load(std::memory_order_relaxed);
+    const auto head = request_head_.load(std::memory_order_acquire);
+
+    while (tail not_eq head) {
+        start(requests_[tail]);
+        tail = (tail + 1) % request_queue_size;
+    }
+
+    request_tail_.store(tail, std::memory_order_release);
+
+    memset(output, 0, frame_count * channel_count * sizeof(s16));
+
+    for (int i = 0; i < voice_count; ++i) {
+        auto& v = voices_[i];
+        if (v.data_ == nullptr) {
+            continue;
+        }
+
+        const u32 count = std::min(frame_count, v.length_ - v.position_);
+
+        mix_voice(output, v.data_ + v.position_, count, v.left_, v.right_);
+
+        v.position_ += count;
+
+        if (v.position_ == v.length_) {
+            v = Voice{};
+            voice_sounds_[i].store(no_sound, std::memory_order_relaxed);
+        }
+    }
+
+    finalize(output, frame_count * channel_count);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "number/numeric.hpp"
+#include <array>
+#include <atomic>
+#include <optional>
+#include <string>
+#include <vector>
+
+
+// A software mixer for the desktop build. Rather than handing each sound effect
+// to the audio library as its own stream, we decode all of the sound effects
+// up front, and mix active voices into a single stereo output stream, from the
+// audio library's streaming thread. The game thread passes play requests to the
+// mixer through a lock-free queue, so starting a sound never allocates, and
+// never blocks on the audio thread.
+//
+// The sound effects are the gameboy advance's 8-bit 16kHz mono samples,
+// widened to 16 bit, and the mixer outputs 16kHz interleaved stereo.
+
+
+class Mixer {
+public:
+    using SoundHandle = u16;
+
+    static constexpr int voice_count = 32;
+    static constexpr u32 sample_rate = 16000;
+    static constexpr u32 channel_count = 2;
+
+    // Q15 fixed point, i.e. 32767 plays the sound at full volume.
+    using Gain = s16;
+
+    static constexpr Gain unity_gain = 32767;
+
+    static Gain gain(Float volume);
+
+
+    Mixer();
+
+
+    // Register a sound. Not thread-safe, do all of the loading before starting
+    // the output stream.
+    SoundHandle load(const std::string& name, std::vector<s16>&& samples);
+
+    // Hashed lookup, does not allocate.
+    std::optional<SoundHandle> find(const char* name) const;
+
+    u32 length(SoundHandle sound) const
+    {
+        return sounds_[sound].samples_.size();
+    }
+
+
+    // Called from the game thread. If all voices are busy, the new sound
+    // replaces the lowest priority voice, but only if the new sound has a
+    // higher priority.
+    void play(SoundHandle sound, int priority, Gain left, Gain right);
+
+    // NOTE: Does not account for play requests that the mixer thread has not
+    // picked up yet.
+    bool is_playing(SoundHandle sound) const;
+
+
+    // Called from the streaming thread. Fills the output buffer with
+    // frame_count interleaved stereo frames.
+    void mix(s16* output, u32 frame_count);
+
+
+private:
+    struct Sound {
+        std::string name_;
+        std::vector<s16> samples_;
+    };
+
+    struct Voice {
+        const s16* data_ = nullptr;
+        u32 position_ = 0;
+        u32 length_ = 0;
+        int priority_ = 0;
+        Gain left_ = 0;
+        Gain right_ = 0;
+    };
+
+    struct PlayRequest {
+        SoundHandle sound_;
+        int priority_;
+        Gain left_;
+        Gain right_;
+    };
+
+    void start(const PlayRequest& request);
+
+    static constexpr SoundHandle no_sound = 0xffff;
+
+    std::vector<Sound> sounds_;
+
+    // Open addressing hash table, mapping name hashes to sound handles.
+    std::vector<SoundHandle> index_;
+
+    Voice voices_[voice_count];
+
+    // Which sound each voice is playing, for is_playing(). Written by the
+    // mixer thread, read by the game thread.
+    std::array<std::atomic<SoundHandle>, voice_count> voice_sounds_;
+
+    // Single producer (game thread), single consumer (mixer thread).
+    static constexpr u32 request_queue_size = 64;
+    PlayRequest requests_[request_queue_size];
+    std::atomic<u32> request_head_{0};
+    std::atomic<u32> request_tail_{0};
+};
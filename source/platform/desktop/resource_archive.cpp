@@ -0,0 +1,357 @@
+#include "resource_archive.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+#if defined(_WIN32) or defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+static const u32 archive_magic = 0x4B504A42; // "BJPK"
+static const u32 archive_version = 1;
+
+
+// Must match the list in build/pack_resources.py.
+static const char* const resource_folders[] = {
+    "scripts",
+    "strings",
+    "images",
+    "sounds",
+    "shaders",
+};
+
+
+// In a development tree, someone may edit a script or a string file without
+// re-packing the archive. Rather than silently run with the old contents, we
+// ignore the archive whenever one of the loose files is newer.
+static bool archive_is_stale(const std::string& resource_folder,
+                             const std::string& archive_path)
+{
+    std::error_code err;
+    const auto packed = std::filesystem::last_write_time(archive_path, err);
+    if (err) {
+        return false;
+    }
+
+    for (auto folder : resource_folders) {
+        for (auto& dirent : std::filesystem::directory_iterator(
+                 std::filesystem::path(resource_folder) / folder, err)) {
+            if (dirent.is_regular_file() and
+                dirent.last_write_time(err) > packed) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+ResourceArchive::ResourceArchive(const std::string& resource_folder)
+    : resource_folder_(resource_folder)
+{
+    const auto archive_path = resource_folder_ + "resources.pak";
+
+    if (not archive_is_stale(resource_folder_, archive_path)) {
+        map(archive_path);
+    }
+
+    if (is_packed()) {
+        return;
+    }
+
+    for (auto folder : resource_folders) {
+        std::error_code err;
+        for (auto& dirent : std::filesystem::directory_iterator(
+                 std::filesystem::path(resource_folder_) / folder, err)) {
+            if (dirent.is_regular_file()) {
+                loose_index_.insert(std::string(folder) + "/" +
+                                    dirent.path().filename().string());
+            }
+        }
+    }
+}
+
+
+ResourceArchive::~ResourceArchive()
+{
+    unmap();
+}
+
+
+#if defined(_WIN32) or defined(_WIN64)
+
+
+void ResourceArchive::map(const std::string& path)
+{
+    auto file = CreateFileA(path.c_str(),
+                            GENERIC_READ,
+                            FILE_SHARE_READ,
+                            nullptr,
+                            OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER size;
+    if (not GetFileSizeEx(file, &size) or size.QuadPart == 0) {
+        unmap();
+        return;
+    }
+
+    mapping_handle_ =
+        CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (not mapping_handle_) {
+        unmap();
+        return;
+    }
+
+    auto view = MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0);
+    if (not view) {
+        unmap();
+        return;
+    }
+
+    mapping_ = (const char*)view;
+    mapping_size_ = size.QuadPart;
+
+    if (not validate()) {
+        unmap();
+    }
+}
+
+
+void ResourceArchive::unmap()
+{
+    if (mapping_) {
+        UnmapViewOfFile(mapping_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+}
+
+
+#else
+
+
+void ResourceArchive::map(const std::string& path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) not_eq 0 or st.st_size == 0) {
+        close(fd);
+        return;
+    }
+
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        return;
+    }
+
+    mapping_ = (const char*)addr;
+    mapping_size_ = st.st_size;
+
+    if (not validate()) {
+        unmap();
+    }
+}
+
+
+void ResourceArchive::unmap()
+{
+    if (mapping_) {
+        munmap((void*)mapping_, mapping_size_);
+        mapping_ = nullptr;
+        mapping_size_ = 0;
+    }
+}
+
+
+#endif
+
+
+bool ResourceArchive::validate() const
+{
+    if (mapping_size_ < sizeof(Header)) {
+        return false;
+    }
+
+    auto header = (const Header*)mapping_;
+    if (header->magic_ not_eq archive_magic or
+        header->version_ not_eq archive_version or
+        header->count_ > (mapping_size_ - sizeof(Header)) / sizeof(Entry)) {
+        return false;
+    }
+
+    for (auto it = index_begin(); it not_eq index_end(); ++it) {
+        // NOTE: Each file's data is followed by a null terminator.
+        if (u64(it->name_offset_) + it->name_length_ > mapping_size_ or
+            u64(it->data_offset_) + it->data_size_ >= mapping_size_) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+std::string ResourceArchive::name(const Entry& entry) const
+{
+    return std::string(mapping_ + entry.name_offset_, entry.name_length_);
+}
+
+
+int ResourceArchive::compare(const Entry& entry,
+                             const char* folder,
+                             const char* filename) const
+{
+    const u8* pos = (const u8*)mapping_ + entry.name_offset_;
+    const u8* end = pos + entry.name_length_;
+
+    // Walk the entry name alongside folder, then the separator, then the
+    // filename.
+    const char* parts[] = {folder, "/", filename};
+
+    for (auto part : parts) {
+        for (auto p = (const u8*)part; *p; ++p, ++pos) {
+            if (pos == end) {
+                return -1;
+            }
+            if (*pos not_eq *p) {
+                return int(*pos) - int(*p);
+            }
+        }
+    }
+
+    return pos == end ? 0 : 1;
+}
+
+
+const ResourceArchive::Entry*
+ResourceArchive::lookup(const char* folder, const char* filename) const
+{
+    auto less = [&](const Entry& entry, int) {
+        return compare(entry, folder, filename) < 0;
+    };
+
+    auto found = std::lower_bound(index_begin(), index_end(), 0, less);
+
+    if (found == index_end() or compare(*found, folder, filename)) {
+        return nullptr;
+    }
+
+    return found;
+}
+
+
+bool ResourceArchive::exists(const char* folder, const char* filename) const
+{
+    if (is_packed()) {
+        return lookup(folder, filename);
+    }
+
+    return loose_index_.count(std::string(folder) + "/" + filename);
+}
+
+
+std::optional<ResourceArchive::File>
+ResourceArchive::find(const char* folder, const char* filename) const
+{
+    if (is_packed()) {
+        if (auto entry = lookup(folder, filename)) {
+            return File{mapping_ + entry->data_offset_, entry->data_size_};
+        }
+        return {};
+    }
+
+    const auto key = std::string(folder) + "/" + filename;
+
+    if (not loose_index_.count(key)) {
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(loose_files_mutex_);
+
+    auto found = loose_files_.find(key);
+    if (found == loose_files_.end()) {
+        std::ifstream file(std::filesystem::path(resource_folder_) / folder /
+                               filename,
+                           std::ios::binary);
+        if (not file) {
+            return {};
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        found = loose_files_.emplace(key, buffer.str()).first;
+    }
+
+    return File{found->second.c_str(), u32(found->second.size())};
+}
+
+
+void ResourceArchive::for_each(
+    const char* folder,
+    const std::function<void(const std::string&, File)>& callback) const
+{
+    const auto prefix = std::string(folder) + "/";
+
+    if (is_packed()) {
+        auto less = [&](const Entry& entry, const std::string& p) {
+            return name(entry) < p;
+        };
+
+        auto it = std::lower_bound(index_begin(), index_end(), prefix, less);
+
+        for (; it not_eq index_end(); ++it) {
+            const auto entry_name = name(*it);
+            if (entry_name.compare(0, prefix.size(), prefix) not_eq 0) {
+                break;
+            }
+
+            callback(entry_name.substr(prefix.size()),
+                     File{mapping_ + it->data_offset_, it->data_size_});
+        }
+
+        return;
+    }
+
+    for (auto it = loose_index_.lower_bound(prefix);
+         it not_eq loose_index_.end() and
+         it->compare(0, prefix.size(), prefix) == 0;
+         ++it) {
+
+        const auto filename = it->substr(prefix.size());
+        if (auto file = find(folder, filename.c_str())) {
+            callback(filename, *file);
+        }
+    }
+}
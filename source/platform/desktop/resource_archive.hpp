@@ -0,0 +1,124 @@
+#pragma once
+
+#include "number/numeric.hpp"
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+
+
+// The desktop build's game resources (scripts, strings, images, sounds, and
+// shaders), packed into a single archive by build/pack_resources.py. We map
+// the archive into memory once, at startup, and hand out pointers straight
+// into the mapping, so loading a file neither reads from disk nor copies.
+//
+// Archive layout, all fields little endian u32:
+//
+//   header : magic, version, entry count, unused
+//   index  : name offset, name length, data offset, data size, for each file
+//   names  : the path of each file, relative to the resource folder, with
+//            forward slashes, e.g. "scripts/init.lisp"
+//   data   : the contents of each file, eight byte aligned, and followed by a
+//            null byte, so that text files may be used as c strings
+//
+// The index is sorted by name, so lookups are binary searches, and the files
+// in a folder occupy a contiguous range of the index.
+//
+// Without an archive, or when any of the loose files is newer than the archive
+// (e.g. after editing a script), we fall back to reading loose files from the
+// resource folder, and keep them cached, so that the pointers remain valid. We
+// list the resource folders once, at startup, so that checking whether a file
+// exists does not touch the filesystem in either case.
+
+
+class ResourceArchive {
+public:
+    struct File {
+        const char* data_;
+        u32 size_;
+    };
+
+    ResourceArchive(const std::string& resource_folder);
+    ~ResourceArchive();
+
+    ResourceArchive(const ResourceArchive&) = delete;
+
+    bool is_packed() const
+    {
+        return mapping_ not_eq nullptr;
+    }
+
+    bool exists(const char* folder, const char* filename) const;
+
+    // Thread safe. The file contents remain valid for the lifetime of the
+    // archive.
+    std::optional<File> find(const char* folder, const char* filename) const;
+
+    // Invokes the callback with the name and contents of each file in a
+    // folder.
+    void for_each(const char* folder,
+                  const std::function<void(const std::string&, File)>& callback)
+        const;
+
+private:
+    struct Entry {
+        u32 name_offset_;
+        u32 name_length_;
+        u32 data_offset_;
+        u32 data_size_;
+    };
+
+    struct Header {
+        u32 magic_;
+        u32 version_;
+        u32 count_;
+        u32 unused_;
+    };
+
+    static_assert(sizeof(Entry) == 16);
+    static_assert(sizeof(Header) == 16);
+
+    // Maps the archive, and validates the header and index. Leaves the
+    // archive unmapped if anything looks wrong.
+    void map(const std::string& path);
+    void unmap();
+
+    bool validate() const;
+
+    const Entry* lookup(const char* folder, const char* filename) const;
+
+    std::string name(const Entry& entry) const;
+
+    // Compares an entry's name against folder/filename, without building the
+    // combined string.
+    int compare(const Entry& entry,
+                const char* folder,
+                const char* filename) const;
+
+    const Entry* index_begin() const
+    {
+        return (const Entry*)(mapping_ + sizeof(Header));
+    }
+
+    const Entry* index_end() const
+    {
+        return index_begin() + ((const Header*)mapping_)->count_;
+    }
+
+    const std::string resource_folder_;
+
+    const char* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+
+#if defined(_WIN32) or defined(_WIN64)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+
+    std::set<std::string> loose_index_;
+
+    mutable std::mutex loose_files_mutex_;
+    mutable std::map<std::string, std::string> loose_files_;
+};
@@ -0,0 +1,115 @@
+#include "texture_loader.hpp"
+
+
+TextureLoader::TextureLoader(const ResourceArchive& resources)
+    : resources_(resources)
+{
+    thread_ = std::thread([this] { run(); });
+}
+
+
+TextureLoader::~TextureLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    wake_.notify_one();
+    thread_.join();
+}
+
+
+bool TextureLoader::exists(const std::string& filename) const
+{
+    return resources_.exists("images", filename.c_str());
+}
+
+
+void TextureLoader::prefetch(const std::string& name)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto& entry = entries_[name];
+        if (entry.claimed_) {
+            return;
+        }
+
+        queue_.push_back(name);
+    }
+    wake_.notify_one();
+}
+
+
+std::shared_ptr<const sf::Image> TextureLoader::get(const std::string& name)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto& entry = entries_[name];
+
+    if (not entry.claimed_) {
+        load(lock, entry, name);
+    } else {
+        ready_.wait(lock, [&] { return entry.ready_; });
+    }
+
+    return entry.image_;
+}
+
+
+std::shared_ptr<const sf::Image>
+TextureLoader::decode(const std::string& name) const
+{
+    const auto file = resources_.find("images", (name + ".png").c_str());
+    if (not file) {
+        return nullptr;
+    }
+
+    auto image = std::make_shared<sf::Image>();
+    if (not image->loadFromMemory(file->data_, file->size_)) {
+        return nullptr;
+    }
+
+    return image;
+}
+
+
+void TextureLoader::load(std::unique_lock<std::mutex>& lock,
+                         Entry& entry,
+                         const std::string& name)
+{
+    entry.claimed_ = true;
+
+    // Entries are never erased, so the reference stays valid while we're not
+    // holding the lock.
+    lock.unlock();
+    auto image = decode(name);
+    lock.lock();
+
+    entry.image_ = std::move(image);
+    entry.ready_ = true;
+
+    ready_.notify_all();
+}
+
+
+void TextureLoader::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        wake_.wait(lock, [this] { return not running_ or not queue_.empty(); });
+
+        if (not running_) {
+            return;
+        }
+
+        const auto name = std::move(queue_.front());
+        queue_.pop_front();
+
+        auto& entry = entries_[name];
+        if (not entry.claimed_) {
+            load(lock, entry, name);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "resource_archive.hpp"
+#include <SFML/Graphics/Image.hpp>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+
+// Decodes images for the desktop build on a background thread. The game calls
+// prefetch() with the names of the textures that it's about to need, e.g. at
+// the start of a level transition, and by the time the graphics thread gets
+// around to swapping in a texture, the image is usually ready to upload. We
+// keep decoded images around, as the whole images folder takes up only a few
+// megabytes once decoded, and the game switches back and forth between the
+// same few overlay textures and charsets.
+
+
+class TextureLoader {
+public:
+    TextureLoader(const ResourceArchive& resources);
+    ~TextureLoader();
+
+    TextureLoader(const TextureLoader&) = delete;
+
+    // Whether the images folder contains a file, e.g. "overlay.txt".
+    bool exists(const std::string& filename) const;
+
+    // Starts decoding name.png in the background, unless we already have.
+    void prefetch(const std::string& name);
+
+    // Returns the decoded image. Waits for the background thread, if it's busy
+    // with the image, or decodes the image right away, if nobody asked for it
+    // in advance. Returns nullptr if the image failed to load.
+    std::shared_ptr<const sf::Image> get(const std::string& name);
+
+private:
+    struct Entry {
+        // Set once a thread starts decoding the image.
+        bool claimed_ = false;
+        bool ready_ = false;
+        std::shared_ptr<const sf::Image> image_;
+    };
+
+    std::shared_ptr<const sf::Image> decode(const std::string& name) const;
+
+    // Decodes the image for an entry claimed by the calling thread. Expects
+    // the lock to be held, and releases it while decoding.
+    void load(std::unique_lock<std::mutex>& lock,
+              Entry& entry,
+              const std::string& name);
+
+    void run();
+
+    const ResourceArchive& resources_;
+
+    std::map<std::string, Entry> entries_;
+    std::deque<std::string> queue_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable ready_;
+    bool running_ = true;
+
+    std::thread thread_;
+};
@@ -27,6 +27,69 @@ void cartridge_interrupt_handler()
 }
 
 
+// Decompresses tile data in the BIOS LZ77 format (as output by grit -Zlz77)
+// directly into vram. Vram does not support byte writes, so we hold on to each
+// even byte until its odd neighbor comes along, and write whole halfwords.
+IWRAM_CODE
+void lz77_decompress_vram(void* dest, const void* src)
+{
+    const u8* in = (const u8*)src;
+
+    // Header: compression type in bits 4-7, decompressed size in bits 8-31.
+    const u32 size = *(const u32*)src >> 8;
+    in += 4;
+
+    u16* out = (u16*)dest;
+    const u8* out_bytes = (const u8*)dest;
+
+    u32 pos = 0;
+    u32 pending = 0;
+
+    while (pos < size) {
+        u8 flags = *in++;
+
+        for (int i = 0; i < 8 and pos < size; ++i, flags <<= 1) {
+            if (flags & 0x80) {
+                // A back reference: four bits of length, twelve bits of
+                // displacement.
+                u32 len = (in[0] >> 4) + 3;
+                const u32 disp = (((in[0] & 0x0f) << 8) | in[1]) + 1;
+                in += 2;
+
+                for (; len and pos < size; --len) {
+                    const u32 from = pos - disp;
+
+                    // The previous byte may still be waiting to be written.
+                    const u8 c = ((pos & 1) and from == pos - 1)
+                                     ? pending
+                                     : out_bytes[from];
+
+                    if (pos & 1) {
+                        out[pos >> 1] = pending | (c << 8);
+                    } else {
+                        pending = c;
+                    }
+                    ++pos;
+                }
+            } else {
+                const u8 c = *in++;
+
+                if (pos & 1) {
+                    out[pos >> 1] = pending | (c << 8);
+                } else {
+                    pending = c;
+                }
+                ++pos;
+            }
+        }
+    }
+
+    if (pos & 1) {
+        out[pos >> 1] = pending;
+    }
+}
+
+
 #include "gba_platform_soundcontext.hpp"
 
 
@@ -36,13 +99,88 @@ extern SoundContext snd_ctx;
 
 
 #define REG_SGFIFOA *(volatile u32*)0x40000A0
+#define REG_SGFIFOB *(volatile u32*)0x40000A4
+
+
+// Cpu cycles spent in the audio isr since the last frame. Read (and cleared) by
+// the DeltaClock, for the frame profiler.
+volatile int audio_isr_tics;
+
+
+// Packed arithmetic on four signed 8-bit samples at once, within a 32-bit
+// word. Adds the samples lane by lane, without letting carries spill from one
+// sample into the next. Lanes wrap around on overflow, like per-byte adds.
+static inline u32 packed_add(u32 a, u32 b)
+{
+    return ((a & 0x7f7f7f7f) + (b & 0x7f7f7f7f)) ^ ((a ^ b) & 0x80808080);
+}
+
+
+// The sign bit of each lane of a + b that overflowed, i.e. lanes where both
+// inputs share a sign, and the sum does not.
+static inline u32 packed_overflow(u32 a, u32 b, u32 sum)
+{
+    return ~(a ^ b) & (a ^ sum) & 0x80808080;
+}
+
+
+// Clamps each overflowed lane of sum = a + b to the s8 range.
+static inline u32 packed_clamp(u32 a, u32 sum, u32 overflow)
+{
+    const u32 mask = (overflow >> 7) * 0xff;
+    const u32 clamp = 0x7f7f7f7f + ((a & 0x80808080) >> 7);
+
+    return (sum & ~mask) | (clamp & mask);
+}
+
+
+// Adds a voice's eight samples, in two words, to the mix, saturating rather
+// than wrapping around. Wrapped samples, with music and several loud voices
+// playing at once, turned into harsh pops. Lanes rarely overflow, so we check
+// both words with one branch, and only clamp when we need to.
+static inline void packed_mix(u32& mix_0, u32& mix_1, u32 s_0, u32 s_1)
+{
+    const u32 sum_0 = packed_add(mix_0, s_0);
+    const u32 sum_1 = packed_add(mix_1, s_1);
+
+    const u32 overflow_0 = packed_overflow(mix_0, s_0, sum_0);
+    const u32 overflow_1 = packed_overflow(mix_1, s_1, sum_1);
+
+    if (UNLIKELY(overflow_0 | overflow_1)) {
+        mix_0 = packed_clamp(mix_0, sum_0, overflow_0);
+        mix_1 = packed_clamp(mix_1, sum_1, overflow_1);
+    } else {
+        mix_0 = sum_0;
+        mix_1 = sum_1;
+    }
+}
+
+
+// Scales each of the four samples by volume / 16, for volumes of zero through
+// sixteen. Biasing the samples into an unsigned range lets us multiply two
+// samples at once, with each sample spread out across sixteen bits, so that the
+// products stay within their lanes. Each scaled lane still carries the bias,
+// times the volume, which we swap back for the plain bias before undoing it.
+static inline u32 packed_scale(u32 w, u32 volume)
+{
+    const u32 biased = w ^ 0x80808080;
+    const u32 rebias = (128 - 8 * volume) * 0x00010001;
+
+    const u32 even = (((biased & 0x00ff00ff) * volume) >> 4) & 0x00ff00ff;
+    const u32 odd = ((((biased >> 8) & 0x00ff00ff) * volume) >> 4) & 0x00ff00ff;
+
+    return ((even + rebias) | ((odd + rebias) << 8)) ^ 0x80808080;
+}
 
 
 // NOTE: The primary audio mixing routine.
 IWRAM_CODE
 void audio_update_fast_isr()
 {
-    alignas(4) AudioSample mixing_buffer[8];
+    // NOTE: The delta clock's timer counts cpu cycles. The isr runs for far
+    // less than one overflow period, so unsigned 16 bit subtraction gives us
+    // the correct elapsed time even if the counter wraps.
+    const u16 start_tics = REG_TM3CNT_L;
 
     auto& music_pos = snd_ctx.music_track_pos;
     const auto music_len = snd_ctx.music_track_length;
@@ -51,11 +189,12 @@ void audio_update_fast_isr()
     if (music_pos > music_len) {
         music_pos = 0;
     }
+
     // Load 8 music samples upfront (in chunks of four), to try to take
-    // advantage of sequential cartridge reads.
-    auto music_in = (u32*)mixing_buffer;
-    *(music_in++) = ((u32*)(snd_ctx.music_track))[music_pos++];
-    *(music_in) = ((u32*)(snd_ctx.music_track))[music_pos++];
+    // advantage of sequential cartridge reads. The mixing buffer lives in two
+    // registers, rather than in memory.
+    u32 mix_0 = ((u32*)(snd_ctx.music_track))[music_pos++];
+    u32 mix_1 = ((u32*)(snd_ctx.music_track))[music_pos++];
 
     auto it = snd_ctx.active_sounds.begin();
     while (it not_eq snd_ctx.active_sounds.end()) {
@@ -64,7 +203,7 @@ void audio_update_fast_isr()
         // eight. Incrementing by eight upfront is better than checking if index
         // + 8 is greater than sound length and then performing index += 8 after
         // doing the mixing, saves an addition.
-        int pos = it->position_;
+        const int pos = it->position_;
         it->position_ += 8;
 
         // Aha! __builtin_expect actually results in measurably better latency
@@ -72,29 +211,121 @@ void audio_update_fast_isr()
         if (UNLIKELY(it->position_ >= it->length_)) {
             it = snd_ctx.active_sounds.erase(it);
         } else {
-            // Manually unrolled loop below. Better performance during testing,
-            // uses more iwram of course.
-            //
-            // Note: storing the mixing buffer in a pointer and incrementing the
-            // write location resulted in notably better performance than
-            // subscript indexing into mixing_buffer with literal indices
-            // (mixing_buffer[0], mixing_buffer[1], etc.).
-            AudioSample* out = mixing_buffer;
-            *(out++) += it->data_[pos++]; // 0
-            *(out++) += it->data_[pos++]; // 1
-            *(out++) += it->data_[pos++]; // 2
-            *(out++) += it->data_[pos++]; // 3
-            *(out++) += it->data_[pos++]; // 4
-            *(out++) += it->data_[pos++]; // 5
-            *(out++) += it->data_[pos++]; // 6
-            *(out) += it->data_[pos++];   // 7
+            // NOTE: Sound data in ROM is word-aligned, and positions only ever
+            // advance in steps of eight, so word reads are safe here.
+            auto in = (const u32*)(it->data_ + pos);
+            packed_mix(mix_0, mix_1, in[0], in[1]);
             ++it;
         }
     }
 
-    auto sound_out = (u32*)mixing_buffer;
-
     // NOTE: yeah the register is a FIFO
-    REG_SGFIFOA = *(sound_out++);
-    REG_SGFIFOA = *(sound_out);
+    REG_SGFIFOA = mix_0;
+    REG_SGFIFOA = mix_1;
+
+    audio_isr_tics += (u16)(REG_TM3CNT_L - start_tics);
+}
+
+
+// Same as the fast mixer, but scales each voice by its volume. Voices at full
+// volume, which is most of them, skip the scaling.
+IWRAM_CODE
+void audio_update_spatialized_isr()
+{
+    const u16 start_tics = REG_TM3CNT_L;
+
+    auto& music_pos = snd_ctx.music_track_pos;
+
+    if (music_pos > snd_ctx.music_track_length) {
+        music_pos = 0;
+    }
+
+    u32 mix_0 = ((u32*)(snd_ctx.music_track))[music_pos++];
+    u32 mix_1 = ((u32*)(snd_ctx.music_track))[music_pos++];
+
+    auto it = snd_ctx.active_sounds.begin();
+    while (it not_eq snd_ctx.active_sounds.end()) {
+        const int pos = it->position_;
+        it->position_ += 8;
+
+        if (UNLIKELY(it->position_ >= it->length_)) {
+            it = snd_ctx.active_sounds.erase(it);
+        } else {
+            auto in = (const u32*)(it->data_ + pos);
+            u32 s_0 = in[0];
+            u32 s_1 = in[1];
+
+            if (const u32 volume = it->r_volume_; volume not_eq 16) {
+                s_0 = packed_scale(s_0, volume);
+                s_1 = packed_scale(s_1, volume);
+            }
+
+            packed_mix(mix_0, mix_1, s_0, s_1);
+            ++it;
+        }
+    }
+
+    REG_SGFIFOA = mix_0;
+    REG_SGFIFOA = mix_1;
+
+    audio_isr_tics += (u16)(REG_TM3CNT_L - start_tics);
+}
+
+
+// NOTE: Direct sound A plays the right channel, and B plays the left
+// channel. The sound chip needs to be configured for stereo output first.
+IWRAM_CODE
+void audio_update_spatialized_stereo_isr()
+{
+    const u16 start_tics = REG_TM3CNT_L;
+
+    auto& music_pos = snd_ctx.music_track_pos;
+
+    if (music_pos > snd_ctx.music_track_length) {
+        music_pos = 0;
+    }
+
+    u32 mix_r0 = ((u32*)(snd_ctx.music_track))[music_pos++];
+    u32 mix_r1 = ((u32*)(snd_ctx.music_track))[music_pos++];
+    u32 mix_l0 = mix_r0;
+    u32 mix_l1 = mix_r1;
+
+    auto it = snd_ctx.active_sounds.begin();
+    while (it not_eq snd_ctx.active_sounds.end()) {
+        const int pos = it->position_;
+        it->position_ += 8;
+
+        if (UNLIKELY(it->position_ >= it->length_)) {
+            it = snd_ctx.active_sounds.erase(it);
+        } else {
+            auto in = (const u32*)(it->data_ + pos);
+            const u32 s_0 = in[0];
+            const u32 s_1 = in[1];
+
+            u32 r_0 = s_0;
+            u32 r_1 = s_1;
+            if (const u32 volume = it->r_volume_; volume not_eq 16) {
+                r_0 = packed_scale(s_0, volume);
+                r_1 = packed_scale(s_1, volume);
+            }
+            packed_mix(mix_r0, mix_r1, r_0, r_1);
+
+            u32 l_0 = s_0;
+            u32 l_1 = s_1;
+            if (const u32 volume = it->l_volume_; volume not_eq 16) {
+                l_0 = packed_scale(s_0, volume);
+                l_1 = packed_scale(s_1, volume);
+            }
+            packed_mix(mix_l0, mix_l1, l_0, l_1);
+
+            ++it;
+        }
+    }
+
+    REG_SGFIFOA = mix_r0;
+    REG_SGFIFOA = mix_r1;
+    REG_SGFIFOB = mix_l0;
+    REG_SGFIFOB = mix_l1;
+
+    audio_isr_tics += (u16)(REG_TM3CNT_L - start_tics);
 }
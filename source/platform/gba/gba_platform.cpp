@@ -16,7 +16,9 @@
 #include "localization.hpp"
 #include "number/random.hpp"
 #include "platform/platform.hpp"
+#include "profiler.hpp"
 #include "rumble.h"
+#include "saveJournal.hpp"
 #include "script/lisp.hpp"
 #include "string.hpp"
 #include "util.hpp"
@@ -115,6 +117,21 @@ __attribute__((section(".iwram"), long_call)) void
 audio_update_fast_isr();
 
 
+__attribute__((section(".iwram"), long_call)) void
+audio_update_spatialized_isr();
+
+
+__attribute__((section(".iwram"), long_call)) void
+audio_update_spatialized_stereo_isr();
+
+
+__attribute__((section(".iwram"), long_call)) void
+lz77_decompress_vram(void* dest, const void* src);
+
+
+extern volatile int audio_isr_tics;
+
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 // Tile Memory Layout:
@@ -177,12 +194,37 @@ static constexpr int vram_tile_size()
 #include "images.cpp"
 
 
+struct SpriteFrames {
+    const char* name_;
+    const u16* ids_;
+    u16 count_;
+};
+
+
+#include "sprite_frames.cpp"
+
+
 static const TextureData* current_spritesheet = &sprite_textures[0];
+static const SpriteFrames* current_sprite_frames = nullptr;
 static const TextureData* current_tilesheet0 = &tile_textures[0];
 static const TextureData* current_tilesheet1 = &tile_textures[1];
 static const TextureData* current_overlay_texture = &overlay_textures[1];
 
 
+static constexpr u32 sprite_frame_size = vram_tile_size() * 8;
+
+// NOTE: The first tile of sprite vram is reserved, and the rest of it holds 126
+// frames of 32x16 pixels.
+static constexpr u32 sprite_vram_frames = 126;
+
+
+// The id of the spritesheet frame held by each frame of sprite vram (see
+// build/sprite_frames.py), or zero if unknown. Identical frames share an id
+// across spritesheets, so when swapping spritesheets, we only need to upload
+// the frames that differ.
+static u16 resident_sprite_frames[sprite_vram_frames];
+
+
 void start(Platform&);
 
 
@@ -263,6 +305,11 @@ Microseconds Platform::DeltaClock::reset()
     // (1 second / 60 frames) x (1,000,000 microseconds / 1 second) =
     // 16,666.6...
 
+    // NOTE: The audio isr measures itself against the timer that we're about
+    // to restart, so we don't want it to run until we're done.
+    const bool audio_isr_enabled = REG_IE & IRQ_TIMER1;
+    irqDisable(IRQ_TIMER1);
+
     irqDisable(IRQ_TIMER3);
     const auto tics = delta_read_tics();
     REG_TM3CNT_H = 0;
@@ -274,6 +321,14 @@ Microseconds Platform::DeltaClock::reset()
     REG_TM3CNT_L = 0;
     REG_TM3CNT_H = 1 << 7 | 1 << 6;
 
+    profiler::record(profiler::Marker::audio_isr,
+                     delta_convert_tics(audio_isr_tics));
+    audio_isr_tics = 0;
+
+    if (audio_isr_enabled) {
+        irqEnable(IRQ_TIMER1);
+    }
+
     return delta_convert_tics(tics);
 }
 
@@ -621,6 +676,7 @@ static bool unlock_gameboy_player(Platform& pfrm)
     }
 
     RegisterRamReset(RESET_VRAM);
+    memset(resident_sprite_frames, 0, sizeof resident_sprite_frames);
 
     return gbp_detected;
 }
@@ -978,6 +1034,36 @@ void Platform::push_task(Task* task)
 }
 
 
+void Platform::parallel_for(u32 count, ParallelFn fn, void* context)
+{
+    for (u32 i = 0; i < count; ++i) {
+        fn(context, i);
+    }
+}
+
+
+static void upload_sprite_frame(u32 vram_frame, u32 frame)
+{
+    u16 id = 0;
+    if (current_sprite_frames and frame < current_sprite_frames->count_) {
+        id = current_sprite_frames->ids_[frame];
+    }
+
+    if (id and resident_sprite_frames[vram_frame] == id) {
+        return;
+    }
+
+    const u8* image_data = (const u8*)current_spritesheet->tile_data_;
+    u8* spr_vram_base_addr = (u8*)&MEM_TILE[4][1];
+
+    memcpy32(spr_vram_base_addr + sprite_frame_size * vram_frame,
+             image_data + sprite_frame_size * frame,
+             sprite_frame_size / 4);
+
+    resident_sprite_frames[vram_frame] = id;
+}
+
+
 static void map_dynamic_textures()
 {
     for (int i = 0; i < Platform::dynamic_texture_count; ++i) {
@@ -986,21 +1072,14 @@ static void map_dynamic_textures()
             // Ok, so now, we want to perform a copy from ROM into the reserved
             // VRAM for our dynamic texture.
             const auto offset = mapping.spritesheet_offset_;
-            const u8* image_data = (const u8*)current_spritesheet->tile_data_;
-            u8* spr_vram_base_addr = (u8*)&MEM_TILE[4][1];
-
-            constexpr auto single_tile_size = vram_tile_size();
-            constexpr auto w32_h16_chunk_size = single_tile_size * 8;
-            constexpr auto w32_h32_chunk_size = w32_h16_chunk_size * 2;
-
-            memcpy32(spr_vram_base_addr + w32_h16_chunk_size * (i * 2),
-                     image_data + w32_h16_chunk_size * offset,
-                     // NOTE: we always copy in 32x32 chunks. Our dynamic tiles
-                     // need to support either 32x16 or 32x32 chunks, and we do
-                     // not know enough about how the sprites are going to
-                     // leverage the video memory to know whether the remapped
-                     // tiles will be drawn with 32x16 or 32x32 pixel sprites.
-                     w32_h32_chunk_size / 4);
+
+            // NOTE: we always copy in 32x32 chunks. Our dynamic tiles need to
+            // support either 32x16 or 32x32 chunks, and we do not know enough
+            // about how the sprites are going to leverage the video memory to
+            // know whether the remapped tiles will be drawn with 32x16 or 32x32
+            // pixel sprites.
+            upload_sprite_frame(i * 2, offset);
+            upload_sprite_frame(i * 2 + 1, offset + 1);
 
             mapping.dirty_ = false;
         }
@@ -1064,10 +1143,15 @@ static ScreenBlock overlay_back_buffer alignas(u32);
 static bool overlay_back_buffer_changed = false;
 
 
+static void unpin_glyphs();
+
+
 void Platform::Screen::display()
 {
     // platform->stopwatch().start();
 
+    unpin_glyphs();
+
     if (overlay_back_buffer_changed) {
         overlay_back_buffer_changed = false;
 
@@ -1270,6 +1354,29 @@ static bool validate_tilemap_texture_size(Platform& pfrm, size_t size)
 }
 
 
+// The size of a texture's tile data, once loaded into vram.
+static u32 tile_data_size(const TextureData& info)
+{
+    if (info.compressed_) {
+        return *info.tile_data_ >> 8;
+    }
+    return info.tile_data_length_;
+}
+
+
+// Tile textures, which we always load in full, may be compressed. Decompressing
+// straight into vram takes less time than copying the same data uncompressed,
+// as cartridge reads are slow.
+static void load_tile_data(void* dest, const TextureData& info)
+{
+    if (info.compressed_) {
+        lz77_decompress_vram(dest, info.tile_data_);
+    } else {
+        memcpy16(dest, info.tile_data_, info.tile_data_length_ / 2);
+    }
+}
+
+
 static bool validate_overlay_texture_size(Platform& pfrm, size_t size)
 {
     constexpr auto charblock_size = sizeof(ScreenBlock) * 8;
@@ -1660,6 +1767,12 @@ std::optional<Platform::DynamicTexturePtr> Platform::make_dynamic_texture()
 }
 
 
+void Platform::prefetch_texture(const char* name)
+{
+    // Textures live in rom, there's nothing to decode in advance.
+}
+
+
 void Platform::load_sprite_texture(const char* name)
 {
     for (auto& mapping : dynamic_texture_mappings) {
@@ -1672,14 +1785,26 @@ void Platform::load_sprite_texture(const char* name)
 
             current_spritesheet = &info;
 
+            current_sprite_frames = nullptr;
+            for (auto& frames : sprite_frames) {
+                if (str_cmp(name, frames.name_) == 0) {
+                    current_sprite_frames = &frames;
+                }
+            }
+
             init_palette(current_spritesheet, sprite_palette, false);
 
+            // Upload the frames that aren't already in vram. We skip the
+            // frames reserved for dynamic textures, which we're about to
+            // remap anyway.
+            const u32 frame_count =
+                std::min(sprite_vram_frames,
+                         info.tile_data_length_ / sprite_frame_size);
 
-            // NOTE: There are four tile blocks, so index four points to the
-            // end of the tile memory.
-            memcpy16((void*)&MEM_TILE[4][1],
-                     info.tile_data_,
-                     std::min((u32)16128, info.tile_data_length_ / 2));
+            for (u32 i = Platform::dynamic_texture_count * 2; i < frame_count;
+                 ++i) {
+                upload_sprite_frame(i, i);
+            }
 
             // We need to do this, otherwise whatever screen fade is currently
             // active will be overwritten by the copy.
@@ -1719,10 +1844,8 @@ void Platform::load_tile0_texture(const char* name)
                 MEM_BG_PALETTE[i] = blend(from, c, last_fade_amt);
             }
 
-            if (validate_tilemap_texture_size(*this, info.tile_data_length_)) {
-                memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t0_texture][0],
-                         info.tile_data_,
-                         info.tile_data_length_ / 2);
+            if (validate_tilemap_texture_size(*this, tile_data_size(info))) {
+                load_tile_data((void*)&MEM_SCREENBLOCKS[sbb_t0_texture][0], info);
             } else {
                 StringBuffer<45> buf = "unable to load: ";
                 buf += name;
@@ -1756,10 +1879,8 @@ void Platform::load_tile1_texture(const char* name)
                 MEM_BG_PALETTE[32 + i] = blend(from, c, last_fade_amt);
             }
 
-            if (validate_tilemap_texture_size(*this, info.tile_data_length_)) {
-                memcpy16((void*)&MEM_SCREENBLOCKS[sbb_t1_texture][0],
-                         info.tile_data_,
-                         info.tile_data_length_ / 2);
+            if (validate_tilemap_texture_size(*this, tile_data_size(info))) {
+                load_tile_data((void*)&MEM_SCREENBLOCKS[sbb_t1_texture][0], info);
             } else {
                 StringBuffer<45> buf = "unable to load: ";
                 buf += name;
@@ -1829,9 +1950,9 @@ flash_byteverify(void* in_dst, const void* in_src, unsigned int length)
     for (; length > 0; length--) {
 
         if (*dst++ != *src++)
-            return true;
+            return false;
     }
-    return false;
+    return true;
 }
 
 
@@ -1846,8 +1967,23 @@ flash_bytecpy(void* in_dst, const void* in_src, unsigned int length, bool write)
             *(volatile u8*)0x0E005555 = 0xAA;
             *(volatile u8*)0x0E002AAA = 0x55;
             *(volatile u8*)0x0E005555 = 0xA0;
+
+            const auto value = *src++;
+            *(volatile u8*)dst = value;
+
+            // The chip ignores commands until it finishes programming the
+            // byte, and it reads back the byte's value once it's done. A byte
+            // takes tens of microseconds, give up if it takes much longer than
+            // that, flash_byteverify() will catch the failure.
+            for (int i = 0; i < 10000; ++i) {
+                if (*(volatile u8*)dst == value) {
+                    break;
+                }
+            }
+            ++dst;
+        } else {
+            *dst++ = *src++;
         }
-        *dst++ = *src++;
     }
 }
 
@@ -1862,15 +1998,6 @@ static void set_flash_bank(u32 bankID)
     }
 }
 
-// FIXME: Lets be nice to the flash an not write to the same memory
-// location every single time! What about a list? Each new save will
-// have a unique id. On startup, scan through memory until you reach
-// the highest unique id. Then start writing new saves at that
-// point. NOTE: My everdrive uses SRAM for Flash writes anyway, so
-// it's probably not going to wear out, but I like to pretend that I'm
-// developing a real gba game.
-
-
 COLD static bool flash_save(const void* data, u32 flash_offset, u32 length)
 {
     if ((u32)flash_offset >= 0x10000) {
@@ -1886,6 +2013,37 @@ COLD static bool flash_save(const void* data, u32 flash_offset, u32 length)
 }
 
 
+// Erases a 4kB sector, setting all of its bytes to 0xff. Flash can only clear
+// bits when writing, so we need to erase a sector before writing to it again.
+COLD static bool flash_erase_sector(u32 flash_offset)
+{
+    if (flash_offset >= 0x10000) {
+        set_flash_bank(1);
+    } else {
+        set_flash_bank(0);
+    }
+
+    auto sector = (volatile u8*)(cartridge_ram + (flash_offset & 0xf000));
+
+    *(volatile u8*)0x0E005555 = 0xAA;
+    *(volatile u8*)0x0E002AAA = 0x55;
+    *(volatile u8*)0x0E005555 = 0x80;
+    *(volatile u8*)0x0E005555 = 0xAA;
+    *(volatile u8*)0x0E002AAA = 0x55;
+    *sector = 0x30;
+
+    // The chip reports the erased value once it finishes. Erasing takes tens
+    // of milliseconds, give up if it takes much longer than that.
+    for (int i = 0; i < 1000000; ++i) {
+        if (*sector == 0xff) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
 static void flash_load(void* dest, u32 flash_offset, u32 length)
 {
     if (flash_offset >= 0x10000) {
@@ -1930,25 +2088,59 @@ void sram_load(void* dest, u32 offset, u32 length)
 }
 
 
+// The save journal sits at the beginning of cartridge ram, and the logger
+// writes to the space after it.
+class CartridgeSaveDevice : public SaveJournal::Device {
+public:
+    void read(u32 offset, void* dest, u32 length) override
+    {
+        if (get_gflag(GlobalFlag::save_using_flash)) {
+            flash_load(dest, offset, length);
+        } else {
+            sram_load(dest, offset, length);
+        }
+    }
+
+    bool write(u32 offset, const void* data, u32 length) override
+    {
+        if (get_gflag(GlobalFlag::save_using_flash)) {
+            return flash_save(data, offset, length);
+        } else {
+            sram_save(data, offset, length);
+            return true;
+        }
+    }
+
+    bool erase_sector(u32 sector) override
+    {
+        const u32 offset = sector * SaveJournal::sector_size;
+
+        if (get_gflag(GlobalFlag::save_using_flash)) {
+            return flash_erase_sector(offset);
+        } else {
+            static const u8 erased = 0xff;
+            for (u32 i = 0; i < SaveJournal::sector_size; ++i) {
+                sram_save(&erased, offset + i, 1);
+            }
+            return true;
+        }
+    }
+};
+
+
+static CartridgeSaveDevice save_device;
+static EWRAM_DATA SaveJournal save_journal(save_device);
+
+
 bool Platform::write_save_data(const void* data, u32 length, u32 offset)
 {
-    if (get_gflag(GlobalFlag::save_using_flash)) {
-        return flash_save(data, offset, length);
-    } else {
-        sram_save(data, offset, length);
-        return true;
-    }
+    return save_journal.write(data, length, offset);
 }
 
 
 bool Platform::read_save_data(void* buffer, u32 data_length, u32 offset)
 {
-    if (get_gflag(GlobalFlag::save_using_flash)) {
-        flash_load(buffer, offset, data_length);
-    } else {
-        sram_load(buffer, offset, data_length);
-    }
-    return true;
+    return save_journal.read(buffer, data_length, offset);
 }
 
 
@@ -1981,6 +2173,10 @@ static const u32 initial_log_write_loc = 16000;
 static u32 log_write_loc = initial_log_write_loc;
 
 
+static_assert(SaveJournal::sector_size * SaveJournal::sector_count <=
+              initial_log_write_loc);
+
+
 Platform::Logger::Logger()
 {
 }
@@ -2257,68 +2453,12 @@ Microseconds Platform::Speaker::track_length(const char* name)
 }
 
 
-namespace detail {
-template <std::size_t... Is> struct seq {
-};
-template <std::size_t N, std::size_t... Is>
-struct gen_seq : gen_seq<N - 1, N - 1, Is...> {
-};
-template <std::size_t... Is> struct gen_seq<0, Is...> : seq<Is...> {
-};
-
-
-template <class Generator, std::size_t... Is>
-constexpr auto generate_array_helper(Generator g, seq<Is...>)
-    -> std::array<decltype(g(std::size_t{}, sizeof...(Is))), sizeof...(Is)>
-{
-    return {{g(Is, sizeof...(Is))...}};
-}
-
-template <std::size_t tcount, class Generator>
-constexpr auto generate_array(Generator g)
-    -> decltype(generate_array_helper(g, gen_seq<tcount>{}))
-{
-    return generate_array_helper(g, gen_seq<tcount>{});
-}
-} // namespace detail
-
-
-auto make_volume_lut = [](float scale) {
-    return detail::generate_array<256>(
-        [scale](std::size_t curr, std::size_t total) -> s8 {
-            const auto real = (s8)((u8)curr);
-            return real * scale;
-        });
-};
-
-
-// Each table entry contains the whole number space of a signed 8-bit value,
-// scaled by a fraction.
-static constexpr std::array<VolumeScaleLUT, 20> volume_scale_LUTs = {
-    {{make_volume_lut(0.05f)}, {make_volume_lut(0.10f)},
-     {make_volume_lut(0.15f)}, {make_volume_lut(0.20f)},
-     {make_volume_lut(0.25f)}, {make_volume_lut(0.30f)},
-     {make_volume_lut(0.35f)}, {make_volume_lut(0.40f)},
-     {make_volume_lut(0.45f)}, {make_volume_lut(0.50f)},
-     {make_volume_lut(0.55f)}, {make_volume_lut(0.60f)},
-     {make_volume_lut(0.65f)}, {make_volume_lut(0.70f)},
-     {make_volume_lut(0.75f)}, {make_volume_lut(0.80f)},
-     {make_volume_lut(0.85f)}, {make_volume_lut(0.90f)},
-     {make_volume_lut(0.95f)}, {make_volume_lut(1.0f)}},
-};
-
-
-static const VolumeScaleLUT* get_volume_lut(Float volume)
-{
-    return &volume_scale_LUTs[volume * (volume_scale_LUTs.size() - 1)];
-}
-
-
+// The mixers scale sounds by volume / 16.
 static void
 set_sound_volume(ActiveSoundInfo& sound, Float left_volume, Float right_volume)
 {
-    sound.l_volume_lut_ = get_volume_lut(left_volume);
-    sound.r_volume_lut_ = get_volume_lut(right_volume);
+    sound.l_volume_ = left_volume * 16 + 0.5f;
+    sound.r_volume_ = right_volume * 16 + 0.5f;
 }
 
 
@@ -2329,8 +2469,8 @@ static std::optional<ActiveSoundInfo> make_sound(const char* name)
                                sound->length_,
                                sound->data_,
                                0,
-                               &volume_scale_LUTs[19],
-                               &volume_scale_LUTs[19]};
+                               16,
+                               16};
     } else {
         return {};
     }
@@ -2391,7 +2531,7 @@ void Platform::Speaker::set_position(const Vec2<Float>& position)
 }
 
 
-static void add_sound(Buffer<ActiveSoundInfo, 3>& sounds,
+static void add_sound(Buffer<ActiveSoundInfo, sound_voice_count>& sounds,
                       const ActiveSoundInfo& info)
 {
     if (not sounds.full()) {
@@ -2552,88 +2692,19 @@ Platform::Speaker::Speaker()
 #define REG_SGFIFOB *(volatile u32*)0x40000A4
 
 
-// NOTE: I tried to move this audio update interrupt handler to IWRAM, but the
-// sound output became sort of glitchy, and I noticed some tearing in the
-// display. At the same time, the game was less laggy, so maybe when I work out
-// the kinks, this function will eventually be moved to arm code instead of
-// thumb.
+// NOTE: The audio mixers live in gba_arm_routines.cpp, as arm code in IWRAM.
 //
-// NOTE: We play music at 16kHz, and we can load four samples upon each audio
-// interrupt, i.e. 4000 interrupts per second, i.e. approximately sixty-seven
+// NOTE: We play music at 16kHz, and we load eight samples upon each audio
+// interrupt, i.e. 2000 interrupts per second, i.e. approximately thirty-three
 // interrupts per frame (given sixty fps). Considering how many interrupts we're
-// dealing with here, this isr should be kept small and simple. We're only
-// supporting one music channel (which loops by default), and three concurrent
-// sound channels, in our audio mixer.
+// dealing with here, the isr should be kept small and simple. We're only
+// supporting one music channel (which loops by default), and sound_voice_count
+// concurrent sound channels, in our audio mixer.
 //
 // Considering the number of interrupts that we're dealing with here, one might
 // wonder why we aren't using one of the DMA channels to load sound samples. The
 // DMA halts the CPU, which could result in missed serial I/O interrupts during
 // multiplayer games.
-[[maybe_unused]] static void audio_update_spatialized_stereo_isr()
-{
-    alignas(4) AudioSample mixing_buffer_l[4];
-    alignas(4) AudioSample mixing_buffer_r[4];
-
-    // NOTE: audio tracks in ROM should therefore have four byte alignment!
-    *((u32*)mixing_buffer_l) =
-        ((u32*)(snd_ctx.music_track))[snd_ctx.music_track_pos++];
-
-    *((u32*)mixing_buffer_r) = *((u32*)mixing_buffer_l);
-
-    if (UNLIKELY(snd_ctx.music_track_pos > snd_ctx.music_track_length)) {
-        snd_ctx.music_track_pos = 0;
-    }
-
-    for (auto it = snd_ctx.active_sounds.begin();
-         it not_eq snd_ctx.active_sounds.end();) {
-        if (UNLIKELY(it->position_ + 4 >= it->length_)) {
-            it = snd_ctx.active_sounds.erase(it);
-        } else {
-            for (int i = 0; i < 4; ++i) {
-                mixing_buffer_r[i] +=
-                    (*it->r_volume_lut_)[(u8)it->data_[it->position_]];
-                mixing_buffer_l[i] +=
-                    (*it->l_volume_lut_)[(u8)it->data_[it->position_]];
-                ++it->position_;
-            }
-            ++it;
-        }
-    }
-
-    REG_SGFIFOA = *((u32*)mixing_buffer_r);
-    REG_SGFIFOB = *((u32*)mixing_buffer_l);
-}
-
-
-[[maybe_unused]] static void audio_update_spatialized_isr()
-{
-    alignas(4) AudioSample mixing_buffer[4];
-
-    // NOTE: audio tracks in ROM should therefore have four byte alignment!
-    *((u32*)mixing_buffer) =
-        ((u32*)(snd_ctx.music_track))[snd_ctx.music_track_pos++];
-
-    if (UNLIKELY(snd_ctx.music_track_pos > snd_ctx.music_track_length)) {
-        snd_ctx.music_track_pos = 0;
-    }
-
-    for (auto it = snd_ctx.active_sounds.begin();
-         it not_eq snd_ctx.active_sounds.end();) {
-        if (UNLIKELY(it->position_ + 4 >= it->length_)) {
-            it = snd_ctx.active_sounds.erase(it);
-        } else {
-            for (int i = 0; i < 4; ++i) {
-                mixing_buffer[i] +=
-                    (*it->r_volume_lut_)[(u8)it->data_[it->position_]];
-                ++it->position_;
-            }
-            ++it;
-        }
-    }
-
-    REG_SGFIFOA = *((u32*)mixing_buffer);
-    // REG_SGFIFOB = *((u32*)mixing_buffer);
-}
 
 
 // Simpler mixer, without stereo sound or volume modulation, for multiplayer
@@ -2801,9 +2872,10 @@ struct GlyphMapping {
     u16 mapper_offset_;
 
     // -1 represents unassigned. Mapping a tile into memory sets the reference
-    //  count to zero. When a call to Platform::set_tile reduces the reference
-    //  count back to zero, the tile is once again considered to be unassigned,
-    //  and will be set to -1.
+    //  count to zero. Calls to Platform::set_tile adjust the reference count as
+    //  text appears and disappears. A tile with a reference count of zero
+    //  still holds the glyph, in case we need it again, until we need the tile
+    //  for a different glyph.
     s16 reference_count_ = -1;
 
     bool valid() const
@@ -2826,24 +2898,249 @@ static int glyph_table_size = glyph_mapping_count;
 static const int font_color_index_tile = 81;
 
 
-struct GlyphTable {
-    GlyphMapping mappings_[glyph_mapping_count + glyph_expanded_count];
+// Maps glyphs to tiles. A hash index, chained through the hash_next_ array,
+// looks up the tile holding a glyph by mapper offset. Tiles that do not hold a
+// glyph belong to a free list, and tiles holding glyphs that no longer appear
+// onscreen belong to a list ordered by when they fell out of use, so that we
+// recycle the least recently used glyph when we run out of free tiles. A
+// glyph that we just mapped has no references until the caller writes it to
+// the overlay, and the caller may map several glyphs before writing any of
+// them, so mapped glyphs stay pinned on a pending list until the end of the
+// frame. The free, lru, and pending lists share the list_prev_ and list_next_
+// arrays, as a tile belongs to at most one of them at a time.
+class GlyphTable {
+public:
+    using Index = u8;
+
+    static constexpr const int capacity =
+        glyph_mapping_count + glyph_expanded_count;
+
+    static constexpr const Index null = 255;
+
+    static_assert(capacity < null);
+
+    GlyphTable()
+    {
+        reset();
+    }
+
+    // Forget all of the glyphs. The tiles available for glyphs depend on the
+    // glyph table size.
+    void reset()
+    {
+        for (auto& gm : mappings_) {
+            gm.reference_count_ = -1;
+        }
+
+        for (auto& b : buckets_) {
+            b = null;
+        }
+
+        free_ = {null, null};
+        lru_ = {null, null};
+        pending_ = {null, null};
+
+        for (auto& p : pinned_) {
+            p = false;
+        }
+
+        for (int i = 0; i < glyph_table_size; ++i) {
+            if (i == font_color_index_tile - glyph_start_offset) {
+                // When I originally created the text mapping engine, I did not
+                // expect to need to deal with languages with more than 80
+                // distinct font tiles onscreen at a time. So, I thought it
+                // would be fine to put a metadata tile in index 81. But while
+                // working on the Chinese localization, I discovered that 80
+                // tiles would not be nearly sufficient to display a fullscreen
+                // block of chinese words. So I needed to build a
+                // dynamically-expandable glyph table, which, when needed, can
+                // expand to consume more of the available vram. So, we need to
+                // skip over this metadata tile, to make sure that we don't
+                // overwrite it when using a larger glyph array.
+                continue;
+            }
+            push_back(free_, i);
+        }
+    }
+
+    GlyphMapping& operator[](int index)
+    {
+        return mappings_[index];
+    }
+
+    // Returns null if no tile holds the glyph. Pins an unreferenced glyph,
+    // as the caller's about to reference it.
+    Index find(u16 mapper_offset)
+    {
+        for (auto i = buckets_[bucket(mapper_offset)]; i not_eq null;
+             i = hash_next_[i]) {
+            if (mappings_[i].mapper_offset_ == mapper_offset) {
+                if (mappings_[i].reference_count_ == 0 and not pinned_[i]) {
+                    unlink(lru_, i);
+                    pin(i);
+                }
+                return i;
+            }
+        }
+        return null;
+    }
+
+    // Assigns a pinned tile to a glyph, with a reference count of zero.
+    // Returns null if all of the tiles hold glyphs that are in use or pinned.
+    Index assign(u16 mapper_offset)
+    {
+        Index i = free_.first_;
+
+        if (i not_eq null) {
+            unlink(free_, i);
+        } else if ((i = lru_.first_) not_eq null) {
+            unlink(lru_, i);
+            unhash(i);
+        } else {
+            return null;
+        }
+
+        auto& gm = mappings_[i];
+        gm.mapper_offset_ = mapper_offset;
+        gm.reference_count_ = 0;
+
+        auto& b = buckets_[bucket(mapper_offset)];
+        hash_next_[i] = b;
+        b = i;
+
+        // Nothing references the glyph yet, but the caller's about to.
+        pin(i);
+
+        return i;
+    }
+
+    void acquire(Index i)
+    {
+        if (mappings_[i].reference_count_++ == 0) {
+            if (pinned_[i]) {
+                unlink(pending_, i);
+                pinned_[i] = false;
+            } else {
+                unlink(lru_, i);
+            }
+        }
+    }
+
+    void release(Index i)
+    {
+        if (--mappings_[i].reference_count_ == 0) {
+            push_back(lru_, i);
+        }
+    }
+
+    // Mapped glyphs that nothing referenced by the end of the frame become
+    // eligible for reuse.
+    void unpin()
+    {
+        while (pending_.first_ not_eq null) {
+            const auto i = pending_.first_;
+            unlink(pending_, i);
+            pinned_[i] = false;
+            push_back(lru_, i);
+        }
+    }
+
+private:
+    struct List {
+        Index first_;
+        Index last_;
+    };
+
+    static constexpr const int bucket_count = 64;
+
+    static int bucket(u16 mapper_offset)
+    {
+        return mapper_offset % bucket_count;
+    }
+
+    void push_back(List& list, Index i)
+    {
+        list_prev_[i] = list.last_;
+        list_next_[i] = null;
+
+        if (list.last_ not_eq null) {
+            list_next_[list.last_] = i;
+        } else {
+            list.first_ = i;
+        }
+        list.last_ = i;
+    }
+
+    void unlink(List& list, Index i)
+    {
+        const auto prev = list_prev_[i];
+        const auto next = list_next_[i];
+
+        if (prev not_eq null) {
+            list_next_[prev] = next;
+        } else {
+            list.first_ = next;
+        }
+
+        if (next not_eq null) {
+            list_prev_[next] = prev;
+        } else {
+            list.last_ = prev;
+        }
+    }
+
+    void pin(Index i)
+    {
+        push_back(pending_, i);
+        pinned_[i] = true;
+    }
+
+    void unhash(Index i)
+    {
+        for (auto* link = &buckets_[bucket(mappings_[i].mapper_offset_)];
+             *link not_eq null;
+             link = &hash_next_[*link]) {
+            if (*link == i) {
+                *link = hash_next_[i];
+                return;
+            }
+        }
+    }
+
+    GlyphMapping mappings_[capacity];
+
+    Index buckets_[bucket_count];
+    Index hash_next_[capacity];
+    Index list_prev_[capacity];
+    Index list_next_[capacity];
+
+    bool pinned_[capacity];
+
+    List free_;
+    List lru_;
+    List pending_;
 };
 
 static std::optional<DynamicMemory<GlyphTable>> glyph_table;
 
 
-void Platform::enable_expanded_glyph_mode(bool enabled)
+static void unpin_glyphs()
 {
-    for (auto& gm : ::glyph_table->obj_->mappings_) {
-        gm.reference_count_ = -1;
+    if (glyph_table) {
+        glyph_table->obj_->unpin();
     }
+}
+
 
+void Platform::enable_expanded_glyph_mode(bool enabled)
+{
     if (enabled) {
         glyph_table_size = glyph_mapping_count + glyph_expanded_count;
     } else {
         glyph_table_size = glyph_mapping_count;
     }
+
+    ::glyph_table->obj_->reset();
 }
 
 
@@ -3079,9 +3376,7 @@ Platform::Platform()
 void Platform::enable_glyph_mode(bool enabled)
 {
     if (enabled) {
-        for (auto& gm : ::glyph_table->obj_->mappings_) {
-            gm.reference_count_ = -1;
-        }
+        ::glyph_table->obj_->reset();
     }
     set_gflag(GlobalFlag::glyph_mode, enabled);
 }
@@ -3171,9 +3466,7 @@ bool Platform::load_overlay_texture(const char* name)
             }
 
             if (get_gflag(GlobalFlag::glyph_mode)) {
-                for (auto& gm : ::glyph_table->obj_->mappings_) {
-                    gm.reference_count_ = -1;
-                }
+                ::glyph_table->obj_->reset();
             }
 
             if (str_cmp(name, "overlay") == 0) {
@@ -3221,10 +3514,30 @@ static FontColorIndices font_color_indices()
 }
 
 
-// This code uses a lot of naive algorithms for searching the glyph mapping
-// table, potentially could be sped up, but we don't want to use any extra
-// memory, we've only got 256K to work with, and the table is big enough as it
-// is.
+// Resolves the texture that a glyph mapper refers to. Mappers pass the same
+// string constants every time, so we remember the last result, and only
+// compare names when a mapper hands us a different string.
+static const TextureData* glyph_texture(const char* name)
+{
+    static const char* last_name;
+    static const TextureData* last_texture;
+
+    if (name == last_name) {
+        return last_texture;
+    }
+
+    for (auto& info : overlay_textures) {
+        if (str_cmp(name, info.name_) == 0) {
+            last_name = name;
+            last_texture = &info;
+            return &info;
+        }
+    }
+
+    return nullptr;
+}
+
+
 TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
                              const TextureMapping& mapping_info)
 {
@@ -3238,95 +3551,73 @@ TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
     //     return bad_glyph;
     // }
 
-    for (TileDesc tile = 0; tile < glyph_table_size; ++tile) {
-        auto& gm = ::glyph_table->obj_->mappings_[tile];
-        if (gm.valid() and gm.mapper_offset_ == mapping_info.offset_) {
-            return glyph_start_offset + tile;
-        }
+    auto& table = *::glyph_table->obj_;
+
+    const auto found = table.find(mapping_info.offset_);
+    if (found not_eq GlyphTable::null) {
+        return glyph_start_offset + found;
     }
 
-    for (auto& info : overlay_textures) {
-        if (str_cmp(mapping_info.texture_name_, info.name_) == 0) {
-            for (TileDesc t = 0; t < glyph_table_size; ++t) {
-
-                if (t == font_color_index_tile - 1) {
-                    // When I originally created the text mapping engine, I did
-                    // not expect to need to deal with languages with more than
-                    // 80 distinct font tiles onscreen at a time. So, I thought
-                    // it would be fine to put a metadata tile in index 81. But
-                    // while working on the Chinese localization, I discovered
-                    // that 80 tiles would not be nearly sufficient to display a
-                    // fullscreen block of chinese words. So I needed to build a
-                    // dynamically-expandable glyph table, which, when needed,
-                    // can expand to consume more of the available vram. So, we
-                    // need to skip over this metadata tile, to make sure that
-                    // we don't overwrite it when using a larger glyph array.
-                    continue;
-                }
+    const auto info = glyph_texture(mapping_info.texture_name_);
+    if (not info) {
+        return bad_glyph;
+    }
 
-                auto& gm = ::glyph_table->obj_->mappings_[t];
-                if (not gm.valid()) {
-                    gm.mapper_offset_ = mapping_info.offset_;
-                    gm.reference_count_ = 0;
-
-                    // 8 x 8 x (4 bitsperpixel / 8 bitsperbyte)
-                    constexpr int tile_size = vram_tile_size();
-
-                    // u8 buffer[tile_size] = {0};
-                    // memcpy16(buffer,
-                    //          (u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
-                    //              ((81) * tile_size),
-                    //          tile_size / 2);
-
-                    const auto colors = font_color_indices();
-
-                    // We need to know which color to use as the background
-                    // color, and which color to use as the foreground
-                    // color. Each charset needs to store a reference pixel in
-                    // the top left corner, representing the background color,
-                    // otherwise, we have no way of knowing which pixel color to
-                    // substitute where!
-                    const auto bg_color = ((u8*)info.tile_data_)[0] & 0x0f;
-
-                    u8 buffer[tile_size] = {0};
-                    memcpy16(buffer,
-                             info.tile_data_ +
-                                 ((u32)mapping_info.offset_ * tile_size) /
-                                     sizeof(decltype(info.tile_data_)),
-                             tile_size / 2);
-
-                    for (int i = 0; i < tile_size; ++i) {
-                        auto c = buffer[i];
-                        if (c & bg_color) {
-                            buffer[i] = colors.bg_;
-                        } else {
-                            buffer[i] = colors.fg_;
-                        }
-                        if (c & (bg_color << 4)) {
-                            buffer[i] |= colors.bg_ << 4;
-                        } else {
-                            buffer[i] |= colors.fg_ << 4;
-                        }
-                    }
+    const auto t = table.assign(mapping_info.offset_);
+    if (t == GlyphTable::null) {
+        return bad_glyph;
+    }
 
-                    // FIXME: Why do these magic constants work? I wish better
-                    // documentation existed for how the gba tile memory worked.
-                    // I thought, that the tile size would be 32, because we
-                    // have 4 bits per pixel, and 8x8 pixel tiles. But the
-                    // actual number of bytes in a tile seems to be half of the
-                    // expected number. Also, in vram, it seems like the tiles
-                    // do seem to be 32 bytes apart after all...
-                    memcpy16((u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
-                                 ((t + glyph_start_offset) * tile_size),
-                             buffer,
-                             tile_size / 2);
-
-                    return t + glyph_start_offset;
-                }
-            }
+    // 8 x 8 x (4 bitsperpixel / 8 bitsperbyte)
+    constexpr int tile_size = vram_tile_size();
+
+    // u8 buffer[tile_size] = {0};
+    // memcpy16(buffer,
+    //          (u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
+    //              ((81) * tile_size),
+    //          tile_size / 2);
+
+    const auto colors = font_color_indices();
+
+    // We need to know which color to use as the background color, and which
+    // color to use as the foreground color. Each charset needs to store a
+    // reference pixel in the top left corner, representing the background
+    // color, otherwise, we have no way of knowing which pixel color to
+    // substitute where!
+    const auto bg_color = ((u8*)info->tile_data_)[0] & 0x0f;
+
+    u8 buffer[tile_size] = {0};
+    memcpy16(buffer,
+             info->tile_data_ + ((u32)mapping_info.offset_ * tile_size) /
+                                    sizeof(decltype(info->tile_data_)),
+             tile_size / 2);
+
+    for (int i = 0; i < tile_size; ++i) {
+        auto c = buffer[i];
+        if (c & bg_color) {
+            buffer[i] = colors.bg_;
+        } else {
+            buffer[i] = colors.fg_;
+        }
+        if (c & (bg_color << 4)) {
+            buffer[i] |= colors.bg_ << 4;
+        } else {
+            buffer[i] |= colors.fg_ << 4;
         }
     }
-    return bad_glyph;
+
+    // FIXME: Why do these magic constants work? I wish better documentation
+    // existed for how the gba tile memory worked. I thought, that the tile
+    // size would be 32, because we have 4 bits per pixel, and 8x8 pixel
+    // tiles. But the actual number of bytes in a tile seems to be half of the
+    // expected number. Also, in vram, it seems like the tiles do seem to be 32
+    // bytes apart after all...
+    memcpy16((u8*)&MEM_SCREENBLOCKS[sbb_overlay_texture][0] +
+                 ((t + glyph_start_offset) * tile_size),
+             buffer,
+             tile_size / 2);
+
+    return t + glyph_start_offset;
 }
 
 
@@ -3356,9 +3647,7 @@ void Platform::fill_overlay(u16 tile)
     }
 
     if (get_gflag(GlobalFlag::glyph_mode)) {
-        for (auto& gm : ::glyph_table->obj_->mappings_) {
-            gm.reference_count_ = -1;
-        }
+        ::glyph_table->obj_->reset();
     }
 }
 
@@ -3374,16 +3663,12 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
 
         const auto old_tile = pfrm.get_tile(Layer::overlay, x, y);
         if (old_tile not_eq val) {
+            auto& table = *::glyph_table->obj_;
+
             if (is_glyph(old_tile)) {
-                auto& gm = ::glyph_table->obj_
-                               ->mappings_[old_tile - glyph_start_offset];
-                if (gm.valid()) {
-                    gm.reference_count_ -= 1;
-
-                    if (gm.reference_count_ == 0) {
-                        gm.reference_count_ = -1;
-                        gm.mapper_offset_ = 0;
-                    }
+                const auto i = old_tile - glyph_start_offset;
+                if (table[i].reference_count_ > 0) {
+                    table.release(i);
                 } else {
                     error(pfrm,
                           "existing tile is a glyph, but has no"
@@ -3392,9 +3677,8 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
             }
 
             if (is_glyph(val)) {
-                auto& gm =
-                    ::glyph_table->obj_->mappings_[val - glyph_start_offset];
-                if (not gm.valid()) {
+                const auto i = val - glyph_start_offset;
+                if (not table[i].valid()) {
                     // Not clear exactly what to do here... Somehow we've
                     // gotten into an erroneous state, but not a permanently
                     // unrecoverable state (tile isn't valid, so it'll be
@@ -3402,7 +3686,7 @@ static void set_overlay_tile(Platform& pfrm, u16 x, u16 y, u16 val, int palette)
                     warning(pfrm, "invalid assignment to glyph table");
                     return;
                 }
-                gm.reference_count_++;
+                table.acquire(i);
             }
         }
     }
@@ -4054,6 +4338,33 @@ MASTER_RETRY:
 }
 
 
+static std::optional<Platform::NetworkPeer::ConnectionCallback>
+    connection_callback;
+
+
+// Whether the game last heard that we're connected, see update().
+static bool reported_connected = false;
+
+
+void Platform::NetworkPeer::on_connection_change(ConnectionCallback callback)
+{
+    ::connection_callback.emplace(callback);
+}
+
+
+// NOTE: multiplayer_init() blocks until the connection either succeeds or times
+// out, so we can report the result right away.
+static void report_connection_result()
+{
+    reported_connected = ::platform->network_peer().is_connected();
+
+    if (::connection_callback) {
+        (*::connection_callback)(*::platform,
+                                 ::platform->network_peer().is_connected());
+    }
+}
+
+
 void Platform::NetworkPeer::connect(const char* peer)
 {
     // If the gameboy player is active, any multiplayer initialization would
@@ -4064,6 +4375,7 @@ void Platform::NetworkPeer::connect(const char* peer)
     }
 
     multiplayer_init();
+    report_connection_result();
 }
 
 
@@ -4074,15 +4386,28 @@ void Platform::NetworkPeer::listen()
     }
 
     multiplayer_init();
+    report_connection_result();
 }
 
 
 void Platform::NetworkPeer::update()
 {
+    // The serial isr disconnects when the link drops, so we notice after the
+    // fact, and let the game know from here, outside of interrupt context.
+    if (reported_connected and not is_connected()) {
+        reported_connected = false;
+
+        if (::connection_callback) {
+            (*::connection_callback)(*::platform, false);
+        }
+    }
 }
 
 
-static int last_tx_count = 0;
+// The isrs only ever increment the counters in multiplayer_comms. Rather than
+// clearing them (racing with the isrs), we report the difference since the last
+// call.
+static Platform::NetworkPeer::Stats last_stats;
 
 
 Platform::NetworkPeer::Stats Platform::NetworkPeer::stats()
@@ -4092,21 +4417,29 @@ Platform::NetworkPeer::Stats Platform::NetworkPeer::stats()
     const int empty_transmits = mc.null_bytes_written / max_message_size;
     mc.null_bytes_written = 0;
 
+    const Stats totals{mc.tx_message_count,
+                       mc.rx_message_count,
+                       mc.tx_loss,
+                       mc.rx_loss,
+                       0};
+
+    const int tx_diff = totals.transmit_count_ - last_stats.transmit_count_;
+
     Float link_saturation = 0.f;
 
     if (empty_transmits) {
-        auto tx_diff = mc.tx_message_count - last_tx_count;
-
         link_saturation = Float(tx_diff) / (empty_transmits + tx_diff);
     }
 
-    last_tx_count = mc.tx_message_count;
+    const Stats result{tx_diff,
+                       totals.receive_count_ - last_stats.receive_count_,
+                       totals.transmit_loss_ - last_stats.transmit_loss_,
+                       totals.receive_loss_ - last_stats.receive_loss_,
+                       static_cast<int>(100 * link_saturation)};
 
-    return {mc.tx_message_count,
-            mc.rx_message_count,
-            mc.tx_loss,
-            mc.rx_loss,
-            static_cast<int>(100 * link_saturation)};
+    last_stats = totals;
+
+    return result;
 }
 
 
@@ -4,9 +4,6 @@
 #include "memory/buffer.hpp"
 
 
-using VolumeScaleLUT = std::array<s8, 256>;
-
-
 using AudioSample = s8;
 
 
@@ -15,14 +12,24 @@ struct ActiveSoundInfo {
     const s32 length_;
     const AudioSample* data_;
     s32 priority_;
-    const VolumeScaleLUT* l_volume_lut_;
-    const VolumeScaleLUT* r_volume_lut_;
+
+    // Zero through sixteen, i.e. sixteenths of full volume. Only the
+    // spatialized mixers apply volume.
+    u8 l_volume_;
+    u8 r_volume_;
 };
 
 
+// Sound mixing's expensive! The mixers add four samples at a time, which
+// brings a voice down to roughly sixty cycles per interrupt, from a bit over a
+// hundred with per-byte adds. So six voices cost about what three used to. Each
+// mixer adds its cycles to audio_isr_tics, check the profiler's audio isr
+// marker on hardware before raising this any further.
+static constexpr int sound_voice_count = 6;
+
+
 struct SoundContext {
-    // Only three sounds will play at a time... hey, sound mixing's expensive!
-    Buffer<ActiveSoundInfo, 3> active_sounds;
+    Buffer<ActiveSoundInfo, sound_voice_count> active_sounds;
 
     const AudioSample* music_track = nullptr;
     s32 music_track_length = 0;
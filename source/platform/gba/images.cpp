@@ -122,13 +122,24 @@ struct TextureData {
     const unsigned short* palette_data_;
     u32 tile_data_length_;
     u32 palette_data_length_;
+
+    // Set for tile data in the BIOS LZ77 format (grit -Zlz77), in which case,
+    // tile_data_length_ is the compressed size.
+    bool compressed_;
 };
 
 
 #define STR(X) #X
 #define TEXTURE_INFO(NAME)                                                     \
     {                                                                          \
-        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen        \
+        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen,       \
+            false                                                              \
+    }
+
+
+#define TEXTURE_INFO_LZ77(NAME)                                                \
+    {                                                                          \
+        STR(NAME), NAME##Tiles, NAME##Pal, NAME##TilesLen, NAME##PalLen, true  \
     }
 
 
@@ -167,33 +178,33 @@ static const TextureData sprite_textures[] = {
 
 static const TextureData tile_textures[] = {
 
-    TEXTURE_INFO(title_1_flattened),
+    TEXTURE_INFO_LZ77(title_1_flattened),
 //;
-    TEXTURE_INFO(title_2_flattened),
+    TEXTURE_INFO_LZ77(title_2_flattened),
 //;
-    TEXTURE_INFO(ending_scene_flattened),
+    TEXTURE_INFO_LZ77(ending_scene_flattened),
 //;
-    TEXTURE_INFO(ending_scene_2_flattened),
+    TEXTURE_INFO_LZ77(ending_scene_2_flattened),
 //;
-    TEXTURE_INFO(launch_flattened),
+    TEXTURE_INFO_LZ77(launch_flattened),
 //;
-    TEXTURE_INFO(tilesheet_intro_cutscene_flattened),
+    TEXTURE_INFO_LZ77(tilesheet_intro_cutscene_flattened),
 //;
-    TEXTURE_INFO(tilesheet),
+    TEXTURE_INFO_LZ77(tilesheet),
 //;
-    TEXTURE_INFO(tilesheet2),
+    TEXTURE_INFO_LZ77(tilesheet2),
 //;
-    TEXTURE_INFO(tilesheet3),
+    TEXTURE_INFO_LZ77(tilesheet3),
 //;
-    TEXTURE_INFO(tilesheet4),
+    TEXTURE_INFO_LZ77(tilesheet4),
 //;
-    TEXTURE_INFO(tilesheet_top),
+    TEXTURE_INFO_LZ77(tilesheet_top),
 //;
-    TEXTURE_INFO(tilesheet2_top),
+    TEXTURE_INFO_LZ77(tilesheet2_top),
 //;
-    TEXTURE_INFO(tilesheet3_top),
+    TEXTURE_INFO_LZ77(tilesheet3_top),
 //;
-    TEXTURE_INFO(tilesheet4_top),
+    TEXTURE_INFO_LZ77(tilesheet4_top),
 //
 };
 
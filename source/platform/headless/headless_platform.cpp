@@ -0,0 +1,1447 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Headless Platform
+//
+// A platform implementation with no window, no audio, and no network
+// connection, for benchmarking the game logic. Rather than calling start(), the
+// headless build drives Game::update() and Game::render() itself, with a fixed
+// timestep, a fixed rng seed, and scripted input, so that two runs with the
+// same arguments do exactly the same work. At the end of the run, the harness
+// prints per-frame timing percentiles for level generation, the overworld
+// update, collision checking, and rendering.
+//
+// With --loopback, the harness forks a second instance of the game, and
+// connects the two via a simulated network link, for soak testing multiplayer.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "blind_jump/game.hpp"
+#include "globals.hpp"
+#include "number/random.hpp"
+#include "platform/desktop/job_system.hpp"
+#include "platform/platform.hpp"
+#include "profiler.hpp"
+#include "replay.hpp"
+#include "saveJournal.hpp"
+#include "script/lisp.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <popl/popl.hpp>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+
+Platform::DeviceName Platform::device_name() const
+{
+    return "Headless";
+}
+
+
+static constexpr Vec2<u32> screen_size{240, 160};
+
+
+// The harness writes the scripted input here, and Keyboard::poll() copies it
+// into the keyboard state.
+static std::array<bool, int(Key::count)> scripted_keys;
+
+
+static std::string resource_root = "./";
+
+
+static Platform* platform = nullptr;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DeltaClock
+////////////////////////////////////////////////////////////////////////////////
+
+
+Platform::DeltaClock::DeltaClock() : impl_(nullptr)
+{
+}
+
+
+Microseconds Platform::DeltaClock::reset()
+{
+    // NOTE: Always return the same timestep, regardless of how long the frame
+    // actually took. Otherwise, the benchmark would not be reproducible.
+    return replay::delta(1000000 / 60);
+}
+
+
+static const auto delta_clock_epoch = std::chrono::steady_clock::now();
+
+
+Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - delta_clock_epoch);
+
+    return static_cast<TimePoint>(static_cast<u32>(elapsed.count()));
+}
+
+
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    return static_cast<u32>(t2) - static_cast<u32>(t1);
+}
+
+
+Platform::DeltaClock::~DeltaClock()
+{
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Keyboard
+////////////////////////////////////////////////////////////////////////////////
+
+
+void Platform::Keyboard::rumble(bool enabled)
+{
+}
+
+
+void Platform::Keyboard::register_controller(const ControllerInfo& info)
+{
+}
+
+
+void Platform::Keyboard::poll()
+{
+    for (size_t i = 0; i < size_t(Key::count); ++i) {
+        prev_[i] = states_[i];
+        states_[i] = scripted_keys[i];
+    }
+
+    replay::filter_input(*::platform, states_);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Screen
+////////////////////////////////////////////////////////////////////////////////
+
+
+static std::vector<Platform::Task*> task_queue;
+
+
+Platform::Screen::Screen() : userdata_(nullptr)
+{
+}
+
+
+void Platform::Screen::enable_night_mode(bool)
+{
+}
+
+
+Vec2<u32> Platform::Screen::size() const
+{
+    return screen_size;
+}
+
+
+static Contrast contrast = 0;
+
+
+void Platform::Screen::set_contrast(Contrast c)
+{
+    ::contrast = c;
+}
+
+
+Contrast Platform::Screen::get_contrast() const
+{
+    return ::contrast;
+}
+
+
+void Platform::Screen::clear()
+{
+    for (auto it = task_queue.begin(); it not_eq task_queue.end();) {
+        (*it)->run();
+        if ((*it)->complete()) {
+            (*it)->running_ = false;
+            it = task_queue.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+
+void Platform::Screen::display()
+{
+}
+
+
+void Platform::Screen::fade(Float amount,
+                            ColorConstant k,
+                            std::optional<ColorConstant> base,
+                            bool include_sprites,
+                            bool include_overlay)
+{
+}
+
+
+void Platform::Screen::pixelate(u8 amount,
+                                bool include_overlay,
+                                bool include_background,
+                                bool include_sprites)
+{
+}
+
+
+// NOTE: We still want to pay for the draw calls, roughly in the way that a real
+// platform would, so that render timings mean something. But we have nowhere
+// to send the sprites, so just count them.
+static int sprite_draw_count;
+
+
+void Platform::Screen::draw(const Sprite& spr)
+{
+    if (spr.get_alpha() not_eq Sprite::Alpha::transparent) {
+        ++sprite_draw_count;
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// DynamicTexture
+////////////////////////////////////////////////////////////////////////////////
+
+
+static ObjectPool<RcBase<Platform::DynamicTexture,
+                         Platform::dynamic_texture_count>::ControlBlock,
+                  Platform::dynamic_texture_count>
+    dynamic_texture_pool;
+
+
+void Platform::DynamicTexture::remap(u16 spritesheet_offset)
+{
+}
+
+
+std::optional<Platform::DynamicTexturePtr> Platform::make_dynamic_texture()
+{
+    auto finalizer =
+        [](RcBase<Platform::DynamicTexture,
+                  Platform::dynamic_texture_count>::ControlBlock* ctrl) {
+            dynamic_texture_pool.post(ctrl);
+        };
+
+    auto dt = DynamicTexturePtr::create(&dynamic_texture_pool, finalizer, 0);
+    if (dt) {
+        return *dt;
+    }
+
+    warning(*this, "Failed to allocate DynamicTexture.");
+    return {};
+}
+
+
+void Platform::push_task(Task* task)
+{
+    task->complete_ = false;
+    task->running_ = true;
+
+    task_queue.push_back(task);
+}
+
+
+// Shares the desktop build's job system. Created in main(), after any fork, so
+// that each loopback instance gets its own worker threads.
+static std::optional<JobSystem> jobs;
+
+
+void Platform::parallel_for(u32 count, ParallelFn fn, void* context)
+{
+    if (jobs) {
+        jobs->run(count, fn, context);
+    } else {
+        for (u32 i = 0; i < count; ++i) {
+            fn(context, i);
+        }
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Speaker
+////////////////////////////////////////////////////////////////////////////////
+
+
+static std::string current_music;
+
+
+Platform::Speaker::Speaker()
+{
+}
+
+
+void Platform::Speaker::set_position(const Vec2<Float>& position)
+{
+}
+
+
+void Platform::Speaker::play_note(Note n, Octave o, Channel c)
+{
+}
+
+
+void Platform::Speaker::play_music(const char* name, Microseconds offset)
+{
+    ::current_music = name;
+}
+
+
+void Platform::Speaker::stop_music()
+{
+    ::current_music.clear();
+}
+
+
+bool Platform::Speaker::is_music_playing(const char* name)
+{
+    return ::current_music == name;
+}
+
+
+void Platform::Speaker::play_sound(const char* name,
+                                   int priority,
+                                   std::optional<Vec2<Float>> position)
+{
+}
+
+
+bool Platform::Speaker::is_sound_playing(const char* name)
+{
+    return false;
+}
+
+
+Microseconds Platform::Speaker::track_length(const char* name)
+{
+    return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// RemoteConsole
+////////////////////////////////////////////////////////////////////////////////
+
+
+auto Platform::RemoteConsole::readline() -> std::optional<Line>
+{
+    return {};
+}
+
+
+bool Platform::RemoteConsole::printline(const char* text, bool show_prompt)
+{
+    std::cerr << text;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Logger
+////////////////////////////////////////////////////////////////////////////////
+
+
+static Severity log_threshold = Severity::warning;
+
+
+Platform::Logger::Logger()
+{
+}
+
+
+void Platform::Logger::set_threshold(Severity severity)
+{
+    // NOTE: The game restores the log threshold from the save data, but we
+    // want the benchmark's output to stay readable. Only ever raise the
+    // threshold.
+    if (static_cast<int>(severity) > static_cast<int>(::log_threshold)) {
+        ::log_threshold = severity;
+    }
+}
+
+
+void Platform::Logger::log(Severity level, const char* msg)
+{
+    if (static_cast<int>(level) < static_cast<int>(::log_threshold)) {
+        return;
+    }
+
+    std::cerr << '[' << (level == Severity::error ? "error" : "warning")
+              << "] " << msg << '\n';
+}
+
+
+void Platform::Logger::read(void* buffer, u32 start_offset, u32 num_bytes)
+{
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Loopback link
+//
+// For multiplayer soak tests, the harness can fork a second game instance,
+// connected to the first over a socket pair. Each side simulates its own
+// outgoing link (latency, jitter, bandwidth, loss), and stamps each message
+// with the time at which the other side should receive it. At the end of each
+// frame, the two processes swap the messages that they sent during the frame,
+// so both instances advance in lockstep with the fixed timestep, and a run
+// with the same arguments always delivers the same messages on the same
+// frames.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+
+
+struct LinkConfig {
+    Microseconds latency_ = 0;
+    Microseconds jitter_ = 0;
+    u32 bandwidth_ = 0; // bytes per second, zero for unlimited
+    u32 loss_ = 0;      // per ten thousand messages
+};
+
+
+class LoopbackLink {
+public:
+    LoopbackLink(int fd, bool host, const LinkConfig& config, u32 seed)
+        : fd_(fd), host_(host), config_(config), rng_(seed)
+    {
+    }
+
+    bool is_host() const
+    {
+        return host_;
+    }
+
+    bool is_connected() const
+    {
+        return connected_;
+    }
+
+    void connect()
+    {
+        connected_ = true;
+    }
+
+    void disconnect()
+    {
+        connected_ = false;
+    }
+
+    bool send(const byte* data, u32 length)
+    {
+        if (not connected_) {
+            return false;
+        }
+
+        ++stats_.transmit_count_;
+
+        // Like a real link, the send queue has a limited capacity. But we
+        // cannot report failure, as net_event::transmit() would spin forever
+        // waiting for space: the link only drains between frames, when we
+        // exchange messages with the other process. Count it as a loss.
+        if (link_free_at_ > clock_ + seconds(1)) {
+            ++stats_.transmit_loss_;
+            ++total_lost_;
+            return true;
+        }
+
+        link_free_at_ = std::max(link_free_at_, clock_);
+        if (config_.bandwidth_) {
+            link_free_at_ += u64(length) * seconds(1) / config_.bandwidth_;
+        }
+        bytes_sent_ += length;
+
+        if (next() % 10000 < config_.loss_) {
+            ++stats_.transmit_loss_;
+            ++total_lost_;
+            return true;
+        }
+
+        u32 arrival = link_free_at_ + config_.latency_;
+        if (config_.jitter_) {
+            arrival += next() % (config_.jitter_ + 1);
+        }
+
+        // The link delivers messages in order, jitter cannot reorder them.
+        arrival = std::max(arrival, last_arrival_);
+        last_arrival_ = arrival;
+
+        Packet packet;
+        packet.arrival_ = arrival;
+        packet.data_.assign((const u8*)data, (const u8*)data + length);
+        outgoing_.push_back(std::move(packet));
+
+        ++total_sent_;
+        total_bytes_ += length;
+
+        return true;
+    }
+
+    // Swap this frame's messages with the other process, then deliver any
+    // messages that have arrived by the end of the frame.
+    void exchange(Microseconds delta)
+    {
+        std::vector<u8> out;
+        auto put_u32 = [&](u32 value) {
+            for (int i = 0; i < 4; ++i) {
+                out.push_back((value >> (i * 8)) & 0xff);
+            }
+        };
+
+        put_u32(connected_);
+        put_u32(outgoing_.size());
+        for (auto& packet : outgoing_) {
+            put_u32(packet.arrival_);
+            out.push_back(packet.data_.size());
+            out.insert(out.end(), packet.data_.begin(), packet.data_.end());
+        }
+        outgoing_.clear();
+
+        write_all(out.data(), out.size());
+
+        const bool peer_connected = read_u32();
+        if (not peer_connected) {
+            connected_ = false;
+        }
+
+        const u32 count = read_u32();
+        for (u32 i = 0; i < count; ++i) {
+            Packet packet;
+            packet.arrival_ = read_u32();
+            u8 length;
+            read_all(&length, 1);
+            packet.data_.resize(length);
+            read_all(packet.data_.data(), length);
+            incoming_.push_back(std::move(packet));
+        }
+
+        clock_ += delta;
+
+        while (not incoming_.empty() and incoming_.front().arrival_ <= clock_) {
+            auto& data = incoming_.front().data_;
+            received_.insert(received_.end(), data.begin(), data.end());
+            incoming_.erase(incoming_.begin());
+            ++stats_.receive_count_;
+            ++total_received_;
+        }
+    }
+
+    std::optional<Platform::NetworkPeer::Message> poll()
+    {
+        if (read_position_ == received_.size()) {
+            return {};
+        }
+        return Platform::NetworkPeer::Message{
+            (const byte*)received_.data() + read_position_,
+            u32(received_.size() - read_position_)};
+    }
+
+    void consume(u32 length)
+    {
+        read_position_ += length;
+        if (read_position_ >= received_.size()) {
+            received_.clear();
+            read_position_ = 0;
+        }
+    }
+
+    Platform::NetworkPeer::Stats stats()
+    {
+        auto result = stats_;
+
+        if (config_.bandwidth_ and clock_ not_eq stats_epoch_) {
+            const u64 capacity =
+                u64(config_.bandwidth_) * (clock_ - stats_epoch_) / seconds(1);
+            result.link_saturation_ =
+                capacity ? std::min(u64(100), bytes_sent_ * 100 / capacity)
+                         : 0;
+        }
+
+        stats_ = {};
+        stats_epoch_ = clock_;
+        bytes_sent_ = 0;
+
+        return result;
+    }
+
+    void report(std::ostream& out) const
+    {
+        out << "net       sent " << total_sent_ << " (" << total_bytes_
+            << " bytes)  lost " << total_lost_ << "  received "
+            << total_received_ << std::endl;
+    }
+
+private:
+    struct Packet {
+        u32 arrival_;
+        std::vector<u8> data_;
+    };
+
+    u32 next()
+    {
+        rng_ = rng_ * 1664525 + 1013904223;
+        return rng_ >> 8;
+    }
+
+    void write_all(const u8* data, size_t length)
+    {
+        while (length) {
+            const auto n = ::write(fd_, data, length);
+            if (n <= 0) {
+                std::cerr << "loopback: peer went away" << std::endl;
+                exit(1);
+            }
+            data += n;
+            length -= n;
+        }
+    }
+
+    void read_all(u8* data, size_t length)
+    {
+        while (length) {
+            const auto n = ::read(fd_, data, length);
+            if (n <= 0) {
+                std::cerr << "loopback: peer went away" << std::endl;
+                exit(1);
+            }
+            data += n;
+            length -= n;
+        }
+    }
+
+    u32 read_u32()
+    {
+        u8 bytes[4];
+        read_all(bytes, 4);
+        return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+               (u32(bytes[3]) << 24);
+    }
+
+    int fd_;
+    bool host_;
+    bool connected_ = false;
+    LinkConfig config_;
+    u32 rng_;
+
+    u32 clock_ = 0;
+    u32 link_free_at_ = 0;
+    u32 last_arrival_ = 0;
+
+    std::vector<Packet> outgoing_;
+    std::vector<Packet> incoming_;
+
+    std::vector<u8> received_;
+    size_t read_position_ = 0;
+
+    Platform::NetworkPeer::Stats stats_ = {};
+    u32 stats_epoch_ = 0;
+    u64 bytes_sent_ = 0;
+
+    u32 total_sent_ = 0;
+    u64 total_bytes_ = 0;
+    u32 total_lost_ = 0;
+    u32 total_received_ = 0;
+};
+
+
+} // namespace
+
+
+static std::optional<LoopbackLink> loopback;
+
+
+////////////////////////////////////////////////////////////////////////////////
+// NetworkPeer
+////////////////////////////////////////////////////////////////////////////////
+
+
+Platform::NetworkPeer::NetworkPeer() : impl_(nullptr)
+{
+}
+
+
+Platform::NetworkPeer::~NetworkPeer()
+{
+}
+
+
+void Platform::NetworkPeer::disconnect()
+{
+    if (loopback) {
+        loopback->disconnect();
+    }
+}
+
+
+bool Platform::NetworkPeer::is_host() const
+{
+    return loopback and loopback->is_host();
+}
+
+
+bool Platform::NetworkPeer::supported_by_device()
+{
+    return static_cast<bool>(loopback);
+}
+
+
+void Platform::NetworkPeer::listen()
+{
+}
+
+
+void Platform::NetworkPeer::connect(const char* peer)
+{
+}
+
+
+static std::optional<Platform::NetworkPeer::ConnectionCallback>
+    connection_callback;
+
+
+void Platform::NetworkPeer::on_connection_change(ConnectionCallback callback)
+{
+    connection_callback.emplace(callback);
+}
+
+
+bool Platform::NetworkPeer::is_connected() const
+{
+    return loopback and loopback->is_connected();
+}
+
+
+bool Platform::NetworkPeer::send_message(const Message& message)
+{
+    return loopback and loopback->send(message.data_, message.length_);
+}
+
+
+void Platform::NetworkPeer::update()
+{
+    // The loopback link is always up while the game runs, so if anyone asks,
+    // we report the connection right away.
+    if (connection_callback) {
+        auto callback = *connection_callback;
+        connection_callback.reset();
+        callback(*::platform, is_connected());
+    }
+}
+
+
+std::optional<Platform::NetworkPeer::Message>
+Platform::NetworkPeer::poll_message()
+{
+    if (loopback) {
+        return loopback->poll();
+    }
+    return {};
+}
+
+
+void Platform::NetworkPeer::poll_consume(u32 length)
+{
+    if (loopback) {
+        loopback->consume(length);
+    }
+}
+
+
+Platform::NetworkPeer::Stats Platform::NetworkPeer::stats()
+{
+    if (loopback) {
+        return loopback->stats();
+    }
+    return {0, 0, 0, 0, 0};
+}
+
+
+Platform::NetworkPeer::Interface Platform::NetworkPeer::interface() const
+{
+    return Interface::internet;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SystemClock
+////////////////////////////////////////////////////////////////////////////////
+
+
+Platform::SystemClock::SystemClock()
+{
+}
+
+
+void Platform::SystemClock::init(Platform& pfrm)
+{
+}
+
+
+std::optional<DateTime> Platform::SystemClock::now()
+{
+    // The benchmark should not depend on the time of day.
+    return {};
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// SynchronizedBase
+////////////////////////////////////////////////////////////////////////////////
+
+
+void SynchronizedBase::init(Platform& pf)
+{
+    impl_ = nullptr;
+}
+
+
+void SynchronizedBase::lock()
+{
+}
+
+
+void SynchronizedBase::unlock()
+{
+}
+
+
+SynchronizedBase::~SynchronizedBase()
+{
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Platform
+////////////////////////////////////////////////////////////////////////////////
+
+
+static ObjectPool<RcBase<ScratchBuffer, scratch_buffer_count>::ControlBlock,
+                  scratch_buffer_count>
+    scratch_buffer_pool;
+
+
+static int scratch_buffers_in_use = 0;
+
+
+ScratchBufferPtr Platform::make_scratch_buffer()
+{
+    auto finalizer =
+        [](RcBase<ScratchBuffer, scratch_buffer_count>::ControlBlock* ctrl) {
+            --scratch_buffers_in_use;
+            ctrl->pool_->post(ctrl);
+        };
+
+    auto maybe_buffer =
+        ScratchBufferPtr::create(&scratch_buffer_pool, finalizer);
+    if (maybe_buffer) {
+        ++scratch_buffers_in_use;
+        return *maybe_buffer;
+    } else {
+        error(*this, "scratch buffer pool exhausted");
+        fatal("scratch buffer pool exhausted");
+    }
+}
+
+
+int Platform::scratch_buffers_remaining()
+{
+    return scratch_buffer_count - scratch_buffers_in_use;
+}
+
+
+std::optional<DateTime> Platform::startup_time() const
+{
+    return {};
+}
+
+
+Platform::Platform()
+{
+    ::platform = this;
+
+    screen_.view_.set_size(screen_.size().cast<Float>());
+}
+
+
+Platform::~Platform()
+{
+}
+
+
+void Platform::enable_feature(const char* feature_name, int value)
+{
+}
+
+
+void Platform::soft_exit()
+{
+}
+
+
+// The benchmark always starts from a new game, so save data lives only in
+// memory, and only for the duration of the run. We still run it through the
+// save journal, so that the benchmark exercises the same code as the real
+// platforms.
+class MemorySaveDevice : public SaveJournal::Device {
+public:
+    MemorySaveDevice()
+    {
+        contents_.fill(0xff);
+    }
+
+    void read(u32 offset, void* dest, u32 length) override
+    {
+        memcpy(dest, contents_.data() + offset, length);
+    }
+
+    bool write(u32 offset, const void* data, u32 length) override
+    {
+        memcpy(contents_.data() + offset, data, length);
+        return true;
+    }
+
+    bool erase_sector(u32 sector) override
+    {
+        memset(contents_.data() + sector * SaveJournal::sector_size,
+               0xff,
+               SaveJournal::sector_size);
+        return true;
+    }
+
+private:
+    std::array<u8, SaveJournal::sector_size * SaveJournal::sector_count>
+        contents_;
+};
+
+
+static MemorySaveDevice save_device;
+static SaveJournal save_journal(save_device);
+
+
+bool Platform::write_save_data(const void* data, u32 length, u32 offset)
+{
+    return save_journal.write(data, length, offset);
+}
+
+
+bool Platform::read_save_data(void* buffer, u32 data_length, u32 offset)
+{
+    return save_journal.read(buffer, data_length, offset);
+}
+
+
+bool Platform::is_running() const
+{
+    return true;
+}
+
+
+void Platform::sleep(u32 frames)
+{
+}
+
+
+void Platform::prefetch_texture(const char* name)
+{
+}
+
+
+void Platform::load_sprite_texture(const char* name)
+{
+}
+
+
+void Platform::load_tile0_texture(const char* name)
+{
+}
+
+
+void Platform::load_tile1_texture(const char* name)
+{
+}
+
+
+bool Platform::overlay_texture_exists(const char* name)
+{
+    return true;
+}
+
+
+static std::map<TileDesc, TileDesc> glyph_table;
+static TileDesc next_glyph;
+
+
+bool Platform::load_overlay_texture(const char* name)
+{
+    glyph_table.clear();
+    next_glyph = 0;
+
+    return true;
+}
+
+
+void Platform::on_watchdog_timeout(WatchdogCallback callback)
+{
+}
+
+
+void Platform::feed_watchdog()
+{
+}
+
+
+static std::map<Layer, std::map<std::pair<u16, u16>, TileDesc>> tile_layers;
+
+
+void Platform::set_tile(Layer layer, u16 x, u16 y, TileDesc val)
+{
+    tile_layers[layer][{x, y}] = val;
+}
+
+
+void Platform::set_tile(u16 x, u16 y, TileDesc glyph, const FontColors& colors)
+{
+    set_tile(Layer::overlay, x, y, glyph);
+}
+
+
+TileDesc Platform::get_tile(Layer layer, u16 x, u16 y)
+{
+    return tile_layers[layer][{x, y}];
+}
+
+
+void Platform::fill_overlay(u16 tile_desc)
+{
+    for (auto& kvp : tile_layers[Layer::overlay]) {
+        kvp.second = tile_desc;
+    }
+}
+
+
+void Platform::set_overlay_origin(Float x, Float y)
+{
+}
+
+
+void Platform::enable_glyph_mode(bool enabled)
+{
+}
+
+
+void Platform::enable_expanded_glyph_mode(bool enabled)
+{
+}
+
+
+TileDesc Platform::map_glyph(const utf8::Codepoint& glyph,
+                             const TextureMapping& mapping)
+{
+    auto found = glyph_table.find(mapping.offset_);
+    if (found not_eq glyph_table.end()) {
+        return found->second;
+    }
+
+    return glyph_table[mapping.offset_] = next_glyph++;
+}
+
+
+void Platform::fatal(const char* msg)
+{
+    std::cerr << "fatal: " << msg << std::endl;
+    exit(1);
+}
+
+
+static std::map<std::string, std::string> files;
+
+
+const char* Platform::load_file_contents(const char* folder,
+                                         const char* filename) const
+{
+    const auto name = std::string(folder) + "/" + filename;
+
+    auto found = files.find(name);
+    if (found == files.end()) {
+        std::ifstream file(resource_root + name);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        found = files.insert({name, buffer.str()}).first;
+    }
+
+    return found->second.c_str();
+}
+
+
+const char* Platform::get_opt(char opt)
+{
+    return nullptr;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmark
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+
+
+struct Samples {
+    const char* name_;
+    std::vector<Microseconds> values_;
+
+    void push(Microseconds value)
+    {
+        values_.push_back(value);
+    }
+
+    void report()
+    {
+        std::cout << name_;
+        for (auto i = strlen(name_); i < 10; ++i) {
+            std::cout << ' ';
+        }
+
+        if (values_.empty()) {
+            std::cout << "no samples" << std::endl;
+            return;
+        }
+
+        std::sort(values_.begin(), values_.end());
+
+        auto percentile = [&](int p) {
+            return values_[((values_.size() - 1) * p) / 100];
+        };
+
+        std::cout << "n " << values_.size() << "  p50 " << percentile(50)
+                  << "  p90 " << percentile(90) << "  p99 " << percentile(99)
+                  << "  max " << values_.back() << " (us)" << std::endl;
+    }
+};
+
+
+// Scripted input. Wander around, holding each direction for a random number of
+// frames, while periodically tapping the action buttons, which also advances
+// us through menus and dialog boxes. Uses its own generator, so that the
+// script does not disturb the game's random number engines.
+class InputScript {
+public:
+    InputScript(u32 seed) : state_(seed)
+    {
+    }
+
+    void step()
+    {
+        for (auto& k : scripted_keys) {
+            k = false;
+        }
+
+        if (hold_ == 0) {
+            direction_ = next() % 5;
+            hold_ = 20 + next() % 70;
+        }
+        --hold_;
+
+        static const Key directions[] = {
+            Key::left, Key::right, Key::up, Key::down};
+
+        if (direction_ < 4) {
+            scripted_keys[int(directions[direction_])] = true;
+        }
+
+        ++frame_;
+        scripted_keys[int(Key::action_1)] = frame_ % 16 < 8;
+        scripted_keys[int(Key::action_2)] = frame_ % 90 < 2;
+    }
+
+private:
+    u32 next()
+    {
+        state_ = state_ * 1664525 + 1013904223;
+        return state_ >> 16;
+    }
+
+    u32 state_;
+    u32 hold_ = 0;
+    u32 direction_ = 4;
+    u32 frame_ = 0;
+};
+
+
+} // namespace
+
+
+static void benchmark(Platform& pf, int frames, int levels, u32 seed)
+{
+    globals().emplace<BlindJumpGlobalData>();
+
+    Synchronized<Game> game(pf, pf);
+
+    Samples levelgen{"levelgen", {}};
+    Samples update{"update", {}};
+    Samples entities{"entities", {}};
+    Samples collision{"collision", {}};
+    Samples render{"render", {}};
+
+    auto& clk = pf.delta_clock();
+
+    // NOTE: Level generation takes a few different paths while connected (e.g.
+    // fewer small maps), so we bring up the link before the level generation
+    // pass, to exercise them. The levelgen timings from a loopback run are
+    // therefore not comparable with single player runs.
+    if (loopback) {
+        loopback->connect();
+    }
+
+    game.acquire([&](Game& gm) {
+        rng::critical_state = seed;
+
+        for (int i = 0, level = 1; i < levels; ++i, ++level) {
+            while (is_boss_level(level) or level >= boss_max_level) {
+                level = (level + 1) % boss_max_level;
+            }
+
+            const auto start = clk.sample();
+            gm.next_level(pf, level);
+            levelgen.push(clk.duration(start, clk.sample()));
+        }
+
+        gm.next_level(pf, 0);
+    });
+
+    rng::critical_state = seed;
+    rng::utility_state = seed;
+
+    // Give the second player in a loopback test a different input script, so
+    // that the players don't move in unison.
+    InputScript input(loopback and not loopback->is_host() ? seed + 1 : seed);
+
+    const bool playing_back = replay::playing();
+    if (playing_back) {
+        frames = std::numeric_limits<int>::max();
+    }
+
+    int simulated = 0;
+
+    for (; simulated < frames; ++simulated) {
+        const int i = simulated;
+
+        input.step();
+
+        pf.screen().clear();
+
+        bool replay_finished = false;
+
+        game.acquire([&](Game& gm) {
+            pf.keyboard().poll();
+
+            // When playing back a replay, run until we run out of recorded
+            // input, regardless of the frame count.
+            if (playing_back and not replay::playing()) {
+                replay_finished = true;
+                return;
+            }
+
+            const auto delta = clk.reset();
+
+            profiler::end_frame(delta);
+
+            // NOTE: Only the overworld states record entity update and
+            // collision timings, so we skip frames where the markers were
+            // never hit (menus, cutscenes, etc.).
+            auto& prev = profiler::frame(0);
+            if (i > 0) {
+                using profiler::Marker;
+
+                if (prev.recorded(Marker::entity_update)) {
+                    entities.push(prev.get(Marker::entity_update));
+                }
+                if (prev.recorded(Marker::collision)) {
+                    collision.push(prev.get(Marker::collision));
+                }
+            }
+
+            auto start = clk.sample();
+            gm.update(pf, delta);
+            update.push(clk.duration(start, clk.sample()));
+
+            start = clk.sample();
+            gm.render(pf);
+            render.push(clk.duration(start, clk.sample()));
+        });
+
+        if (replay_finished) {
+            break;
+        }
+
+        pf.screen().display();
+
+        if (loopback) {
+            loopback->exchange(1000000 / 60);
+        }
+    }
+
+    replay::stop_recording();
+
+    if (loopback) {
+        if (loopback->is_host()) {
+            // Let the other instance print its report first, so that the
+            // output isn't interleaved.
+            wait(nullptr);
+            std::cout << "-- host" << std::endl;
+        } else {
+            std::cout << "-- client" << std::endl;
+        }
+    }
+
+    std::cout << "frames " << simulated << "  levels " << levels << "  seed "
+              << seed << "  jobs " << (jobs ? jobs->thread_count() : 1)
+              << std::endl;
+
+    levelgen.report();
+    update.report();
+    entities.report();
+    collision.report();
+    render.report();
+
+    if (loopback) {
+        loopback->report(std::cout);
+    }
+
+    // If two runs with the same arguments print different values here, then
+    // something in the game loop is nondeterministic, and the timings from
+    // those runs cannot be compared.
+    game.acquire([&](Game& gm) {
+        std::cout << "final level " << gm.level() << "  score " << gm.score()
+                  << "  rng " << u32(rng::critical_state) << "  sprites "
+                  << sprite_draw_count << std::endl;
+    });
+}
+
+
+int main(int argc, char** argv)
+{
+    popl::OptionParser op("Allowed options");
+    auto help_option =
+        op.add<popl::Switch>("h", "help", "produce help message");
+    auto frames_option =
+        op.add<popl::Value<int>>("f", "frames", "frames to simulate", 3600);
+    auto levels_option =
+        op.add<popl::Value<int>>("l", "levels", "levels to generate", 24);
+    auto seed_option = op.add<popl::Value<u32>>("s", "seed", "rng seed", 1);
+    auto root_option = op.add<popl::Value<std::string>>(
+        "r", "root", "directory containing scripts/ and strings/", "./");
+    auto record_option = op.add<popl::Value<std::string>>(
+        "", "record", "record the scripted input to a replay file");
+    auto playback_option = op.add<popl::Value<std::string>>(
+        "", "playback", "replace the scripted input with a replay file");
+    auto loopback_option = op.add<popl::Switch>(
+        "", "loopback", "run two connected game instances (multiplayer)");
+    auto latency_option = op.add<popl::Value<int>>(
+        "", "latency", "loopback link latency (milliseconds)", 30);
+    auto jitter_option = op.add<popl::Value<int>>(
+        "", "jitter", "loopback link jitter (milliseconds)", 10);
+    auto bandwidth_option = op.add<popl::Value<int>>(
+        "", "bandwidth", "loopback link bytes per second, 0 is unlimited", 0);
+    auto loss_option = op.add<popl::Value<float>>(
+        "", "loss", "loopback link message loss (percent)", 0.f);
+    auto jobs_option = op.add<popl::Value<int>>(
+        "j", "jobs", "threads for the simulation step, as on desktop", 1);
+
+    try {
+        op.parse(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    if (help_option->is_set()) {
+        std::cout << op << std::endl;
+        return 0;
+    }
+
+    ::resource_root = root_option->value();
+    if (not ::resource_root.empty() and ::resource_root.back() not_eq '/') {
+        ::resource_root += '/';
+    }
+
+    if (loopback_option->is_set()) {
+        if (playback_option->is_set() or record_option->is_set()) {
+            std::cerr << "--loopback does not support replays" << std::endl;
+            return 1;
+        }
+
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) not_eq 0) {
+            std::cerr << "loopback: socketpair failed" << std::endl;
+            return 1;
+        }
+
+        LinkConfig config;
+        config.latency_ = latency_option->value() * 1000;
+        config.jitter_ = jitter_option->value() * 1000;
+        config.bandwidth_ = bandwidth_option->value();
+        config.loss_ = loss_option->value() * 100;
+
+        const auto pid = fork();
+        if (pid < 0) {
+            std::cerr << "loopback: fork failed" << std::endl;
+            return 1;
+        }
+
+        const bool host = pid > 0;
+
+        close(fds[host ? 1 : 0]);
+
+        const u32 seed = seed_option->value();
+        loopback.emplace(fds[host ? 0 : 1], host, config, host ? seed : ~seed);
+    }
+
+    if (jobs_option->value() > 1) {
+        jobs.emplace(jobs_option->value());
+    }
+
+    Platform pf;
+
+    if (playback_option->is_set()) {
+        if (not replay::start_playback(pf, playback_option->value().c_str())) {
+            return 1;
+        }
+        auto& save_data = replay::save_data();
+        save_journal.write(save_data.data(), save_data.size(), 0);
+    } else if (record_option->is_set()) {
+        std::vector<u8> save_data(save_journal.size());
+        save_journal.read(save_data.data(), save_data.size(), 0);
+        if (not replay::start_recording(
+                pf, record_option->value().c_str(), save_data)) {
+            return 1;
+        }
+    }
+
+    benchmark(pf,
+              frames_option->value(),
+              levels_option->value(),
+              seed_option->value());
+}
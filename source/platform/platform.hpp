@@ -197,6 +197,10 @@ public:
     void set_overlay_origin(Float x, Float y);
 
 
+    // A hint, that the game is going to load the named texture soon. Platforms
+    // that decode images at load time may start doing so in advance.
+    void prefetch_texture(const char* name);
+
     void load_sprite_texture(const char* name);
     void load_tile0_texture(const char* name);
     void load_tile1_texture(const char* name);
@@ -544,6 +548,15 @@ public:
         void connect(const char* peer_address);
         void listen();
 
+        // Some platforms connect asynchronously, in which case, connect() and
+        // listen() return immediately, and the platform invokes the callback
+        // from within update() once the connection attempt succeeds or fails,
+        // and again if an established connection drops. Platforms that connect
+        // synchronously invoke the callback before returning from connect() or
+        // listen().
+        using ConnectionCallback = Function<16, void(Platform&, bool)>;
+        void on_connection_change(ConnectionCallback callback);
+
         void disconnect();
 
         bool is_connected() const;
@@ -586,6 +599,8 @@ public:
         // multiplayer.
         static bool supported_by_device();
 
+        // Message counts cover the interval since the previous call to
+        // stats(), i.e. calling stats() resets them.
         struct Stats {
             int transmit_count_;
             int receive_count_;
@@ -662,6 +677,15 @@ public:
     void push_task(Task* task);
 
 
+    // Calls fn(context, i) for each i in [0, count), possibly in parallel, and
+    // returns once all of the calls finish. Meant for a handful of coarse jobs,
+    // e.g. one per entity group, each of which must write only to state that no
+    // other job reads. Platforms without threads (or with only one job thread)
+    // simply make the calls in order.
+    using ParallelFn = void (*)(void* context, u32 index);
+    void parallel_for(u32 count, ParallelFn fn, void* context);
+
+
     class Data;
 
     Data* data()
@@ -182,6 +182,14 @@ void Platform::push_task(Task* task)
 }
 
 
+void Platform::parallel_for(u32 count, ParallelFn fn, void* context)
+{
+    for (u32 i = 0; i < count; ++i) {
+        fn(context, i);
+    }
+}
+
+
 void Platform::feed_watchdog()
 {
     // TODO
@@ -360,6 +368,12 @@ load_pixel(const u8* img_data, u32 img_size, int img_height, int x, int y)
 }
 
 
+void Platform::prefetch_texture(const char* name)
+{
+    // Textures are linked into the executable, nothing to decode in advance.
+}
+
+
 void Platform::load_sprite_texture(const char* name)
 {
     auto img_data = find_image(name);
@@ -914,6 +928,12 @@ void Platform::NetworkPeer::listen()
 }
 
 
+void Platform::NetworkPeer::on_connection_change(ConnectionCallback callback)
+{
+    // TODO
+}
+
+
 Platform::NetworkPeer::Interface Platform::NetworkPeer::interface() const
 {
     return Interface::serial_cable;
@@ -998,6 +1018,12 @@ Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
 }
 
 
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    return t2 - t1;
+}
+
+
 Platform::DeltaClock::~DeltaClock()
 {
 }
@@ -0,0 +1,152 @@
+#include "profiler.hpp"
+#include "localization.hpp"
+
+
+namespace profiler {
+
+
+static constexpr const int marker_count = static_cast<int>(Marker::count);
+
+
+static Frame current_frame;
+static Frame history[history_length];
+static int history_index;
+
+static u8 scope_depth[marker_count];
+
+
+const char* marker_name(Marker m)
+{
+    switch (m) {
+    case Marker::entity_update:
+        return "upd";
+    case Marker::collision:
+        return "col";
+    case Marker::render:
+        return "rnd";
+    case Marker::vm_execute:
+        return "vm";
+    case Marker::gc:
+        return "gc";
+    case Marker::network_poll:
+        return "net";
+    case Marker::audio_isr:
+        return "isr";
+    case Marker::count:
+        break;
+    }
+    return "?";
+}
+
+
+void record(Marker m, Microseconds duration)
+{
+    current_frame.markers_[static_cast<int>(m)] += duration;
+    current_frame.recorded_ |= 1 << static_cast<int>(m);
+}
+
+
+void end_frame(Microseconds frame_duration)
+{
+    current_frame.total_ = frame_duration;
+
+    history_index = (history_index + 1) % history_length;
+    history[history_index] = current_frame;
+
+    current_frame = Frame{};
+}
+
+
+const Frame& frame(int age)
+{
+    return history[(history_index + history_length - (age % history_length)) %
+                   history_length];
+}
+
+
+Microseconds average(Marker m)
+{
+    Microseconds accum = 0;
+    for (auto& f : history) {
+        accum += f.get(m);
+    }
+    return accum / history_length;
+}
+
+
+Microseconds average_frame_time()
+{
+    Microseconds accum = 0;
+    for (auto& f : history) {
+        accum += f.total_;
+    }
+    return accum / history_length;
+}
+
+
+template <typename F> static Microseconds worst(F&& get)
+{
+    Microseconds result = 0;
+    for (auto& f : history) {
+        result = std::max(result, get(f));
+    }
+    return result;
+}
+
+
+static void
+dump_line(Platform& pfrm, const char* name, Microseconds avg, Microseconds max)
+{
+    StringBuffer<64> line(name);
+    while (line.length() < 6) {
+        line.push_back(' ');
+    }
+    line += "avg ";
+    line += to_string<12>(avg).c_str();
+    line += " max ";
+    line += to_string<12>(max).c_str();
+    line += "\r\n";
+
+    pfrm.remote_console().printline_blocking(line.c_str(), false);
+}
+
+
+void dump(Platform& pfrm)
+{
+    dump_line(pfrm,
+              "frame",
+              average_frame_time(),
+              worst([](const Frame& f) { return f.total_; }));
+
+    for (int i = 0; i < marker_count; ++i) {
+        const auto m = static_cast<Marker>(i);
+
+        dump_line(pfrm, marker_name(m), average(m), worst([m](const Frame& f) {
+                      return f.get(m);
+                  }));
+    }
+}
+
+
+Scope::Scope(Platform& pfrm, Marker marker)
+    : pfrm_(pfrm), start_(0), marker_(marker),
+      outermost_(scope_depth[static_cast<int>(marker)]++ == 0)
+{
+    if (outermost_) {
+        start_ = pfrm_.delta_clock().sample();
+    }
+}
+
+
+Scope::~Scope()
+{
+    --scope_depth[static_cast<int>(marker_)];
+
+    if (outermost_) {
+        const auto stop = pfrm_.delta_clock().sample();
+        record(marker_, Platform::DeltaClock::duration(start_, stop));
+    }
+}
+
+
+} // namespace profiler
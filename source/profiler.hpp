@@ -0,0 +1,102 @@
+#pragma once
+
+#include "platform/platform.hpp"
+
+
+// A lightweight frame profiler. Code wraps interesting sections in
+// profiler::Scope markers, which accumulate the time spent in each subsystem
+// over the course of a frame. At the end of each frame, the totals move into a
+// small ring buffer, so that we can look back and figure out where a slow frame
+// went. Timing uses the platform's DeltaClock, so the resolution depends on the
+// platform (cpu cycles on the gameboy advance, a high resolution clock on
+// desktop).
+
+
+namespace profiler {
+
+
+enum class Marker : u8 {
+    entity_update,
+    collision,
+    render,
+    vm_execute,
+    gc,
+    network_poll,
+    audio_isr,
+    count
+};
+
+
+// A short name, at most three letters, suitable for displaying in the overlay.
+const char* marker_name(Marker m);
+
+
+struct Frame {
+    Microseconds total_ = 0;
+    Microseconds markers_[static_cast<int>(Marker::count)] = {};
+
+    // One bit per marker, set if anything recorded the marker during the
+    // frame. Lets us tell apart a section that took no measurable time from a
+    // section that never ran.
+    u16 recorded_ = 0;
+
+    Microseconds get(Marker m) const
+    {
+        return markers_[static_cast<int>(m)];
+    }
+
+    bool recorded(Marker m) const
+    {
+        return recorded_ & (1 << static_cast<int>(m));
+    }
+};
+
+
+static constexpr const int history_length = 32;
+
+
+// Add time to the current frame's total for a marker. Meant for platform code
+// that measures its own timings, e.g. interrupt handlers. Everything else
+// should use Scope.
+void record(Marker m, Microseconds duration);
+
+
+// Move the current frame into the history ring and start a new frame. The
+// frame duration should be the value returned by DeltaClock::reset().
+void end_frame(Microseconds frame_duration);
+
+
+// Age zero refers to the most recently completed frame, age
+// history_length - 1 to the oldest.
+const Frame& frame(int age);
+
+
+// Averaged over the whole history ring.
+Microseconds average(Marker m);
+Microseconds average_frame_time();
+
+
+// Print per-marker average and worst-case timings to the remote console.
+void dump(Platform& pfrm);
+
+
+// NOTE: Scopes for the same marker may nest (e.g. the lisp vm recursively calls
+// itself), in which case, only the outermost scope records anything, so that
+// we do not count the same interval more than once.
+class Scope {
+public:
+    Scope(Platform& pfrm, Marker marker);
+
+    Scope(const Scope&) = delete;
+
+    ~Scope();
+
+private:
+    Platform& pfrm_;
+    Platform::DeltaClock::TimePoint start_;
+    Marker marker_;
+    bool outermost_;
+};
+
+
+} // namespace profiler
@@ -0,0 +1,431 @@
+#include "replay.hpp"
+#include "localization.hpp"
+#include "number/endian.hpp"
+#include "number/random.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <optional>
+
+
+namespace replay {
+
+
+static const char magic[4] = {'B', 'J', 'R', 'P'};
+static const u8 format_version = 1;
+
+
+// Emit a seed checkpoint every this many frames.
+static const u32 checkpoint_interval = 64;
+
+
+enum Command : u8 { frames, keys, delta_change, seed };
+
+
+struct Header {
+    char magic_[4];
+    u8 version_;
+    host_u32 critical_seed_;
+    host_u32 utility_seed_;
+    host_u32 save_length_;
+};
+
+
+static_assert(sizeof(Header) == 17);
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Recording
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+struct Recorder {
+    std::ofstream out_;
+
+    PackedKeys keys_ = 0;
+    Microseconds delta_ = 0;
+    u32 run_length_ = 0;
+    u32 frame_count_ = 0;
+
+    PackedKeys pending_keys_ = 0;
+    rng::LinearGenerator pending_seed_ = 0;
+    bool frame_pending_ = false;
+
+    std::vector<u8> save_data_;
+    bool header_written_ = false;
+};
+} // namespace
+
+
+static std::optional<Recorder> recorder;
+
+
+static void write_varint(std::ofstream& out, u32 value)
+{
+    while (value >= 0x80) {
+        out.put(char((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.put(char(value));
+}
+
+
+static void write_u32(std::ofstream& out, u32 value)
+{
+    host_u32 encoded;
+    encoded.set(value);
+    out.write((const char*)&encoded, sizeof encoded);
+}
+
+
+static void flush_run(Recorder& r)
+{
+    if (r.run_length_) {
+        r.out_.put(char(Command::frames));
+        write_varint(r.out_, r.run_length_);
+        r.run_length_ = 0;
+    }
+}
+
+
+bool start_recording(Platform& pfrm,
+                     const char* path,
+                     const std::vector<u8>& save_data)
+{
+    recorder.emplace();
+    recorder->out_.open(path, std::ios_base::out | std::ios_base::binary);
+
+    if (not recorder->out_) {
+        error(pfrm, "replay: failed to open output file");
+        recorder.reset();
+        return false;
+    }
+
+    recorder->save_data_ = save_data;
+
+    info(pfrm, "replay: recording started");
+
+    return true;
+}
+
+
+// NOTE: We defer writing the header until the first frame, because the game
+// re-seeds the rng while starting up (from the save data), and we want to
+// capture the seeds that the first frame actually sees.
+static void write_header(Recorder& r)
+{
+    Header header;
+    memcpy(header.magic_, magic, sizeof magic);
+    header.version_ = format_version;
+    header.critical_seed_.set(rng::critical_state);
+    header.utility_seed_.set(rng::utility_state);
+    header.save_length_.set(r.save_data_.size());
+
+    r.out_.write((const char*)&header, sizeof header);
+    r.out_.write((const char*)r.save_data_.data(), r.save_data_.size());
+
+    r.save_data_.clear();
+    r.header_written_ = true;
+}
+
+
+static void record_frame(Recorder& r, Microseconds delta)
+{
+    // NOTE: The rng seeds in the header describe the state at the very start
+    // of the first frame, so we do not need a checkpoint there.
+    const bool checkpoint =
+        r.frame_count_ and r.frame_count_ % checkpoint_interval == 0;
+
+    if (checkpoint or r.pending_keys_ not_eq r.keys_ or delta not_eq r.delta_) {
+        flush_run(r);
+    }
+
+    if (checkpoint) {
+        r.out_.put(char(Command::seed));
+        write_u32(r.out_, r.pending_seed_);
+    }
+
+    if (r.pending_keys_ not_eq r.keys_) {
+        r.out_.put(char(Command::keys));
+        r.out_.put(char(r.pending_keys_ & 0xff));
+        r.out_.put(char(r.pending_keys_ >> 8));
+        r.keys_ = r.pending_keys_;
+    }
+
+    if (delta not_eq r.delta_) {
+        // zigzag encoding, so that small negative changes stay small
+        const s32 diff = delta - r.delta_;
+        r.out_.put(char(Command::delta_change));
+        write_varint(r.out_, (u32(diff) << 1) ^ u32(diff >> 31));
+        r.delta_ = delta;
+    }
+
+    ++r.run_length_;
+    ++r.frame_count_;
+}
+
+
+void stop_recording()
+{
+    if (recorder) {
+        if (not recorder->header_written_) {
+            write_header(*recorder);
+        }
+        if (recorder->frame_pending_) {
+            record_frame(*recorder, recorder->delta_);
+        }
+        flush_run(*recorder);
+        recorder.reset();
+    }
+}
+
+
+bool recording()
+{
+    return static_cast<bool>(recorder);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Playback
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+struct Player {
+    std::vector<u8> data_;
+    u32 position_ = 0;
+
+    std::vector<u8> save_data_;
+
+    rng::LinearGenerator critical_seed_ = 0;
+    rng::LinearGenerator utility_seed_ = 0;
+
+    PackedKeys keys_ = 0;
+    Microseconds delta_ = 0;
+    u32 run_remaining_ = 0;
+    u32 frame_count_ = 0;
+
+    bool desynced_ = false;
+};
+} // namespace
+
+
+static std::optional<Player> player;
+
+
+// When we aren't playing anything back, save data still needs somewhere to
+// live, for the recorder.
+static std::vector<u8> empty_save_data;
+
+
+static bool read_varint(Player& p, u32& result)
+{
+    result = 0;
+    for (int shift = 0; p.position_ < p.data_.size() and shift < 35;
+         shift += 7) {
+        const u8 b = p.data_[p.position_++];
+        result |= u32(b & 0x7f) << shift;
+        if (not(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+static bool read_u32(Player& p, u32& result)
+{
+    if (p.position_ + sizeof(host_u32) > p.data_.size()) {
+        return false;
+    }
+    host_u32 encoded;
+    memcpy(&encoded, p.data_.data() + p.position_, sizeof encoded);
+    p.position_ += sizeof encoded;
+    result = encoded.get();
+    return true;
+}
+
+
+bool start_playback(Platform& pfrm, const char* path)
+{
+    std::ifstream in(path, std::ios_base::in | std::ios_base::binary);
+    if (not in) {
+        error(pfrm, "replay: failed to open input file");
+        return false;
+    }
+
+    player.emplace();
+    player->data_.assign(std::istreambuf_iterator<char>(in),
+                         std::istreambuf_iterator<char>());
+
+    Header header;
+    if (player->data_.size() < sizeof header) {
+        error(pfrm, "replay: truncated header");
+        player.reset();
+        return false;
+    }
+    memcpy(&header, player->data_.data(), sizeof header);
+
+    if (memcmp(header.magic_, magic, sizeof magic) not_eq 0 or
+        header.version_ not_eq format_version) {
+        error(pfrm, "replay: unrecognized file format");
+        player.reset();
+        return false;
+    }
+
+    const auto save_begin = player->data_.begin() + sizeof header;
+    if (player->data_.size() < sizeof header + header.save_length_.get()) {
+        error(pfrm, "replay: truncated save data");
+        player.reset();
+        return false;
+    }
+
+    player->save_data_.assign(save_begin,
+                              save_begin + header.save_length_.get());
+    player->position_ = sizeof header + header.save_length_.get();
+    player->critical_seed_ = header.critical_seed_.get();
+    player->utility_seed_ = header.utility_seed_.get();
+
+    info(pfrm, "replay: playback started");
+
+    return true;
+}
+
+
+bool playing()
+{
+    return static_cast<bool>(player);
+}
+
+
+std::vector<u8>& save_data()
+{
+    if (player) {
+        return player->save_data_;
+    }
+    return empty_save_data;
+}
+
+
+// Run commands from the stream until we reach the next frame. Returns false at
+// the end of the stream.
+static bool playback_frame(Platform& pfrm, Player& p)
+{
+    while (p.run_remaining_ == 0) {
+        if (p.position_ >= p.data_.size()) {
+            return false;
+        }
+
+        switch (p.data_[p.position_++]) {
+        case Command::frames:
+            if (not read_varint(p, p.run_remaining_)) {
+                return false;
+            }
+            break;
+
+        case Command::keys:
+            if (p.position_ + 2 > p.data_.size()) {
+                return false;
+            }
+            p.keys_ = p.data_[p.position_] | (p.data_[p.position_ + 1] << 8);
+            p.position_ += 2;
+            break;
+
+        case Command::delta_change: {
+            u32 zigzag;
+            if (not read_varint(p, zigzag)) {
+                return false;
+            }
+            p.delta_ += s32(zigzag >> 1) ^ -s32(zigzag & 1);
+            break;
+        }
+
+        case Command::seed: {
+            u32 expected;
+            if (not read_u32(p, expected)) {
+                return false;
+            }
+            if (u32(rng::critical_state) not_eq expected and
+                not p.desynced_) {
+                p.desynced_ = true;
+                StringBuffer<64> msg("replay: desync at frame ");
+                msg += to_string<12>(p.frame_count_).c_str();
+                warning(pfrm, msg.c_str());
+            }
+            break;
+        }
+
+        default:
+            error(pfrm, "replay: corrupt stream");
+            return false;
+        }
+    }
+
+    --p.run_remaining_;
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Platform hooks
+////////////////////////////////////////////////////////////////////////////////
+
+
+PackedKeys input(Platform& pfrm, PackedKeys keys)
+{
+    if (player) {
+        if (player->frame_count_ == 0) {
+            rng::critical_state = player->critical_seed_;
+            rng::utility_state = player->utility_seed_;
+        }
+
+        if (not playback_frame(pfrm, *player)) {
+            info(pfrm, "replay: playback finished");
+            player.reset();
+            return keys;
+        }
+
+        ++player->frame_count_;
+
+        return player->keys_;
+    }
+
+    if (recorder) {
+        if (not recorder->header_written_) {
+            write_header(*recorder);
+        }
+
+        // NOTE: Some code polls the keyboard without resetting the delta clock
+        // (e.g. during startup). Still counts as a frame, with an unchanged
+        // delta, so that playback consumes input at the same rate.
+        if (recorder->frame_pending_) {
+            record_frame(*recorder, recorder->delta_);
+        }
+
+        recorder->pending_keys_ = keys;
+        recorder->pending_seed_ = rng::critical_state;
+        recorder->frame_pending_ = true;
+    }
+
+    return keys;
+}
+
+
+Microseconds delta(Microseconds measured)
+{
+    if (player) {
+        return player->delta_;
+    }
+
+    if (recorder and recorder->frame_pending_) {
+        record_frame(*recorder, measured);
+        recorder->frame_pending_ = false;
+    }
+
+    return measured;
+}
+
+
+} // namespace replay
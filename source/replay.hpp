@@ -0,0 +1,91 @@
+#pragma once
+
+#include "platform/platform.hpp"
+#include <vector>
+
+
+// Input recording and deterministic playback, for the desktop and headless
+// platforms (the gameboy advance has neither a filesystem nor the memory to
+// hold a recording).
+//
+// While recording, the platform reports the keyboard state and the frame delta
+// for every update. Along with the initial rng seeds and a copy of the save
+// data, that's everything that we need to reproduce a play session. During
+// playback, the platform substitutes the recorded input and deltas for the
+// real ones. The stream stores rng::critical_state checkpoints at regular
+// intervals, so that we can tell when playback diverges from the recording.
+//
+// Stream format, after a fixed header (see replay.cpp):
+//
+//   frames  <varint count>  : run count frames with the current keys and delta
+//   keys    <u16>           : set the current key states (one bit per Key)
+//   delta   <zigzag varint> : add to the current frame delta
+//   seed    <u32>           : expected rng::critical_state at the next frame
+//
+// Key states change infrequently, so most of the stream consists of short
+// commands. On platforms with a fixed timestep, the delta never changes, and
+// long stretches of gameplay collapse into a single run.
+
+
+namespace replay {
+
+
+using PackedKeys = u16;
+
+static_assert(int(Key::count) <= sizeof(PackedKeys) * 8);
+
+
+bool start_recording(Platform& pfrm,
+                     const char* path,
+                     const std::vector<u8>& save_data);
+
+
+bool start_playback(Platform& pfrm, const char* path);
+
+
+// Flush any buffered output and close the recording.
+void stop_recording();
+
+
+bool recording();
+bool playing();
+
+
+// The save data captured at the start of the recording. While playing back,
+// platforms should read and write save data here, rather than to the real save
+// file.
+std::vector<u8>& save_data();
+
+
+// Called by the platform, once per update, after polling the input devices.
+// Returns the input to use for the frame.
+PackedKeys input(Platform& pfrm, PackedKeys keys);
+
+
+// Called by the platform's DeltaClock::reset(), once per update, after the call
+// to input(). Returns the delta to use for the frame.
+Microseconds delta(Microseconds measured);
+
+
+template <typename KeyStates> void filter_input(Platform& pfrm, KeyStates& keys)
+{
+    if (not recording() and not playing()) {
+        return;
+    }
+
+    PackedKeys packed = 0;
+    for (int i = 0; i < int(Key::count); ++i) {
+        if (keys[i]) {
+            packed |= 1 << i;
+        }
+    }
+
+    packed = input(pfrm, packed);
+
+    for (int i = 0; i < int(Key::count); ++i) {
+        keys[i] = packed & (1 << i);
+    }
+}
+
+
+} // namespace replay
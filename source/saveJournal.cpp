@@ -0,0 +1,336 @@
+#include "saveJournal.hpp"
+#include <string.h>
+
+
+static const u16 record_magic = 0x4A53;
+
+
+enum RecordType : u8 {
+    snapshot = 1,
+
+    // A write that changes several separate byte ranges produces a series of
+    // partial deltas, followed by a delta. The deltas only take effect
+    // together, so that an interrupted write does not leave the save half
+    // updated.
+    partial_delta = 2,
+    delta = 3,
+};
+
+
+static u32 crc32(u32 crc, const u8* data, u32 length)
+{
+    static const u32 table[16] = {0x00000000,
+                                  0x1DB71064,
+                                  0x3B6E20C8,
+                                  0x26D930AC,
+                                  0x76DC4190,
+                                  0x6B6B51F4,
+                                  0x4DB26158,
+                                  0x5005713C,
+                                  0xEDB88320,
+                                  0xF00F9344,
+                                  0xD6D6A3E8,
+                                  0xCB61B38C,
+                                  0x9B64C2B0,
+                                  0x86D3D2D4,
+                                  0xA00AE278,
+                                  0xBDBDF21C};
+
+    crc = ~crc;
+    for (u32 i = 0; i < length; ++i) {
+        crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+        crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+    }
+    return ~crc;
+}
+
+
+bool SaveJournal::load_record(u32 pos, Header& header)
+{
+    device_.read(pos, &header, sizeof header);
+
+    if (header.magic_ not_eq record_magic or
+        header.type_ < snapshot or header.type_ > delta or
+        header.offset_ + header.length_ > capacity or
+        pos % sector_size + sizeof header + header.length_ > sector_size) {
+        return false;
+    }
+
+    Header copy = header;
+    copy.crc_ = 0;
+    u32 crc = crc32(0, (const u8*)&copy, sizeof copy);
+
+    // Stream the payload through a small buffer, rather than reserving space
+    // for a whole record on the stack. The caller reads the payload again, if
+    // it's valid.
+    u8 buffer[32];
+    for (u32 i = 0; i < header.length_; i += sizeof buffer) {
+        const u32 n = std::min(u32(sizeof buffer), header.length_ - i);
+        device_.read(pos + sizeof header + i, buffer, n);
+        crc = crc32(crc, buffer, n);
+    }
+
+    return crc == header.crc_;
+}
+
+
+void SaveJournal::mount()
+{
+    mounted_ = true;
+
+    memset(image_, 0, sizeof image_);
+    size_ = 0;
+
+    bool found = false;
+
+    for (u32 sector = 0; sector < sector_count; ++sector) {
+        Header header;
+        if (load_record(sector * sector_size, header) and
+            header.type_ == snapshot and
+            (not found or s32(header.sequence_ - sequence_) > 0)) {
+            found = true;
+            active_sector_ = sector;
+            sequence_ = header.sequence_;
+            size_ = header.length_;
+        }
+    }
+
+    if (not found) {
+        // Either the storage is blank, or it holds a save written before we
+        // introduced the journal, in which case, the save block lives at the
+        // very beginning of the storage. Import the old data, and let the
+        // caller sort out whether it's valid. The first write will create a
+        // snapshot in sector one, leaving the old data in place until then.
+        device_.read(0, image_, capacity);
+        for (u8 c : image_) {
+            if (c not_eq 0xff) {
+                size_ = capacity;
+                break;
+            }
+        }
+        if (not size_) {
+            memset(image_, 0, sizeof image_);
+        }
+        active_sector_ = 0;
+        needs_compaction_ = true;
+        return;
+    }
+
+    const u32 begin = active_sector_ * sector_size;
+    device_.read(begin + sizeof(Header), image_, size_);
+
+    const u32 first = begin + sizeof(Header) + size_;
+
+    // Find the end of the last complete write.
+    u32 pos = first;
+    u32 committed = first;
+    bool clean_end = true;
+
+    while (pos + sizeof(Header) <= begin + sector_size) {
+        Header header;
+        if (not load_record(pos, header) or header.type_ == snapshot or
+            header.sequence_ not_eq sequence_ + 1) {
+            // Either we've reached the erased part of the sector, or the
+            // record is garbage.
+            clean_end = header.magic_ == 0xffff;
+            break;
+        }
+
+        sequence_ = header.sequence_;
+        pos += sizeof header + header.length_;
+
+        if (header.type_ == delta) {
+            committed = pos;
+        }
+    }
+
+    append_pos_ = pos;
+
+    // Records following the last complete write need to go, or a subsequent
+    // write would appear to complete them.
+    needs_compaction_ = not clean_end or pos not_eq committed;
+
+    for (pos = first; pos < committed;) {
+        Header header;
+        device_.read(pos, &header, sizeof header);
+        device_.read(
+            pos + sizeof header, image_ + header.offset_, header.length_);
+
+        size_ = std::max(size_, u32(header.offset_ + header.length_));
+        pos += sizeof header + header.length_;
+    }
+}
+
+
+bool SaveJournal::append(u8 type, u32 offset, u32 length)
+{
+    Header header;
+    header.magic_ = record_magic;
+    header.type_ = type;
+    header.unused_ = 0;
+    header.sequence_ = sequence_ + 1;
+    header.offset_ = offset;
+    header.length_ = length;
+    header.crc_ = 0;
+    header.crc_ = crc32(crc32(0, (const u8*)&header, sizeof header),
+                        image_ + offset,
+                        length);
+
+    const u32 payload_pos = append_pos_ + sizeof header;
+
+    if (not device_.write(append_pos_, &header, sizeof header) or
+        not device_.write(payload_pos, image_ + offset, length)) {
+        // Whatever we wrote is garbage now.
+        needs_compaction_ = true;
+        return false;
+    }
+
+    sequence_ = header.sequence_;
+    append_pos_ += sizeof header + length;
+
+    return true;
+}
+
+
+bool SaveJournal::compact()
+{
+    if (not mounted_) {
+        mount();
+    }
+
+    // Never erase the active sector, which holds the last good copy of the
+    // save contents. If a sector fails to erase or program, try the next one.
+    for (u32 i = 1; i < sector_count; ++i) {
+        const u32 sector = (active_sector_ + i) % sector_count;
+
+        if (not device_.erase_sector(sector)) {
+            continue;
+        }
+
+        append_pos_ = sector * sector_size;
+
+        if (append(snapshot, 0, size_)) {
+            active_sector_ = sector;
+            needs_compaction_ = false;
+            return true;
+        }
+    }
+
+    needs_compaction_ = true;
+    return false;
+}
+
+
+bool SaveJournal::write(const void* data, u32 length, u32 offset)
+{
+    if (not mounted_) {
+        mount();
+    }
+
+    if (offset + length > capacity) {
+        return false;
+    }
+
+    const u8* src = (const u8*)data;
+    const u32 old_size = size_;
+
+    if (offset + length > size_) {
+        size_ = offset + length;
+    }
+
+    auto unchanged = [&](u32 i) {
+        return offset + i < old_size and image_[offset + i] == src[i];
+    };
+
+    struct Run {
+        u16 begin_;
+        u16 end_;
+    };
+
+    static constexpr u32 max_runs = 16;
+    Run runs[max_runs];
+    u32 run_count = 0;
+    u32 record_bytes = 0;
+
+    u32 i = 0;
+    while (true) {
+        while (i < length and unchanged(i)) {
+            ++i;
+        }
+
+        if (i == length) {
+            break;
+        }
+
+        // Extend the run of changed bytes across short stretches of unchanged
+        // ones, which cost less to rewrite than a second record header.
+        const u32 begin = i;
+        u32 end = i + 1;
+        for (u32 same = 0, j = end; j < length; ++j) {
+            if (not unchanged(j)) {
+                same = 0;
+                end = j + 1;
+            } else if (++same > sizeof(Header)) {
+                break;
+            }
+        }
+
+        memcpy(image_ + offset + begin, src + begin, end - begin);
+
+        if (run_count < max_runs) {
+            runs[run_count] = {u16(offset + begin), u16(offset + end)};
+        }
+        ++run_count;
+        record_bytes += sizeof(Header) + (end - begin);
+
+        i = end;
+    }
+
+    if (run_count == 0) {
+        // Nothing changed, nothing to write.
+        return true;
+    }
+
+    // We want either all of the records, or none of them, in the active
+    // sector. If they won't fit, a snapshot includes the changes anyway.
+    const u32 sector_end = (active_sector_ + 1) * sector_size;
+    if (needs_compaction_ or run_count > max_runs or
+        append_pos_ + record_bytes > sector_end) {
+        return compact();
+    }
+
+    for (u32 r = 0; r < run_count; ++r) {
+        const auto type = r + 1 == run_count ? delta : partial_delta;
+        if (not append(type, runs[r].begin_, runs[r].end_ - runs[r].begin_)) {
+            return compact();
+        }
+    }
+
+    return true;
+}
+
+
+u32 SaveJournal::size()
+{
+    if (not mounted_) {
+        mount();
+    }
+
+    return size_;
+}
+
+
+bool SaveJournal::read(void* dest, u32 length, u32 offset)
+{
+    if (not mounted_) {
+        mount();
+    }
+
+    if (offset + length > size_) {
+        return false;
+    }
+
+    memcpy(dest, image_ + offset, length);
+
+    return true;
+}
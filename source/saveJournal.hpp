@@ -0,0 +1,108 @@
+#pragma once
+
+#include "number/numeric.hpp"
+
+
+// A journaled save format, for flash and sram cartridges (and the desktop
+// savefile, which uses the same layout). Rather than rewriting the whole save
+// block, each write compares the new data against a copy of the current save
+// contents, and appends only the changed byte ranges to the journal, as small
+// delta records. Each record carries a sequence number and a crc, so that a
+// write interrupted by a power loss leaves the previous state intact.
+//
+// The journal spans several sectors. Each sector begins with a snapshot record
+// holding the complete save contents, followed by delta records. When the
+// active sector fills up, we compact the journal, by erasing the next sector
+// in rotation and writing a fresh snapshot there. So the erase cycles spread
+// evenly across all of the sectors, and the old sector remains valid until the
+// new snapshot is complete. At startup, we find the snapshot with the highest
+// sequence number, and replay the deltas that follow it.
+//
+// Record layout, all fields in native byte order:
+//
+//   magic    u16 : record_magic, erased storage reads as 0xffff
+//   type     u8  : snapshot or delta
+//   unused   u8
+//   sequence u32 : one greater than the previous record
+//   offset   u16 : destination of the payload within the save contents
+//   length   u16 : payload size in bytes
+//   crc      u32 : crc32 of the header (with a zeroed crc field) and payload
+//   payload  length bytes
+
+
+class SaveJournal {
+public:
+    // Sector-addressed backing storage. Erasing a sector sets all of its bytes
+    // to 0xff, like flash memory.
+    class Device {
+    public:
+        virtual ~Device()
+        {
+        }
+
+        virtual void read(u32 offset, void* dest, u32 length) = 0;
+        virtual bool write(u32 offset, const void* data, u32 length) = 0;
+        virtual bool erase_sector(u32 sector) = 0;
+    };
+
+    static constexpr u32 sector_size = 4096;
+    static constexpr u32 sector_count = 3;
+
+    // The largest save block that the journal can hold.
+    static constexpr u32 capacity = 1024;
+
+    SaveJournal(Device& device) : device_(device)
+    {
+    }
+
+    bool write(const void* data, u32 length, u32 offset);
+
+    // Returns false if the requested range was never written.
+    bool read(void* dest, u32 length, u32 offset);
+
+    // The extent of the save contents written so far.
+    u32 size();
+
+    // Fold the journal into a single snapshot, in the next sector.
+    bool compact();
+
+private:
+    struct Header {
+        u16 magic_;
+        u8 type_;
+        u8 unused_;
+        u32 sequence_;
+        u16 offset_;
+        u16 length_;
+        u32 crc_;
+    };
+
+    static_assert(sizeof(Header) == 16);
+    static_assert(capacity + sizeof(Header) <= sector_size);
+
+    void mount();
+
+    // Reads the header of the record at the given position, and validates the
+    // record. Returns false if the record is missing or damaged.
+    bool load_record(u32 pos, Header& header);
+
+    // Writes a record at the append position. The caller is responsible for
+    // making sure that the record fits in the sector.
+    bool append(u8 type, u32 offset, u32 length);
+
+    Device& device_;
+
+    bool mounted_ = false;
+
+    // Set when the tail of the active sector holds garbage, e.g. from an
+    // interrupted write. We cannot append any more records to the sector.
+    bool needs_compaction_ = false;
+
+    u32 active_sector_ = 0;
+    u32 append_pos_ = 0;
+    u32 sequence_ = 0;
+
+    // The current save contents, and the number of valid bytes.
+    u32 size_ = 0;
+    u8 image_[capacity];
+};
@@ -137,6 +137,18 @@ Platform::DeltaClock::~DeltaClock()
 }
 
 
+Platform::DeltaClock::TimePoint Platform::DeltaClock::sample() const
+{
+    return 0;
+}
+
+
+Microseconds Platform::DeltaClock::duration(TimePoint t1, TimePoint t2)
+{
+    return t2 - t1;
+}
+
+
 Platform::NetworkPeer::~NetworkPeer()
 {
 }
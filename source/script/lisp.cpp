@@ -5,6 +5,7 @@
 #include "localization.hpp"
 #include "memory/buffer.hpp"
 #include "memory/pool.hpp"
+#include "profiler.hpp"
 #include <complex>
 #ifdef __GBA__
 #define HEAP_DATA __attribute__((section(".ewram")))
@@ -1369,16 +1370,13 @@ static void gc_mark_value(Value* value)
 static ProtectedBase* __protected_values = nullptr;
 
 
-ProtectedBase::ProtectedBase() : next_(nullptr)
+ProtectedBase::ProtectedBase() : prev_(nullptr)
 {
-    auto plist = __protected_values;
-    if (plist) {
-        plist->next_ = this;
-        prev_ = plist;
-    } else {
-        prev_ = nullptr;
+    next_ = __protected_values;
+    if (next_) {
+        next_->prev_ = this;
     }
-    plist = this;
+    __protected_values = this;
 }
 
 ProtectedBase::~ProtectedBase()
@@ -1388,6 +1386,8 @@ ProtectedBase::~ProtectedBase()
     }
     if (prev_) {
         prev_->next_ = next_;
+    } else {
+        __protected_values = next_;
     }
 }
 
@@ -1509,6 +1509,8 @@ void live_values(::Function<24, void(Value&)> callback)
 
 static int run_gc()
 {
+    profiler::Scope scope(bound_context->pfrm_, profiler::Marker::gc);
+
     return gc_mark(), gc_sweep();
 }
 
@@ -1,6 +1,7 @@
 #include "bytecode.hpp"
 #include "lisp.hpp"
 #include "number/endian.hpp"
+#include "profiler.hpp"
 
 
 namespace lisp {
@@ -34,6 +35,8 @@ Instruction* read(ScratchBuffer& buffer, int& pc)
 
 void vm_execute(Platform& pfrm, Value* code_buffer, const int start_offset)
 {
+    profiler::Scope scope(pfrm, profiler::Marker::vm_execute);
+
     int pc = start_offset;
 
     auto& code = *code_buffer->data_buffer().value();
@@ -1,5 +1,6 @@
 #include "blind_jump/game.hpp"
 #include "globals.hpp"
+#include "profiler.hpp"
 #include "transformGroup.hpp"
 
 
@@ -29,8 +30,11 @@ void UpdateTask::run()
 
             const auto delta = pf_->delta_clock().reset();
 
+            profiler::end_frame(delta);
+
             game.update(*pf_, delta);
 
+            profiler::Scope scope(*pf_, profiler::Marker::network_poll);
             pf_->network_peer().update();
         });
     } else {
@@ -67,7 +71,10 @@ void blind_jump_main_loop(Platform& pf)
         pf.feed_watchdog();
 
         pf.screen().clear();
-        game.acquire([&](Game& gm) { gm.render(pf); });
+        game.acquire([&](Game& gm) {
+            profiler::Scope scope(pf, profiler::Marker::render);
+            gm.render(pf);
+        });
         pf.screen().display();
     }
 }